@@ -458,6 +458,7 @@ uint32_t DecApp::decode()
               pps->getPicWidthInLumaSamples(), pps->getPicHeightInLumaSamples(), frameRate, frameScale, m_outputBitDepth[0],
               sps->getChromaFormatIdc());
           }
+          m_cVideoIOYuvReconFile[nalu.m_nuhLayerId].setWriteBehind( m_writeBehindFrames );
           m_cVideoIOYuvReconFile[nalu.m_nuhLayerId].open( reconFileName, true, m_outputBitDepth, m_outputBitDepth, bitDepths.recon ); // write mode
         }
       }
@@ -873,6 +874,9 @@ void DecApp::xCreateDecLib()
   m_cDecLib.setDecodedPictureHashSEIEnabled(m_decodedPictureHashSEIEnabled);
 
   m_cDecLib.setEpipolePredictionMode(m_epipolePredictionMode);
+  m_cDecLib.setGEDTableThreads(m_gedTableThreads);
+  m_cDecLib.setGEDTableMemoryBudget(m_gedTableMemoryBudget);
+  m_cDecLib.setReconThreads(m_reconThreads);
 
 
   if (!m_outputDecodedSEIMessagesFilename.empty())
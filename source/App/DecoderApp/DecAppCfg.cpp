@@ -114,6 +114,7 @@ bool DecAppCfg::parseCfg( int argc, char* argv[] )
   ("help",                      do_help,                               false,      "this help text")
   ("BitstreamFile,b",           m_bitstreamFileName,                   string(""), "bitstream input file name")
   ("ReconFile,o",               m_reconFileName,                       string(""), "reconstructed YUV output file name\n")
+  ("WriteBehindFrames",         m_writeBehindFrames,                   0,          "reconstructed frames written behind on a background thread (0: write synchronously)\n")
 
   ("OplFile,-opl",              m_oplFilename ,                        string(""), "opl-file name without extension for conformance testing\n")
 
@@ -168,6 +169,9 @@ bool DecAppCfg::parseCfg( int argc, char* argv[] )
   ("RandomAccessPos",          m_gdrPocRandomAccess,                    0,         "POC of GDR Random access picture\n" )
 #endif // GDR_LEAK_TEST
   ("EpipolePredictionMode", m_epipolePredictionMode, EpipoleList::PredictionMode::CLOSEST, "Epipole prediction mode (none, closest)")
+  ("GEDTableThreads",       m_gedTableThreads,                     0,           "Worker threads to build the GED coordinate tables of all reference epipoles at slice start (0: build on demand in the CTU loop)")
+  ("GEDTableMemoryBudget",  m_gedTableMemoryBudget,                0,           "Memory budget for the GED coordinate tables in MiB (0: default)")
+  ("ReconThreads",          m_reconThreads,                        0,           "Worker threads reconstructing the parsed CTU rows of a slice in wavefront order and running deblocking, SAO and ALF on the rows behind the reconstruction (0: decode serially)")
   ;
 
   po::setDefaults(opts);
@@ -291,6 +295,7 @@ bool DecAppCfg::parseCfg( int argc, char* argv[] )
 DecAppCfg::DecAppCfg()
 : m_bitstreamFileName()
 , m_reconFileName()
+, m_writeBehindFrames(0)
 , m_oplFilename()
 
 , m_iSkipFrame(0)
@@ -59,6 +59,7 @@ class DecAppCfg
 protected:
   std::string   m_bitstreamFileName;                    ///< input bitstream file name
   std::string   m_reconFileName;                        ///< output reconstruction file name
+  int           m_writeBehindFrames;                    ///< reconstructed frames written behind on a background thread (0: synchronous)
 
   std::string   m_oplFilename;                        ///< filename to output conformance log.
 
@@ -98,6 +99,9 @@ protected:
   int           m_gdrPocRandomAccess;                   ///<
 #endif // GDR_LEAK_TEST
   EpipoleList::PredictionMode m_epipolePredictionMode;  ///< Epipole prediction mode.
+  int           m_gedTableThreads;                    ///< Worker threads for the GED coordinate tables (0: build in the CTU loop)
+  int           m_gedTableMemoryBudget;               ///< Memory budget for the GED coordinate tables in MiB (0: default)
+  int           m_reconThreads;                       ///< Worker threads for the CTU row reconstruction and the deblocking (0: serial)
 public:
   DecAppCfg();
   virtual ~DecAppCfg();
@@ -748,10 +748,18 @@ void EncApp::xInitLibCfg()
   m_cEncLib.setUseGED(m_GED);
   if (m_GED) {
     m_cEncLib.setGEDFlavor(m_GEDFlavor);
+    m_cEncLib.setUseGEDFixedPoint(m_GEDFixedPoint);
+    m_cEncLib.setUseGEDDMVRWindow(m_GEDDMVRWindow);
     m_cEncLib.setMMSizeConstraint(m_MMSizeConstraint);
     m_cEncLib.setUseMMMVP(m_MMMVP);
     m_cEncLib.setMMOffset4x4(m_MMOffset4x4);
     m_cEncLib.setProjectionFct(m_projectionFct);
+    m_cEncLib.setGEDTableThreads(m_GEDTableThreads);
+    m_cEncLib.setGEDTableMemoryBudget(m_GEDTableMemoryBudget);
+    m_cEncLib.setUseGEDFastSearch(m_GEDFastSearch);
+    m_cEncLib.setGEDFastDecision(m_GEDFastDecision);
+    m_cEncLib.setUseGEDSeedSearch(m_GEDSeedSearch);
+    m_cEncLib.setUseEpipoleEstimation(m_epipoleEstimation);
     m_epipoleList.setPredictionMode(m_epipolePredictionMode);
     m_cEncLib.setEpipoleList(m_epipoleList);
   }
@@ -1163,6 +1171,9 @@ void EncApp::xInitLibCfg()
   m_cEncLib.setNnPostFilterSEIActivationEnabled                  (m_nnPostFilterSEIActivationEnabled);
   m_cEncLib.setNnPostFilterSEIActivationId                       (m_nnPostFilterSEIActivationId);
   m_cEncLib.setEntropyCodingSyncEnabledFlag                      ( m_entropyCodingSyncEnabledFlag );
+  m_cEncLib.setWppThreads                                        ( m_wppThreads );
+  m_cEncLib.setWppRowReset                                       ( m_wppRowReset );
+  m_cEncLib.setFrameThreads                                      ( m_frameThreads );
   m_cEncLib.setEntryPointPresentFlag                             ( m_entryPointPresentFlag );
   m_cEncLib.setTMVPModeId                                        ( m_TMVPModeId );
   m_cEncLib.setSliceLevelRpl                                     ( m_sliceLevelRpl  );
@@ -1295,6 +1306,7 @@ void EncApp::xInitLibCfg()
   }
 
   m_cEncLib.setGopBasedTemporalFilterEnabled(m_gopBasedTemporalFilterEnabled);
+  m_cEncLib.setGopBasedTemporalFilterMotionSeeds(m_gopBasedTemporalFilterMotionSeeds);
   m_cEncLib.setBIM                                               ( m_bimEnabled );
   m_cEncLib.setNumRefLayers                                       ( m_numRefLayers );
 
@@ -1304,6 +1316,7 @@ void EncApp::xInitLibCfg()
 void EncApp::xCreateLib( std::list<PelUnitBuf*>& recBufList, const int layerId )
 {
   // Video I/O
+  m_cVideoIOYuvInputFile.setReadAhead( m_readAheadFrames );
   m_cVideoIOYuvInputFile.open( m_inputFileName,     false, m_inputBitDepth, m_MSBExtendedBitDepth, m_internalBitDepth );  // read  mode
 #if EXTENSION_360_VIDEO
   m_cVideoIOYuvInputFile.skipFrames(m_FrameSkip, m_inputFileWidth, m_inputFileHeight, m_InputChromaFormatIDC);
@@ -1342,6 +1355,7 @@ void EncApp::xCreateLib( std::list<PelUnitBuf*>& recBufList, const int layerId )
       m_cVideoIOYuvReconFile.setOutputY4mInfo(m_sourceWidth, m_sourceHeight, m_iFrameRate, 1, m_internalBitDepth[0],
                                               m_chromaFormatIDC);
     }
+    m_cVideoIOYuvReconFile.setWriteBehind( m_writeBehindFrames );
     m_cVideoIOYuvReconFile.open( reconFileName, true, m_outputBitDepth, m_outputBitDepth, m_internalBitDepth );  // write mode
   }
 
@@ -1440,6 +1454,7 @@ void EncApp::createLib( const int layerIdx )
                           m_gopBasedTemporalFilterPastRefs, m_gopBasedTemporalFilterFutureRefs, m_firstValidFrame,
                           m_lastValidFrame
                           , m_gopBasedTemporalFilterEnabled, m_cEncLib.getAdaptQPmap(), m_cEncLib.getBIM(), m_uiCTUSize
+                          , m_gopBasedTemporalFilterMotionSeeds ? m_cEncLib.getMotionSeeds() : nullptr
                           );
   }
   if ( m_fgcSEIAnalysisEnabled && m_fgcSEIExternalDenoised.empty() )
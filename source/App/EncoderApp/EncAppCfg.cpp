@@ -806,6 +806,8 @@ bool EncAppCfg::parseCfg( int argc, char* argv[] )
   ("InputPathPrefix,-ipp",                            inputPathPrefix,                             string(""), "pathname to prepend to input filename")
   ("BitstreamFile,b",                                 m_bitstreamFileName,                         string(""), "Bitstream output file name")
   ("ReconFile,o",                                     m_reconFileName,                             string(""), "Reconstructed YUV output file name")
+  ("ReadAheadFrames",                                 m_readAheadFrames,                                    0, "Input frames read and converted ahead on a background thread (0: read synchronously)")
+  ("WriteBehindFrames",                               m_writeBehindFrames,                                  0, "Reconstructed frames written behind on a background thread (0: write synchronously)")
 #if JVET_Z0120_SII_SEI_PROCESSING
   ("SEIShutterIntervalPreFilename,-sii",              m_shutterIntervalPreFileName, string(""), "File name of Pre-Filtering video. If empty, not output video\n")
 #endif  
@@ -1046,12 +1048,20 @@ bool EncAppCfg::parseCfg( int argc, char* argv[] )
 
   ("GED",                                             m_GED,                                            false, "Enable geodesic motion model (0:off, 1:on)")
   ("GEDFlavor",                                       m_GEDFlavor, GeodesicMotionModel::Flavor::VISHWANATH_ORIGINAL, "Flavor of geodesic motion model (vishwanath_original, vishwanath_modulated, regensky_geo_global, regensky_geo_block")
+  ("GEDFixedPoint",                                   m_GEDFixedPoint,                                  false, "Use the integer implementation of the geodesic motion model, equirectangular projection only (0:off, 1:on)")
+  ("GEDDMVRWindow",                                   m_GEDDMVRWindow,                                  false, "Evaluate the projected DMVR costs from one reprojected search window per reference list (0:off, 1:on)")
   ("Epipole", [this](po::Options &opts, const string &argv, po::ErrorReporter &er) { this->parseEpipole(opts, argv, er); }, "Epipole list entry as (curPOC, refPOC, x, y, z).")
   ("EpipolePredictionMode",                           m_epipolePredictionMode, EpipoleList::PredictionMode::CLOSEST, "Epipole prediction mode (none, closest)")
+  ("EpipoleEstimation",                               m_epipoleEstimation,                              false, "Estimate the epipole of pictures without a given epipole from the motion to the closest reference picture (0:off, 1:on)")
   ("MMSizeConstraint",                                m_MMSizeConstraint,                                   0, "Disable MM if CU size is smaller (default: 0)")
   ("MMMVP",                                           m_MMMVP,                                           true, "Enable multi-model motion vector prediction (0:off, 1:on)")
   ("MMOffset4x4",                                     m_MMOffset4x4,                                        1, "Offset of mv reprojection calculation within 4x4 subblocks (0:0, 1:1, 2:2, 3:3, 4:1.5)")
   ("Projection",                                      m_projectionFct,                                      -1, "Projection function for MM (0: ERP)")
+  ("GEDTableThreads",                                 m_GEDTableThreads,                                     0, "Worker threads to build the GED coordinate tables of all reference epipoles at picture start (0: build on demand in the CTU loop)")
+  ("GEDTableMemoryBudget",                            m_GEDTableMemoryBudget,                                0, "Memory budget for the GED coordinate tables in MiB (0: default)")
+  ("GEDFastSearch",                                   m_GEDFastSearch,                                   false, "Prune GED integer search candidates with a cost estimate on the corner and center subblocks, not lossless (0:off, 1:on)")
+  ("GEDFastDecision",                                 m_GEDFastDecision,                                     0, "Skip the GEODESIC pass of CUs where the CLASSIC result, the neighbourhood and the picture statistics indicate it cannot win (0:off, 1:conservative, 2:fast)")
+  ("GEDSeedSearch",                                   m_GEDSeedSearch,                                   false, "Refine the equivalent CLASSIC mv of the same block in a narrow window instead of a full GEODESIC motion search (0:off, 1:on)")
 
   ("AllowDisFracMMVD",                                m_allowDisFracMMVD,                               false, "Disable fractional MVD in MMVD mode adaptively")
   ("AffineAmvr",                                      m_AffineAmvr,                                     false, "Eanble AMVR for affine inter mode")
@@ -1287,6 +1297,9 @@ bool EncAppCfg::parseCfg( int argc, char* argv[] )
   ("WeightedPredMethod,-wpM",                         tmpWeightedPredictionMethod, int(WP_PER_PICTURE_WITH_SIMPLE_DC_COMBINED_COMPONENT), "Weighted prediction method")
   ("Log2ParallelMergeLevel",                          m_log2ParallelMergeLevel,                            2u, "Parallel merge estimation region")
   ("WaveFrontSynchro",                                m_entropyCodingSyncEnabledFlag,                   false, "0: entropy coding sync disabled; 1 entropy coding sync enabled")
+  ("WppThreads",                                      m_wppThreads,                                         0, "Worker threads encoding the CTU rows of a picture concurrently, requires WaveFrontSynchro and WppRowReset (0: serial)")
+  ("WppRowReset",                                     m_wppRowReset,                                    false, "Start the encoder search state (uni MV lists, reused uni MVs, CLASSIC seeds, SATD thresholds) afresh at each CTU row with WaveFrontSynchro, as the rows of WppThreads do (0: carry over from the previous CTU, 1: reset)")
+  ("FrameThreads",                                    m_frameThreads,                                       0, "Pictures of a GOP that do not reference each other compressed concurrently (0, 1: serial)")
   ("EntryPointsPresent",                              m_entryPointPresentFlag,                           true, "0: entry points is not present; 1 entry points may be present in slice header")
   ("ScalingList",                                     m_useScalingListId,                    SCALING_LIST_OFF, "0/off: no scaling list, 1/default: default scaling lists, 2/file: scaling lists specified in ScalingListFile")
   ("ScalingListFile",                                 m_scalingListFileName,                       string(""), "Scaling list file name. Use an empty string to produce help.")
@@ -1679,6 +1692,7 @@ bool EncAppCfg::parseCfg( int argc, char* argv[] )
     ("TemporalFilter",               m_gopBasedTemporalFilterEnabled,                     false, "Enable GOP based temporal filter. Disabled per default")
     ("TemporalFilterPastRefs",       m_gopBasedTemporalFilterPastRefs,          TF_DEFAULT_REFS, "Number of past references for temporal prefilter")
     ("TemporalFilterFutureRefs",     m_gopBasedTemporalFilterFutureRefs,        TF_DEFAULT_REFS, "Number of future references for temporal prefilter")
+    ("TemporalFilterMotionSeeds",    m_gopBasedTemporalFilterMotionSeeds,                 false, "Use the motion fields of the temporal filter as start candidates of the motion search (0:off, 1:on)")
     ("FirstValidFrame",              m_firstValidFrame,                                       0, "First valid frame")
     ("LastValidFrame",               m_lastValidFrame,                                  MAX_INT, "Last valid frame")
     ("TemporalFilterStrengthFrame*", m_gopBasedTemporalFilterStrengths, std::map<int, double>(), "Strength for every * frame in GOP based temporal filter, where * is an integer."
@@ -3757,6 +3771,48 @@ bool EncAppCfg::xCheckParameter()
     m_PROF = false;
   }
 
+  xConfirmPara(m_wppThreads < 0, "WppThreads must be greater than or equal to 0.");
+  if (m_wppThreads > 0)
+  {
+    // the CTU rows are encoded with separate tool instances, which do not share picture level encoder state
+    xConfirmPara(!m_entropyCodingSyncEnabledFlag, "WppThreads requires WaveFrontSynchro.");
+    xConfirmPara(!m_wppRowReset, "WppThreads requires WppRowReset, the rows do not share their search state.");
+    xConfirmPara(m_RCEnableRateControl, "WppThreads is not supported with RateControl.");
+    xConfirmPara(m_bUsePerceptQPA, "WppThreads is not supported with PerceptQPA.");
+    xConfirmPara(m_IBCMode, "WppThreads is not supported with IBC.");
+    xConfirmPara(m_PLTMode, "WppThreads is not supported with PLT.");
+    xConfirmPara(m_MCTSEncConstraint, "WppThreads is not supported with MCTSEncConstraint.");
+    xConfirmPara(m_useScalingListId != SCALING_LIST_OFF, "WppThreads is not supported with ScalingList.");
+    xConfirmPara(m_wcgChromaQpControl.isEnabled(), "WppThreads is not supported with WCGPPSEnable.");
+    xConfirmPara(m_lumaLevelToDeltaQPMapping.isEnabled(), "WppThreads is not supported with LumaLevelToDeltaQPMode.");
+    xConfirmPara(m_uiDeltaQpRD > 0, "WppThreads is not supported with DeltaQpRD.");
+  }
+
+  xConfirmPara(m_readAheadFrames < 0, "ReadAheadFrames must be greater than or equal to 0.");
+  xConfirmPara(m_writeBehindFrames < 0, "WriteBehindFrames must be greater than or equal to 0.");
+  xConfirmPara(m_frameThreads < 0, "FrameThreads must be greater than or equal to 0.");
+  if (m_frameThreads > 1)
+  {
+    // the pictures are compressed with the tool instances of the CTU row threads; the setup and the loop filters of the
+    // pictures stay serial in coding order, encoder state carried from one compressed picture to the next is not
+    xConfirmPara(m_RCEnableRateControl, "FrameThreads is not supported with RateControl.");
+    xConfirmPara(m_bUsePerceptQPA, "FrameThreads is not supported with PerceptQPA.");
+    xConfirmPara(m_IBCMode, "FrameThreads is not supported with IBC.");
+    xConfirmPara(m_PLTMode, "FrameThreads is not supported with PLT.");
+    xConfirmPara(m_MCTSEncConstraint, "FrameThreads is not supported with MCTSEncConstraint.");
+    xConfirmPara(m_useScalingListId != SCALING_LIST_OFF, "FrameThreads is not supported with ScalingList.");
+    xConfirmPara(m_wcgChromaQpControl.isEnabled(), "FrameThreads is not supported with WCGPPSEnable.");
+    xConfirmPara(m_lumaLevelToDeltaQPMapping.isEnabled(), "FrameThreads is not supported with LumaLevelToDeltaQPMode.");
+    xConfirmPara(m_uiDeltaQpRD > 0, "FrameThreads is not supported with DeltaQpRD.");
+    xConfirmPara(m_isField, "FrameThreads is not supported with field coding.");
+    xConfirmPara(m_compositeRefEnabled, "FrameThreads is not supported with CompositeLTReference.");
+    xConfirmPara(m_subPicInfoPresentFlag, "FrameThreads is not supported with subpictures.");
+    xConfirmPara(m_maxLayers > 1, "FrameThreads is not supported with multiple layers.");
+    xConfirmPara(m_tsrcRicePresentFlag, "FrameThreads is not supported with TSRCRicePresent.");
+    xConfirmPara(!m_decodeBitstreams[0].empty() || !m_decodeBitstreams[1].empty() || m_debugCTU >= 0,
+                 "FrameThreads is not supported with DebugBitstream and DebugCTU.");
+  }
+
   if (m_GED)
   {
     xConfirmPara(m_projectionFct < 0 || m_projectionFct >= NUM_PROJECTIONS, ("Projection function with id '" + std::to_string(m_projectionFct) + "' does not exist.").c_str());
@@ -3764,7 +3820,11 @@ bool EncAppCfg::xCheckParameter()
 
   if (m_GED)
   {
-    xConfirmPara(m_epipoleList.count() < 1, "No epipoles given for geodesic motion model.");
+    xConfirmPara(m_epipoleList.count() < 1 && !m_epipoleEstimation, "No epipoles given for geodesic motion model.");
+    xConfirmPara(m_GEDTableThreads < 0, "GEDTableThreads must be greater than or equal to 0.");
+    xConfirmPara(m_GEDTableMemoryBudget < 0, "GEDTableMemoryBudget must be greater than or equal to 0.");
+    xConfirmPara(m_GEDFixedPoint && m_projectionFct != EQUIRECTANGULAR, "GEDFixedPoint requires the equirectangular projection.");
+    xConfirmPara(m_GEDFastDecision < 0 || m_GEDFastDecision > 2, "GEDFastDecision must be in the range of 0 to 2.");
   }
 
   xConfirmPara(m_mtsMode < 0 || m_mtsMode > 4, "MTS must in the range 0..4");
@@ -4731,6 +4791,8 @@ bool EncAppCfg::xCheckParameter()
       msg(WARNING, "Number of frames used for temporal prefilter is different from default.\n");
     }
   }
+  xConfirmPara(m_gopBasedTemporalFilterMotionSeeds && !m_gopBasedTemporalFilterEnabled && !m_bimEnabled,
+               "TemporalFilterMotionSeeds requires TemporalFilter or BIM");
   if (m_bimEnabled)
   {
     xConfirmPara(m_temporalSubsampleRatio != 1, "Block Importance Mapping only support Temporal sub-sample ratio 1");
@@ -4975,6 +5037,8 @@ void EncAppCfg::xPrintParameter()
   msg( VERBOSE, "PME:%d ", m_log2ParallelMergeLevel);
   const int iWaveFrontSubstreams = m_entropyCodingSyncEnabledFlag ? (m_sourceHeight + m_uiMaxCUHeight - 1) / m_uiMaxCUHeight : 1;
   msg( VERBOSE, " WaveFrontSynchro:%d WaveFrontSubstreams:%d", m_entropyCodingSyncEnabledFlag?1:0, iWaveFrontSubstreams);
+  msg( VERBOSE, " WppThreads:%d WppRowReset:%d", m_wppThreads, m_wppRowReset);
+  msg( VERBOSE, " FrameThreads:%d", m_frameThreads);
   msg( VERBOSE, " ScalingList:%d ", m_useScalingListId );
   msg( VERBOSE, "TMVPMode:%d ", m_TMVPModeId );
   msg( VERBOSE, " DQ:%d ", m_depQuantEnabledFlag);
@@ -5109,6 +5173,7 @@ void EncAppCfg::xPrintParameter()
     msg( VERBOSE, "RPR:%d ", 0 );
   }
   msg(VERBOSE, "TemporalFilter:%d/%d ", m_gopBasedTemporalFilterPastRefs, m_gopBasedTemporalFilterFutureRefs);
+  msg(VERBOSE, "TemporalFilterMotionSeeds:%d ", m_gopBasedTemporalFilterMotionSeeds);
   msg(VERBOSE, "SEI CTI:%d ", m_ctiSEIEnabled);
   msg(VERBOSE, "BIM:%d ", m_bimEnabled);
   msg(VERBOSE, "SEI FGC:%d ", m_fgcSEIEnabled);
@@ -5128,11 +5193,22 @@ void EncAppCfg::xPrintParameter()
       case GeodesicMotionModel::REGENSKY_GEO_BLOCK: gedFlavorStr = "regensky_geo_block"; break;
       }
       msg( VERBOSE, "GEDFlavor:%s ", gedFlavorStr.c_str() );
+      msg( VERBOSE, "GEDFixedPoint:%d ", m_GEDFixedPoint );
+      msg( VERBOSE, "GEDDMVRWindow:%d ", m_GEDDMVRWindow );
     }
     msg( VERBOSE, "MMSizeConstraint:%d ", m_MMSizeConstraint );
     msg( VERBOSE, "MM-MVP:%d ", m_MMMVP );
     msg( VERBOSE, "MMOffset4x4:%d ", m_MMOffset4x4 );
     msg( VERBOSE, "Projection:%d ", m_projectionFct );
+    if (m_GED)
+    {
+      msg( VERBOSE, "GEDTableThreads:%d ", m_GEDTableThreads );
+      msg( VERBOSE, "GEDTableMemoryBudget:%d ", m_GEDTableMemoryBudget );
+      msg( VERBOSE, "GEDFastSearch:%d ", m_GEDFastSearch );
+      msg( VERBOSE, "GEDFastDecision:%d ", m_GEDFastDecision );
+      msg( VERBOSE, "GEDSeedSearch:%d ", m_GEDSeedSearch );
+      msg( VERBOSE, "EpipoleEstimation:%d ", m_epipoleEstimation );
+    }
     if (m_GED && m_epipoleList.count() > 0) {
       msg( VERBOSE, "EpipolePredictionMode:%d ", m_epipolePredictionMode );
       m_epipoleList.printSummary();
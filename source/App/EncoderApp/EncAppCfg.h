@@ -86,6 +86,8 @@ protected:
   std::string m_inputFileName;                                ///< source file name
   std::string m_bitstreamFileName;                            ///< output bitstream file
   std::string m_reconFileName;                                ///< output reconstruction file
+  int         m_readAheadFrames;                              ///< input frames read ahead on a background thread (0: synchronous)
+  int         m_writeBehindFrames;                            ///< reconstructed frames written behind on a background thread (0: synchronous)
 
   // Lambda modifiers
   double    m_adLambdaModifier[ MAX_TLAYER ];                 ///< Lambda modifier array for each temporal layer
@@ -381,12 +383,20 @@ protected:
   // Multi-model inter prediction
   bool      m_GED;  ///< Use geodesic motion model
   GeodesicMotionModel::Flavor m_GEDFlavor;  ///< Flavor of geodesic motion model
+  bool      m_GEDFixedPoint;  ///< Use the integer geodesic motion model
+  bool      m_GEDDMVRWindow;  ///< Evaluate projected DMVR costs from one reprojected search window per list
   EpipoleList m_epipoleList;  ///< Epipole list
   EpipoleList::PredictionMode m_epipolePredictionMode;  ///< Epipole prediction mode
   int       m_MMSizeConstraint;  ///< Minimum size to check multi-model
   bool      m_MMMVP;  ///< Employ multi-model motion vector prediction
   int       m_MMOffset4x4;  ///< Reprojection offset within 4x4 subblock
   int       m_projectionFct;  ///< Projection function
+  int       m_GEDTableThreads;  ///< Worker threads for the GED coordinate tables at picture start (0: build in the CTU loop)
+  int       m_GEDTableMemoryBudget;  ///< Memory budget for the GED coordinate tables in MiB (0: default)
+  bool      m_GEDFastSearch;  ///< Prune GED integer search candidates with a subsampled cost estimate (lossy)
+  int       m_GEDFastDecision;  ///< Preset of the GEODESIC pass early termination (0:off, 1:conservative, 2:fast)
+  bool      m_GEDSeedSearch;    ///< Seed the GEODESIC motion search with the CLASSIC result of the same block
+  bool      m_epipoleEstimation;  ///< Estimate the epipoles of pictures without a given epipole from their motion
 
   bool      m_allowDisFracMMVD;
   bool      m_AffineAmvr;
@@ -522,6 +532,9 @@ protected:
   uint32_t  m_numTileRows;                                    ///< derived number of tile rows
   bool      m_singleSlicePerSubPicFlag;
   bool      m_entropyCodingSyncEnabledFlag;
+  int       m_wppThreads;                                     ///< Worker threads encoding the CTU rows of a picture concurrently (0: serial)
+  bool      m_wppRowReset;                                    ///< Reset the encoder search state at each CTU row with WaveFrontSynchro
+  int       m_frameThreads;                                   ///< Pictures of a GOP compressed concurrently (0, 1: serial)
   bool      m_entryPointPresentFlag;                          ///< flag for the presence of entry points
 
   bool      m_bFastUDIUseMPMEnabled;
@@ -904,6 +917,7 @@ protected:
   bool                  m_gopBasedTemporalFilterEnabled;
   int                   m_gopBasedTemporalFilterPastRefs;
   int                   m_gopBasedTemporalFilterFutureRefs;
+  bool                  m_gopBasedTemporalFilterMotionSeeds;           ///< Keep the motion fields of the temporal filter as motion search seeds
   std::map<int, double> m_gopBasedTemporalFilterStrengths;             ///< Filter strength per frame for the GOP-based Temporal Filter
   bool                  m_bimEnabled;
 
@@ -488,6 +488,8 @@ Void TExt360AppEncCfg::addOptions(df::program_options_lite::Options &opts, TExt3
   ("CodingFaceWidth",                            m_iCodingFaceWidth,                  0,                                    "Face width for coding")
   ("CodingFaceHeight",                           m_iCodingFaceHeight,                 0,                                    "Face height for coding")
   ("FaceSizeAlignment",                          m_faceSizeAlignment,                 4,                                    "Unit size for alignment, 0: minimal CU size")
+  ("GeoConvertThreads",                          m_iGeoConvertThreads,                0,                                    "Worker threads filtering the rows of the input projection conversion, 0: convert on the encoder thread")
+  ("MetricThreads",                              m_iMetricThreads,                    0,                                    "Worker threads calculating the enabled 360 metrics of a picture concurrently, 0: one after the other on the encoder thread")
   ("InternalChromaFormat,-intercf",              ctx.tmpInternalChromaFormat,             0,                                    "InternalChromaFormatIDC (400|420|422|444 or set 0 (default) for same as OutputChromaFormat)")
   ("InterpolationMethodY,-interpY",              m_inputGeoParam.iInterp[CHANNEL_TYPE_LUMA],   (Int)SI_LANCZOS3,            "Interpolation method for luma, 0: default setting(lanczos3); 1:NN, 2: bilinear, 3: bicubic, 4: lanczos2, 5: lanczos3")
   ("InterpolationMethodC,-interpC",              m_inputGeoParam.iInterp[CHANNEL_TYPE_CHROMA], (Int)SI_LANCZOS2,            "Interpolation method for chroma, 0: default setting(lanczos2); 1:NN, 2: bilinear, 3: bicubic, 4: lanczos2, 5: lanczos3")
@@ -2062,6 +2064,8 @@ Bool TExt360AppEncCfg::verifyParameters()
   if(m_bSVideo)
   {
     xConfirmPara(m_faceSizeAlignment<0, "FaceSizeAlignment must be no less than 0");
+    xConfirmPara(m_iGeoConvertThreads<0, "GeoConvertThreads must be no less than 0");
+    xConfirmPara(m_iMetricThreads<0, "MetricThreads must be no less than 0");
     //check source;
     if(   m_sourceSVideoInfo.geoType == SVIDEO_EQUIRECT 
 #if SVIDEO_ADJUSTED_EQUALAREA
@@ -62,6 +62,8 @@ protected:
   Int       m_iCodingFaceWidth;
   Int       m_iCodingFaceHeight;
   Int       m_faceSizeAlignment;
+  Int       m_iGeoConvertThreads;                             ///< worker threads filtering the rows of the projection conversion;
+  Int       m_iMetricThreads;                                 ///< worker threads calculating the 360 metrics of a picture;
   InputGeoParam m_inputGeoParam;
 #if SVIDEO_VIEWPORT_PSNR
   ViewPortPSNRParam m_viewPortPSNRParam;
@@ -36,6 +36,7 @@
 #include "../App/EncoderApp/EncAppCfg.h"
 #include "TExt360EncGop.h"
 #include "EncoderLib/EncGOP.h"
+#include "CommonLib/ThreadPool.h"
 
 TExt360AppEncTop::TExt360AppEncTop(EncAppCfg &cfg, TExt360EncGop &ext360Gop, EncGOP &encGop, PelStorage &yuvOrig)
   : m_cfg(cfg)
@@ -46,6 +47,7 @@ TExt360AppEncTop::TExt360AppEncTop(EncAppCfg &cfg, TExt360EncGop &ext360Gop, Enc
   , m_picYuvRot()
   , m_pcInputGeomtry(nullptr)
   , m_pcCodingGeomtry(nullptr)
+  , m_pcGeoConvertThreadPool(nullptr)
 {
   if(m_bDirectFPConvert)
   {
@@ -74,6 +76,11 @@ Void TExt360AppEncTop::xDestroy()
 
   m_picYuvReadFromFile.destroy();
   m_picYuvRot.destroy();
+  if(m_pcGeoConvertThreadPool)
+  {
+    delete m_pcGeoConvertThreadPool;
+    m_pcGeoConvertThreadPool=nullptr;
+  }
   if(m_pcInputGeomtry)
   {
     delete m_pcInputGeomtry;
@@ -139,6 +146,13 @@ Void TExt360AppEncTop::xCreate(EncGOP &encGop, PelStorage &yuvOrig)
     m_pcInputGeomtry  = TGeometry::create(extCfg.m_sourceSVideoInfo, &extCfg.m_inputGeoParam);
     m_pcCodingGeomtry = TGeometry::create(extCfg.m_codingSVideoInfo, &extCfg.m_inputGeoParam);
 #endif
+    if(!m_bGeoConvertSkip && extCfg.m_iGeoConvertThreads > 0)
+    {
+      m_pcGeoConvertThreadPool = new ThreadPool(extCfg.m_iGeoConvertThreads);
+      m_pcInputGeomtry->setThreadPool(m_pcGeoConvertThreadPool);
+      m_pcCodingGeomtry->setThreadPool(m_pcGeoConvertThreadPool);
+    }
+    m_ext360EncGop.setMetricThreads(extCfg.m_iMetricThreads);
 #if SVIDEO_E2E_METRICS
     m_ext360EncGop.initE2EMetricsCalc(extCfg.m_sourceSVideoInfo, extCfg.m_codingSVideoInfo, &extCfg.m_inputGeoParam, m_cTVideoIOYuvInputFile4E2EMetrics, cfg.m_InputChromaFormatIDC, cfg.m_inputFileWidth, cfg.m_inputFileHeight, cfg.m_temporalSubsampleRatio);
 #endif
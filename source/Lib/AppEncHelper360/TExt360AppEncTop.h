@@ -55,6 +55,7 @@ class TExt360AppEncTop
   PelStorage     m_picYuvRot;           ///< adjust to frame packed video to normal sphere video;
   TGeometry     *m_pcInputGeomtry;
   TGeometry     *m_pcCodingGeomtry;
+  ThreadPool    *m_pcGeoConvertThreadPool;  ///< filters the rows of the conversion of both geometries if GeoConvertThreads > 0;
 
 #if SVIDEO_E2E_METRICS
   VideoIOYuv                m_cTVideoIOYuvInputFile4E2EMetrics;       ///< input YUV file for end to end metrics calculation;
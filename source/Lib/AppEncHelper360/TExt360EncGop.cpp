@@ -34,6 +34,7 @@
 #include "AppEncHelper360/TExt360EncGop.h"
 #include "EncoderLib/Analyze.h"
 #include "EncoderLib/EncGOP.h"
+#include "CommonLib/ThreadPool.h"
 #if SVIDEO_HEX_PSNR_SUPPORT
 #include <cinttypes>
 #endif
@@ -41,6 +42,7 @@
 
 TExt360EncGop::TExt360EncGop()
 {
+  m_pcMetricThreadPool = nullptr;
 #if SVIDEO_E2E_METRICS
   m_pcTVideoIOYuvInputFile = nullptr;
   m_pcOrgPicYuv = nullptr;
@@ -54,6 +56,11 @@ TExt360EncGop::TExt360EncGop()
 
 TExt360EncGop::~TExt360EncGop()
 {
+  if(m_pcMetricThreadPool)
+  {
+    delete m_pcMetricThreadPool;
+    m_pcMetricThreadPool = nullptr;
+  }
 #if SVIDEO_E2E_METRICS
   if(m_pRefGeometry)
   {
@@ -87,19 +94,27 @@ Void TExt360EncGop::calculatePSNRs(Picture *pcPic)
   readOrigPicYuv(pcPic->getPOC());
   reconstructPicYuv(recPicYuv);
 #endif
+  // each metric has its own tables and geometries and only reads the pictures
+  auto runMetric = [this](const std::function<void()> &calculate) {
+    if(m_pcMetricThreadPool)
+      m_pcMetricThreadPool->addTask(calculate);
+    else
+      calculate();
+  };
+
 #if SVIDEO_SPSNR_NN
   if(getSPSNRMetric()->getSPSNREnabled())
   {
 #if SVIDEO_E2E_METRICS
-    getSPSNRMetric()->xCalculateSPSNR(*getOrigPicYuv(), *getRecPicYuv());
+    runMetric([&] { getSPSNRMetric()->xCalculateSPSNR(*getOrigPicYuv(), *getRecPicYuv()); });
 #else
-    getSPSNRMetric()->xCalculateSPSNR(orgPicYuv, recPicYuv);
+    runMetric([&] { getSPSNRMetric()->xCalculateSPSNR(orgPicYuv, recPicYuv); });
 #endif
   }
 #if SVIDEO_CODEC_SPSNR_NN
   if(getCodecSPSNRMetric()->getSPSNREnabled())
   {
-    getCodecSPSNRMetric()->xCalculateSPSNR(orgPicYuv, recPicYuv);
+    runMetric([&] { getCodecSPSNRMetric()->xCalculateSPSNR(orgPicYuv, recPicYuv); });
   }
 #endif
 #endif
@@ -109,7 +124,7 @@ Void TExt360EncGop::calculatePSNRs(Picture *pcPic)
 #if SVIDEO_HEMI_PROJECTIONS
     if (!((Int)(m_pRecGeometry->getType()) == SVIDEO_HCMP || (Int)(m_pRecGeometry->getType()) == SVIDEO_HEAC))
 #endif
-    getWSPSNRMetric()->xCalculateWSPSNR(&orgPicYuv, &recPicYuv);
+    runMetric([&] { getWSPSNRMetric()->xCalculateWSPSNR(&orgPicYuv, &recPicYuv); });
   }
 #if SVIDEO_WSPSNR_E2E
   if(getE2EWSPSNRMetric()->getWSPSNREnabled())
@@ -119,9 +134,9 @@ Void TExt360EncGop::calculatePSNRs(Picture *pcPic)
 #endif
 
 #if SVIDEO_E2E_METRICS
-    getE2EWSPSNRMetric()->xCalculateE2EWSPSNR(getRecPicYuv(),  getOrigPicYuv());
+    runMetric([&] { getE2EWSPSNRMetric()->xCalculateE2EWSPSNR(getRecPicYuv(),  getOrigPicYuv()); });
 #else
-    getE2EWSPSNRMetric()->xCalculateE2EWSPSNR(&recPicYuv, pcPic->getPOC());
+    runMetric([&] { getE2EWSPSNRMetric()->xCalculateE2EWSPSNR(&recPicYuv, pcPic->getPOC()); });
 #endif
   }
 #endif
@@ -130,9 +145,9 @@ Void TExt360EncGop::calculatePSNRs(Picture *pcPic)
   if(getSPSNRIMetric()->getSPSNRIEnabled())
   {
 #if SVIDEO_E2E_METRICS
-    getSPSNRIMetric()->xCalculateSPSNRI(getOrigPicYuv(), getRecPicYuv());
+    runMetric([&] { getSPSNRIMetric()->xCalculateSPSNRI(getOrigPicYuv(), getRecPicYuv()); });
 #else
-    getSPSNRIMetric()->xCalculateSPSNRI(&orgPicYuv, &recPicYuv);
+    runMetric([&] { getSPSNRIMetric()->xCalculateSPSNRI(&orgPicYuv, &recPicYuv); });
 #endif
   }
 #endif
@@ -140,9 +155,9 @@ Void TExt360EncGop::calculatePSNRs(Picture *pcPic)
   if(getCPPPSNRMetric()->getCPPPSNREnabled())
   {
 #if SVIDEO_E2E_METRICS
-    getCPPPSNRMetric()->xCalculateCPPPSNR(getOrigPicYuv(), getRecPicYuv());
+    runMetric([&] { getCPPPSNRMetric()->xCalculateCPPPSNR(getOrigPicYuv(), getRecPicYuv()); });
 #else
-    getCPPPSNRMetric()->xCalculateCPPPSNR(&orgPicYuv, &recPicYuv);
+    runMetric([&] { getCPPPSNRMetric()->xCalculateCPPPSNR(&orgPicYuv, &recPicYuv); });
 #endif
   }
 #endif
@@ -150,39 +165,57 @@ Void TExt360EncGop::calculatePSNRs(Picture *pcPic)
   if(getViewPortPSNRMetric()->isEnabled())
   {
 #if SVIDEO_E2E_METRICS
-    getViewPortPSNRMetric()->xCalculatePSNR(pcPic, getOrigPicYuv());
+    runMetric([&] { getViewPortPSNRMetric()->xCalculatePSNR(pcPic, getOrigPicYuv()); });
 #else
-    getViewPortPSNRMetric()->xCalculatePSNR(pcPic);
+    runMetric([&] { getViewPortPSNRMetric()->xCalculatePSNR(pcPic); });
 #endif
   }
 #endif
 #if SVIDEO_DYNAMIC_VIEWPORT_PSNR
   if(getDynamicViewPortPSNRMetric()->isEnabled())
   {
-    getDynamicViewPortPSNRMetric()->xCalculateDynamicViewPSNR(pcPic, getOrigPicYuv());
+    runMetric([&] { getDynamicViewPortPSNRMetric()->xCalculateDynamicViewPSNR(pcPic, getOrigPicYuv()); });
   }
 #endif
 #if SVIDEO_CF_SPSNR_NN
   if(getCFSPSNRMetric()->getSPSNREnabled())
   { 
-    getCFSPSNRMetric()->xCalculateCFSPSNR(getOrigPicYuv(), &recPicYuv);
+    runMetric([&] { getCFSPSNRMetric()->xCalculateCFSPSNR(getOrigPicYuv(), &recPicYuv); });
   }
 #endif
 #if SVIDEO_CF_SPSNR_I
   if(getCFSPSNRIMetric()->getSPSNRIEnabled())
   { 
-    getCFSPSNRIMetric()->xCalculateSPSNRI(getOrigPicYuv(), &recPicYuv);
+    runMetric([&] { getCFSPSNRIMetric()->xCalculateSPSNRI(getOrigPicYuv(), &recPicYuv); });
   }
 #endif
 #if SVIDEO_CF_CPPPSNR
   if(getCFCPPPSNRMetric()->getCPPPSNREnabled())
   { 
-    getCFCPPPSNRMetric()->xCalculateCPPPSNR(getOrigPicYuv(), &recPicYuv);
+    runMetric([&] { getCFCPPPSNRMetric()->xCalculateCPPPSNR(getOrigPicYuv(), &recPicYuv); });
   }
 #endif
+
+  if(m_pcMetricThreadPool)
+  {
+    m_pcMetricThreadPool->waitForAll();
+  }
 }
 
 
+Void TExt360EncGop::setMetricThreads(Int iNumThreads)
+{
+  if(m_pcMetricThreadPool)
+  {
+    delete m_pcMetricThreadPool;
+    m_pcMetricThreadPool = nullptr;
+  }
+  if(iNumThreads > 0)
+  {
+    m_pcMetricThreadPool = new ThreadPool(iNumThreads);
+  }
+}
+
 Void TExt360EncGop::addResult(Analyze &encAnalyze)
 {
   TExt360EncAnalyze &ext360EncAnalyze=encAnalyze.getExt360Info();
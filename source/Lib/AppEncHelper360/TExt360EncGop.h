@@ -65,6 +65,7 @@ public:
   virtual ~TExt360EncGop();
 
   Void calculatePSNRs(Picture *pcPic); // Picture should be constant.
+  Void setMetricThreads(Int iNumThreads);  // 0: calculate the metrics one after the other on the encoder thread;
   Void addResult(Analyze &encAnalyze);
 #if SVIDEO_HEX_PSNR_SUPPORT
   Void printPsnr(MsgLevel level, bool printHexPsnr, const char *name, Double *dPsnr);
@@ -74,6 +75,7 @@ public:
 #endif
 
 private:
+  ThreadPool  *m_pcMetricThreadPool;     //calculates the enabled metrics of a picture concurrently;
 
 #if SVIDEO_E2E_METRICS
   VideoIOYuv *m_pcTVideoIOYuvInputFile;  //note: reference;
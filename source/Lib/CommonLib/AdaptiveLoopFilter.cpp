@@ -422,10 +422,6 @@ void AdaptiveLoopFilter::ALFProcess(CodingStructure& cs)
   const PreCalcValues& pcv = *cs.pcv;
 
   int ctuIdx = 0;
-  bool clipTop = false, clipBottom = false, clipLeft = false, clipRight = false;
-  int numHorVirBndry = 0, numVerVirBndry = 0;
-  int horVirBndryPos[] = { 0, 0, 0 };
-  int verVirBndryPos[] = { 0, 0, 0 };
 
   for( int yPos = 0; yPos < pcv.lumaHeight; yPos += pcv.maxCUHeight )
   {
@@ -451,121 +447,163 @@ void AdaptiveLoopFilter::ALFProcess(CodingStructure& cs)
       }
       lastSliceIdx = cu->slice->getSliceID();
 
-      const int width = ( xPos + pcv.maxCUWidth > pcv.lumaWidth ) ? ( pcv.lumaWidth - xPos ) : pcv.maxCUWidth;
-      const int height = ( yPos + pcv.maxCUHeight > pcv.lumaHeight ) ? ( pcv.lumaHeight - yPos ) : pcv.maxCUHeight;
-      bool ctuEnableFlag = m_ctuEnableFlag[COMPONENT_Y][ctuIdx];
-      for( int compIdx = 1; compIdx < MAX_NUM_COMPONENT; compIdx++ )
-      {
-        ctuEnableFlag |= m_ctuEnableFlag[compIdx][ctuIdx] > 0;
-        if (cu->slice->m_ccAlfFilterParam.ccAlfFilterEnabled[compIdx - 1])
-        {
-          ctuEnableFlag |= m_ccAlfFilterControl[compIdx - 1][ctuIdx] > 0;
-        }
-      }
-      int rasterSliceAlfPad = 0;
-      if( ctuEnableFlag && isCrossedByVirtualBoundaries( cs, xPos, yPos, width, height, clipTop, clipBottom, clipLeft, clipRight, numHorVirBndry, numVerVirBndry, horVirBndryPos, verVirBndryPos, rasterSliceAlfPad ) )
-      {
-        int yStart = yPos;
-        for( int i = 0; i <= numHorVirBndry; i++ )
-        {
-          const int yEnd = i == numHorVirBndry ? yPos + height : horVirBndryPos[i];
-          const int h = yEnd - yStart;
-          const bool clipT = ( i == 0 && clipTop ) || ( i > 0 ) || ( yStart == 0 );
-          const bool clipB = ( i == numHorVirBndry && clipBottom ) || ( i < numHorVirBndry ) || ( yEnd == pcv.lumaHeight );
-          int xStart = xPos;
-          for( int j = 0; j <= numVerVirBndry; j++ )
-          {
-            const int xEnd = j == numVerVirBndry ? xPos + width : verVirBndryPos[j];
-            const int w = xEnd - xStart;
-            const bool clipL = ( j == 0 && clipLeft ) || ( j > 0 ) || ( xStart == 0 );
-            const bool clipR = ( j == numVerVirBndry && clipRight ) || ( j < numVerVirBndry ) || ( xEnd == pcv.lumaWidth );
-            const int wBuf = w + (clipL ? 0 : MAX_ALF_PADDING_SIZE) + (clipR ? 0 : MAX_ALF_PADDING_SIZE);
-            const int hBuf = h + (clipT ? 0 : MAX_ALF_PADDING_SIZE) + (clipB ? 0 : MAX_ALF_PADDING_SIZE);
-            PelUnitBuf buf = m_tempBuf2.subBuf( UnitArea( cs.area.chromaFormat, Area( 0, 0, wBuf, hBuf ) ) );
-            buf.copyFrom( tmpYuv.subBuf( UnitArea( cs.area.chromaFormat, Area( xStart - (clipL ? 0 : MAX_ALF_PADDING_SIZE), yStart - (clipT ? 0 : MAX_ALF_PADDING_SIZE), wBuf, hBuf ) ) ) );
-            // pad top-left unavailable samples for raster slice
-            if ( xStart == xPos && yStart == yPos && ( rasterSliceAlfPad & 1 ) )
-            {
-              buf.padBorderPel( MAX_ALF_PADDING_SIZE, 1 );
-            }
+      xFilterCtu( cs, *cu, xPos, yPos, ctuIdx, alfCtuFilterIndex, recYuv, tmpYuv );
+      ctuIdx++;
+    }
+  }
+}
 
-            // pad bottom-right unavailable samples for raster slice
-            if ( xEnd == xPos + width && yEnd == yPos + height && ( rasterSliceAlfPad & 2 ) )
-            {
-              buf.padBorderPel( MAX_ALF_PADDING_SIZE, 2 );
-            }
-            buf.extendBorderPel( MAX_ALF_PADDING_SIZE );
-            buf = buf.subBuf( UnitArea ( cs.area.chromaFormat, Area( clipL ? 0 : MAX_ALF_PADDING_SIZE, clipT ? 0 : MAX_ALF_PADDING_SIZE, w, h ) ) );
+/** ALF of one CTU row, for the loop filters that run on the CTU rows of the picture behind the reconstruction.
+    The SAO output of a row is kept in m_tempBuf until the row below has been filtered, so each call only copies the
+    row below ctuRow (and row 0 at the start of the picture). Unlike ALFProcess(), cs.slice is left unchanged; the
+    coefficients are reloaded at the start of the row and at each slice change.
+ */
+void AdaptiveLoopFilter::ALFProcessCtuRow(CodingStructure& cs, const int ctuRow)
+{
+  const PreCalcValues& pcv = *cs.pcv;
 
-            if( m_ctuEnableFlag[COMPONENT_Y][ctuIdx] )
-            {
-              const Area blkSrc( 0, 0, w, h );
-              const Area blkDst( xStart, yStart, w, h );
-              deriveClassification( m_classifier, buf.get(COMPONENT_Y), blkDst, blkSrc );
-              short filterSetIndex = alfCtuFilterIndex[ctuIdx];
-              short *coeff;
-              Pel *clip;
-              if (filterSetIndex >= NUM_FIXED_FILTER_SETS)
-              {
-                coeff = m_coeffApsLuma[filterSetIndex - NUM_FIXED_FILTER_SETS];
-                clip = m_clippApsLuma[filterSetIndex - NUM_FIXED_FILTER_SETS];
-              }
-              else
-              {
-                coeff = m_fixedFilterSetCoeffDec[filterSetIndex];
-                clip = m_clipDefault;
-              }
-              m_filter7x7Blk(m_classifier, recYuv, buf, blkDst, blkSrc, COMPONENT_Y, coeff, clip, m_clpRngs.comp[COMPONENT_Y], cs
-                , m_alfVBLumaCTUHeight
-                , m_alfVBLumaPos
-              );
-            }
+  // set clipping range
+  m_clpRngs = cs.slice->getClpRngs();
 
-            for( int compIdx = 1; compIdx < MAX_NUM_COMPONENT; compIdx++ )
-            {
-              ComponentID compID = ComponentID( compIdx );
-              const int chromaScaleX = getComponentScaleX( compID, tmpYuv.chromaFormat );
-              const int chromaScaleY = getComponentScaleY( compID, tmpYuv.chromaFormat );
+  // set CTU enable flags
+  for( int compIdx = 0; compIdx < MAX_NUM_COMPONENT; compIdx++ )
+  {
+    m_ctuEnableFlag[compIdx] = cs.picture->getAlfCtuEnableFlag( compIdx );
+    m_ctuAlternative[compIdx] = cs.picture->getAlfCtuAlternativeData( compIdx );
+  }
+  const short* alfCtuFilterIndex = cs.picture->getAlfCtbFilterIndex();
+  const Slice* lastSlice = nullptr;
 
-              if( m_ctuEnableFlag[compIdx][ctuIdx] )
-              {
-                const Area blkSrc( 0, 0, w >> chromaScaleX, h >> chromaScaleY );
-                const Area blkDst( xStart >> chromaScaleX, yStart >> chromaScaleY, w >> chromaScaleX, h >> chromaScaleY );
-                uint8_t alt_num = m_ctuAlternative[compIdx][ctuIdx];
-                m_filter5x5Blk(m_classifier, recYuv, buf, blkDst, blkSrc, compID, m_chromaCoeffFinal[alt_num], m_chromaClippFinal[alt_num], m_clpRngs.comp[compIdx], cs
-                  , m_alfVBChmaCTUHeight
-                   , m_alfVBChmaPos );
-              }
-              if (cu->slice->m_ccAlfFilterParam.ccAlfFilterEnabled[compIdx - 1])
-              {
-                const int filterIdx = m_ccAlfFilterControl[compIdx - 1][ctuIdx];
+  const int copyBegin = ctuRow == 0 ? 0 : ctuRow + 1;
+  const int copyEnd   = std::min<int>( ctuRow + 2, pcv.heightInCtus );
+  if( copyBegin < copyEnd )
+  {
+    xCopyCtuRows( cs, copyBegin, copyEnd );
+  }
 
-                if (filterIdx != 0)
-                {
-                  const Area blkSrc(0, 0, w, h);
-                  Area blkDst(xStart >> chromaScaleX, yStart >> chromaScaleY, w >> chromaScaleX, h >> chromaScaleY);
+  PelUnitBuf recYuv = cs.getRecoBuf();
+  PelUnitBuf tmpYuv = m_tempBuf.getBuf( cs.area );
 
-                  const int16_t *filterCoeff = m_ccAlfFilterParam.ccAlfCoeff[compIdx - 1][filterIdx - 1];
+  const int yPos = ctuRow * pcv.maxCUHeight;
+  int ctuIdx = ctuRow * pcv.widthInCtus;
+  for( int xPos = 0; xPos < pcv.lumaWidth; xPos += pcv.maxCUWidth, ctuIdx++ )
+  {
+    const CodingUnit *cu = cs.getCU( Position(xPos, yPos), CHANNEL_TYPE_LUMA );
 
-                  m_filterCcAlf(recYuv.get(compID), buf, blkDst, blkSrc, compID, filterCoeff, m_clpRngs, cs,
-                                m_alfVBLumaCTUHeight, m_alfVBLumaPos);
-                }
-              }
-            }
+    if (!cu->slice->getAlfEnabledFlag(COMPONENT_Y) && !cu->slice->getAlfEnabledFlag(COMPONENT_Cb) && !cu->slice->getAlfEnabledFlag(COMPONENT_Cr))
+    {
+      continue;
+    }
 
-            xStart = xEnd;
-          }
+    if( cu->slice != lastSlice )
+    {
+      reconstructCoeffAPSs(*cu->slice, true, cu->slice->getAlfEnabledFlag(COMPONENT_Cb) || cu->slice->getAlfEnabledFlag(COMPONENT_Cr), false);
+      m_ccAlfFilterParam = cu->slice->m_ccAlfFilterParam;
+      lastSlice = cu->slice;
+    }
 
-          yStart = yEnd;
-        }
+    xFilterCtu( cs, *cu, xPos, yPos, ctuIdx, alfCtuFilterIndex, recYuv, tmpYuv );
+  }
+}
+
+/** Copy the CTU rows [rowBegin, rowEnd) of the reconstruction to m_tempBuf and extend them across the picture
+    borders, as ALFProcess() extends the copy of the whole picture.
+ */
+void AdaptiveLoopFilter::xCopyCtuRows(CodingStructure& cs, const int rowBegin, const int rowEnd)
+{
+  const PreCalcValues& pcv = *cs.pcv;
+  const int      margin = MAX_ALF_FILTER_LENGTH >> 1;
+  const int      yBegin = rowBegin * pcv.maxCUHeight;
+  const int      yEnd   = std::min<int>( rowEnd * pcv.maxCUHeight, pcv.lumaHeight );
+  const UnitArea rows( cs.area.chromaFormat, Area( 0, yBegin, pcv.lumaWidth, yEnd - yBegin ) );
+
+  PelUnitBuf rowBuf = m_tempBuf.getBuf( rows );
+  rowBuf.copyFrom( cs.getRecoBuf( rows ) );
+
+  for( int compIdx = 0; compIdx < getNumberValidComponents( cs.area.chromaFormat ); compIdx++ )
+  {
+    const ComponentID compID = ComponentID( compIdx );
+    rowBuf.get( compID ).extendBorderPel( margin, 0 );
+
+    PelBuf picBuf = m_tempBuf.getBuf( cs.area.block( compID ) );
+    const size_t lineSize = sizeof( Pel ) * ( picBuf.width + 2 * margin );
+    if( rowBegin == 0 )
+    {
+      for( int y = 1; y <= margin; y++ )
+      {
+        ::memcpy( picBuf.bufAt( -margin, -y ), picBuf.bufAt( -margin, 0 ), lineSize );
       }
-      else
+    }
+    if( rowEnd == pcv.heightInCtus )
+    {
+      for( int y = 1; y <= margin; y++ )
       {
-        const UnitArea area( cs.area.chromaFormat, Area( xPos, yPos, width, height ) );
+        ::memcpy( picBuf.bufAt( -margin, picBuf.height - 1 + y ), picBuf.bufAt( -margin, picBuf.height - 1 ), lineSize );
+      }
+    }
+  }
+}
+
+void AdaptiveLoopFilter::xFilterCtu(CodingStructure& cs, const CodingUnit& cu, const int xPos, const int yPos, const int ctuIdx,
+                                    const short* alfCtuFilterIndex, PelUnitBuf& recYuv, PelUnitBuf& tmpYuv)
+{
+  const PreCalcValues& pcv = *cs.pcv;
+  bool clipTop = false, clipBottom = false, clipLeft = false, clipRight = false;
+  int numHorVirBndry = 0, numVerVirBndry = 0;
+  int horVirBndryPos[] = { 0, 0, 0 };
+  int verVirBndryPos[] = { 0, 0, 0 };
+
+  const int width = ( xPos + pcv.maxCUWidth > pcv.lumaWidth ) ? ( pcv.lumaWidth - xPos ) : pcv.maxCUWidth;
+  const int height = ( yPos + pcv.maxCUHeight > pcv.lumaHeight ) ? ( pcv.lumaHeight - yPos ) : pcv.maxCUHeight;
+  bool ctuEnableFlag = m_ctuEnableFlag[COMPONENT_Y][ctuIdx];
+  for( int compIdx = 1; compIdx < MAX_NUM_COMPONENT; compIdx++ )
+  {
+    ctuEnableFlag |= m_ctuEnableFlag[compIdx][ctuIdx] > 0;
+    if (cu.slice->m_ccAlfFilterParam.ccAlfFilterEnabled[compIdx - 1])
+    {
+      ctuEnableFlag |= m_ccAlfFilterControl[compIdx - 1][ctuIdx] > 0;
+    }
+  }
+  int rasterSliceAlfPad = 0;
+  if( ctuEnableFlag && isCrossedByVirtualBoundaries( cs, xPos, yPos, width, height, clipTop, clipBottom, clipLeft, clipRight, numHorVirBndry, numVerVirBndry, horVirBndryPos, verVirBndryPos, rasterSliceAlfPad ) )
+  {
+    int yStart = yPos;
+    for( int i = 0; i <= numHorVirBndry; i++ )
+    {
+      const int yEnd = i == numHorVirBndry ? yPos + height : horVirBndryPos[i];
+      const int h = yEnd - yStart;
+      const bool clipT = ( i == 0 && clipTop ) || ( i > 0 ) || ( yStart == 0 );
+      const bool clipB = ( i == numHorVirBndry && clipBottom ) || ( i < numHorVirBndry ) || ( yEnd == pcv.lumaHeight );
+      int xStart = xPos;
+      for( int j = 0; j <= numVerVirBndry; j++ )
+      {
+        const int xEnd = j == numVerVirBndry ? xPos + width : verVirBndryPos[j];
+        const int w = xEnd - xStart;
+        const bool clipL = ( j == 0 && clipLeft ) || ( j > 0 ) || ( xStart == 0 );
+        const bool clipR = ( j == numVerVirBndry && clipRight ) || ( j < numVerVirBndry ) || ( xEnd == pcv.lumaWidth );
+        const int wBuf = w + (clipL ? 0 : MAX_ALF_PADDING_SIZE) + (clipR ? 0 : MAX_ALF_PADDING_SIZE);
+        const int hBuf = h + (clipT ? 0 : MAX_ALF_PADDING_SIZE) + (clipB ? 0 : MAX_ALF_PADDING_SIZE);
+        PelUnitBuf buf = m_tempBuf2.subBuf( UnitArea( cs.area.chromaFormat, Area( 0, 0, wBuf, hBuf ) ) );
+        buf.copyFrom( tmpYuv.subBuf( UnitArea( cs.area.chromaFormat, Area( xStart - (clipL ? 0 : MAX_ALF_PADDING_SIZE), yStart - (clipT ? 0 : MAX_ALF_PADDING_SIZE), wBuf, hBuf ) ) ) );
+        // pad top-left unavailable samples for raster slice
+        if ( xStart == xPos && yStart == yPos && ( rasterSliceAlfPad & 1 ) )
+        {
+          buf.padBorderPel( MAX_ALF_PADDING_SIZE, 1 );
+        }
+
+        // pad bottom-right unavailable samples for raster slice
+        if ( xEnd == xPos + width && yEnd == yPos + height && ( rasterSliceAlfPad & 2 ) )
+        {
+          buf.padBorderPel( MAX_ALF_PADDING_SIZE, 2 );
+        }
+        buf.extendBorderPel( MAX_ALF_PADDING_SIZE );
+        buf = buf.subBuf( UnitArea ( cs.area.chromaFormat, Area( clipL ? 0 : MAX_ALF_PADDING_SIZE, clipT ? 0 : MAX_ALF_PADDING_SIZE, w, h ) ) );
+
         if( m_ctuEnableFlag[COMPONENT_Y][ctuIdx] )
         {
-          Area blk( xPos, yPos, width, height );
-          deriveClassification( m_classifier, tmpYuv.get( COMPONENT_Y ), blk, blk );
+          const Area blkSrc( 0, 0, w, h );
+          const Area blkDst( xStart, yStart, w, h );
+          deriveClassification( m_classifier, buf.get(COMPONENT_Y), blkDst, blkSrc );
           short filterSetIndex = alfCtuFilterIndex[ctuIdx];
           short *coeff;
           Pel *clip;
@@ -579,8 +617,10 @@ void AdaptiveLoopFilter::ALFProcess(CodingStructure& cs)
             coeff = m_fixedFilterSetCoeffDec[filterSetIndex];
             clip = m_clipDefault;
           }
-          m_filter7x7Blk(m_classifier, recYuv, tmpYuv, blk, blk, COMPONENT_Y, coeff, clip, m_clpRngs.comp[COMPONENT_Y],
-                         cs, m_alfVBLumaCTUHeight, m_alfVBLumaPos);
+          m_filter7x7Blk(m_classifier, recYuv, buf, blkDst, blkSrc, COMPONENT_Y, coeff, clip, m_clpRngs.comp[COMPONENT_Y], cs
+            , m_alfVBLumaCTUHeight
+            , m_alfVBLumaPos
+          );
         }
 
         for( int compIdx = 1; compIdx < MAX_NUM_COMPONENT; compIdx++ )
@@ -589,47 +629,111 @@ void AdaptiveLoopFilter::ALFProcess(CodingStructure& cs)
           const int chromaScaleX = getComponentScaleX( compID, tmpYuv.chromaFormat );
           const int chromaScaleY = getComponentScaleY( compID, tmpYuv.chromaFormat );
 
-          if (m_ctuEnableFlag[compIdx][ctuIdx])
+          if( m_ctuEnableFlag[compIdx][ctuIdx] )
           {
-            Area    blk(xPos >> chromaScaleX, yPos >> chromaScaleY, width >> chromaScaleX, height >> chromaScaleY);
+            const Area blkSrc( 0, 0, w >> chromaScaleX, h >> chromaScaleY );
+            const Area blkDst( xStart >> chromaScaleX, yStart >> chromaScaleY, w >> chromaScaleX, h >> chromaScaleY );
             uint8_t alt_num = m_ctuAlternative[compIdx][ctuIdx];
-            m_filter5x5Blk(m_classifier, recYuv, tmpYuv, blk, blk, compID, m_chromaCoeffFinal[alt_num],
-                           m_chromaClippFinal[alt_num], m_clpRngs.comp[compIdx], cs, m_alfVBChmaCTUHeight,
-                           m_alfVBChmaPos);
+            m_filter5x5Blk(m_classifier, recYuv, buf, blkDst, blkSrc, compID, m_chromaCoeffFinal[alt_num], m_chromaClippFinal[alt_num], m_clpRngs.comp[compIdx], cs
+              , m_alfVBChmaCTUHeight
+               , m_alfVBChmaPos );
           }
-          if (cu->slice->m_ccAlfFilterParam.ccAlfFilterEnabled[compIdx - 1])
+          if (cu.slice->m_ccAlfFilterParam.ccAlfFilterEnabled[compIdx - 1])
           {
             const int filterIdx = m_ccAlfFilterControl[compIdx - 1][ctuIdx];
 
             if (filterIdx != 0)
             {
-              Area blkDst(xPos >> chromaScaleX, yPos >> chromaScaleY, width >> chromaScaleX, height >> chromaScaleY);
-              Area blkSrc(xPos, yPos, width, height);
+              const Area blkSrc(0, 0, w, h);
+              Area blkDst(xStart >> chromaScaleX, yStart >> chromaScaleY, w >> chromaScaleX, h >> chromaScaleY);
 
               const int16_t *filterCoeff = m_ccAlfFilterParam.ccAlfCoeff[compIdx - 1][filterIdx - 1];
 
-              m_filterCcAlf(recYuv.get(compID), tmpYuv, blkDst, blkSrc, compID, filterCoeff, m_clpRngs, cs,
+              m_filterCcAlf(recYuv.get(compID), buf, blkDst, blkSrc, compID, filterCoeff, m_clpRngs, cs,
                             m_alfVBLumaCTUHeight, m_alfVBLumaPos);
             }
           }
         }
+
+        xStart = xEnd;
+      }
+
+      yStart = yEnd;
+    }
+  }
+  else
+  {
+    const UnitArea area( cs.area.chromaFormat, Area( xPos, yPos, width, height ) );
+    if( m_ctuEnableFlag[COMPONENT_Y][ctuIdx] )
+    {
+      Area blk( xPos, yPos, width, height );
+      deriveClassification( m_classifier, tmpYuv.get( COMPONENT_Y ), blk, blk );
+      short filterSetIndex = alfCtuFilterIndex[ctuIdx];
+      short *coeff;
+      Pel *clip;
+      if (filterSetIndex >= NUM_FIXED_FILTER_SETS)
+      {
+        coeff = m_coeffApsLuma[filterSetIndex - NUM_FIXED_FILTER_SETS];
+        clip = m_clippApsLuma[filterSetIndex - NUM_FIXED_FILTER_SETS];
+      }
+      else
+      {
+        coeff = m_fixedFilterSetCoeffDec[filterSetIndex];
+        clip = m_clipDefault;
+      }
+      m_filter7x7Blk(m_classifier, recYuv, tmpYuv, blk, blk, COMPONENT_Y, coeff, clip, m_clpRngs.comp[COMPONENT_Y],
+                     cs, m_alfVBLumaCTUHeight, m_alfVBLumaPos);
+    }
+
+    for( int compIdx = 1; compIdx < MAX_NUM_COMPONENT; compIdx++ )
+    {
+      ComponentID compID = ComponentID( compIdx );
+      const int chromaScaleX = getComponentScaleX( compID, tmpYuv.chromaFormat );
+      const int chromaScaleY = getComponentScaleY( compID, tmpYuv.chromaFormat );
+
+      if (m_ctuEnableFlag[compIdx][ctuIdx])
+      {
+        Area    blk(xPos >> chromaScaleX, yPos >> chromaScaleY, width >> chromaScaleX, height >> chromaScaleY);
+        uint8_t alt_num = m_ctuAlternative[compIdx][ctuIdx];
+        m_filter5x5Blk(m_classifier, recYuv, tmpYuv, blk, blk, compID, m_chromaCoeffFinal[alt_num],
+                       m_chromaClippFinal[alt_num], m_clpRngs.comp[compIdx], cs, m_alfVBChmaCTUHeight,
+                       m_alfVBChmaPos);
+      }
+      if (cu.slice->m_ccAlfFilterParam.ccAlfFilterEnabled[compIdx - 1])
+      {
+        const int filterIdx = m_ccAlfFilterControl[compIdx - 1][ctuIdx];
+
+        if (filterIdx != 0)
+        {
+          Area blkDst(xPos >> chromaScaleX, yPos >> chromaScaleY, width >> chromaScaleX, height >> chromaScaleY);
+          Area blkSrc(xPos, yPos, width, height);
+
+          const int16_t *filterCoeff = m_ccAlfFilterParam.ccAlfCoeff[compIdx - 1][filterIdx - 1];
+
+          m_filterCcAlf(recYuv.get(compID), tmpYuv, blkDst, blkSrc, compID, filterCoeff, m_clpRngs, cs,
+                        m_alfVBLumaCTUHeight, m_alfVBLumaPos);
+        }
       }
-      ctuIdx++;
     }
   }
 }
 
 void AdaptiveLoopFilter::reconstructCoeffAPSs(CodingStructure& cs, bool luma, bool chroma, bool isRdo)
+{
+  reconstructCoeffAPSs(*cs.slice, luma, chroma, isRdo);
+}
+
+void AdaptiveLoopFilter::reconstructCoeffAPSs(Slice& slice, bool luma, bool chroma, bool isRdo)
 {
   //luma
-  APS** aps = cs.slice->getAlfAPSs();
+  APS** aps = slice.getAlfAPSs();
   AlfParam alfParamTmp;
   APS* curAPS;
   if (luma)
   {
-    for (int i = 0; i < cs.slice->getNumAlfApsIdsLuma(); i++)
+    for (int i = 0; i < slice.getNumAlfApsIdsLuma(); i++)
     {
-      int apsIdx = cs.slice->getAlfApsIdsLuma()[i];
+      int apsIdx = slice.getAlfApsIdsLuma()[i];
       curAPS = aps[apsIdx];
       CHECK(curAPS == nullptr, "invalid APS");
       alfParamTmp = curAPS->getAlfAPSParam();
@@ -642,7 +746,7 @@ void AdaptiveLoopFilter::reconstructCoeffAPSs(CodingStructure& cs, bool luma, bo
   //chroma
   if (chroma)
   {
-    int apsIdxChroma = cs.slice->getAlfApsIdChroma();
+    int apsIdxChroma = slice.getAlfApsIdChroma();
     curAPS = aps[apsIdxChroma];
     m_alfParamChroma = &curAPS->getAlfAPSParam();
     alfParamTmp = *m_alfParamChroma;
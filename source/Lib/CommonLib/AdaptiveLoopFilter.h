@@ -83,8 +83,11 @@ public:
   AdaptiveLoopFilter();
   virtual ~AdaptiveLoopFilter() {}
   void reconstructCoeffAPSs(CodingStructure& cs, bool luma, bool chroma, bool isRdo);
+  void reconstructCoeffAPSs(Slice& slice, bool luma, bool chroma, bool isRdo);
   void reconstructCoeff(AlfParam& alfParam, ChannelType channel, const bool isRdo, const bool isRedo = false);
   void ALFProcess(CodingStructure& cs);
+  /// ALF of CTU row ctuRow, the rows must be filtered in order and SAO must have finished up to row ctuRow + 1
+  void ALFProcessCtuRow(CodingStructure& cs, const int ctuRow);
   void create( const int picWidth, const int picHeight, const ChromaFormat format, const int maxCUWidth, const int maxCUHeight, const int maxCUDepth, const int inputBitDepth[MAX_NUM_CHANNEL_TYPE] );
   void destroy();
   static void deriveClassificationBlk(AlfClassifier **classifier, int **laplacian[NUM_DIRECTIONS],
@@ -130,6 +133,9 @@ public:
 #endif
 
 protected:
+  void xCopyCtuRows(CodingStructure& cs, const int rowBegin, const int rowEnd);
+  void xFilterCtu(CodingStructure& cs, const CodingUnit& cu, const int xPos, const int yPos, const int ctuIdx,
+                  const short* alfCtuFilterIndex, PelUnitBuf& recYuv, PelUnitBuf& tmpYuv);
   bool isCrossedByVirtualBoundaries( const CodingStructure& cs, const int xPos, const int yPos, const int width, const int height, bool& clipTop, bool& clipBottom, bool& clipLeft, bool& clipRight, int& numHorVirBndry, int& numVerVirBndry, int horVirBndryPos[], int verVirBndryPos[], int& rasterSliceAlfPad );
   static constexpr int   m_scaleBits = 7; // 8-bits
   CcAlfFilterParam       m_ccAlfFilterParam;
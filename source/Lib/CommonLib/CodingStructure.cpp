@@ -940,6 +940,56 @@ void CodingStructure::clearCuPuTuIdxMap( const UnitArea &_area, uint32_t numCu,
   }
 }
 
+template<typename T>
+static void sortUnitsByCtu( std::vector<T*> &units, const PreCalcValues &pcv, std::vector<unsigned> &newIdx )
+{
+  auto ctuAddr = [&pcv]( const T *unit )
+  {
+    const Position pos = unit->blocks[unit->chType].lumaPos();
+    return ( pos.y >> pcv.maxCUHeightLog2 ) * pcv.widthInCtus + ( pos.x >> pcv.maxCUWidthLog2 );
+  };
+  // stable, the units of one CTU keep the order in which they were added
+  std::stable_sort( units.begin(), units.end(), [&ctuAddr]( const T *a, const T *b ) { return ctuAddr( a ) < ctuAddr( b ); } );
+
+  newIdx.assign( units.size() + 1, 0 );
+  for( unsigned i = 0; i < units.size(); i++ )
+  {
+    newIdx[units[i]->idx] = i + 1;
+    units[i]->idx         = i + 1;
+  }
+}
+
+static void remapUnitIdx( unsigned *idxMap, size_t size, const std::vector<unsigned> &newIdx )
+{
+  for( size_t n = 0; n < size; n++ )
+  {
+    idxMap[n] = newIdx[idxMap[n]];
+  }
+}
+
+void CodingStructure::sortUnitsInCtuOrder()
+{
+  std::vector<unsigned> newCuIdx, newPuIdx, newTuIdx;
+  sortUnitsByCtu( cus, *pcv, newCuIdx );
+  sortUnitsByCtu( pus, *pcv, newPuIdx );
+  sortUnitsByCtu( tus, *pcv, newTuIdx );
+
+  const uint32_t numCh = ::getNumberValidChannels( area.chromaFormat );
+  for( uint32_t i = 0; i < numCh; i++ )
+  {
+    const size_t size = unitScale[i].scale( area.blocks[i].size() ).area();
+    remapUnitIdx( m_cuIdx[i], size, newCuIdx );
+    remapUnitIdx( m_puIdx[i], size, newPuIdx );
+    remapUnitIdx( m_tuIdx[i], size, newTuIdx );
+  }
+
+  // the PU and TU chains do not leave their CU, only the CU chain runs through the picture
+  for( size_t i = 0; i < cus.size(); i++ )
+  {
+    cus[i]->next = i + 1 < cus.size() ? cus[i + 1] : nullptr;
+  }
+}
+
 CodingUnit* CodingStructure::getLumaCU( const Position &pos )
 {
   const ChannelType effChType = CHANNEL_TYPE_LUMA;
@@ -2291,7 +2341,10 @@ PelBuf CodingStructure::getBuf( const CompArea &blk, const PictureType &type )
   if( !parent && ( type == PIC_RESIDUAL || type == PIC_PREDICTION ) )
   {
     cFinal.x &= ( pcv->maxCUWidthMask  >> getComponentScaleX( blk.compID, blk.chromaFormat ) );
-    cFinal.y &= ( pcv->maxCUHeightMask >> getComponentScaleY( blk.compID, blk.chromaFormat ) );
+    if( !picture || !picture->getCtuRowTempBuffers() )
+    {
+      cFinal.y &= ( pcv->maxCUHeightMask >> getComponentScaleY( blk.compID, blk.chromaFormat ) );
+    }
   }
 #endif
 
@@ -2325,7 +2378,10 @@ const CPelBuf CodingStructure::getBuf( const CompArea &blk, const PictureType &t
   if( !parent && ( type == PIC_RESIDUAL || type == PIC_PREDICTION ) )
   {
     cFinal.x &= ( pcv->maxCUWidthMask  >> getComponentScaleX( blk.compID, blk.chromaFormat ) );
-    cFinal.y &= ( pcv->maxCUHeightMask >> getComponentScaleY( blk.compID, blk.chromaFormat ) );
+    if( !picture || !picture->getCtuRowTempBuffers() )
+    {
+      cFinal.y &= ( pcv->maxCUHeightMask >> getComponentScaleY( blk.compID, blk.chromaFormat ) );
+    }
   }
 #endif
 
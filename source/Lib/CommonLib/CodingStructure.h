@@ -220,6 +220,8 @@ public:
     pArray[0] = m_numCUs;     pArray[1] = m_numPUs;     pArray[2] = m_numTUs;
     pArray[3] = m_offsets[0]; pArray[4] = m_offsets[1]; pArray[5] = m_offsets[2];
   }
+  /// bring the units into CTU raster order, e.g. after the CTUs were added out of order by concurrent CTU rows
+  void sortUnitsInCtuOrder();
 
 
 private:
@@ -232,6 +234,10 @@ public:
   std::vector< TransformUnit*> tus;
 
   LutMotionCand motionLut;
+  std::vector<LutMotionCand> ctuRowMotionLuts;   ///< HMVP tables of the CTU rows reconstructed concurrently by the decoder, empty otherwise
+
+  LutMotionCand&       getMotionLut( const Position& pos )       { return ctuRowMotionLuts.empty() ? motionLut : ctuRowMotionLuts[pos.y >> pcv->maxCUHeightLog2]; }
+  const LutMotionCand& getMotionLut( const Position& pos ) const { return ctuRowMotionLuts.empty() ? motionLut : ctuRowMotionLuts[pos.y >> pcv->maxCUHeightLog2]; }
 
   void addMiToLut(static_vector<MotionInfo, MAX_NUM_HMVP_CANDS>& lut, const MotionInfo &mi);
 
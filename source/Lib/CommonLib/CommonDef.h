@@ -147,6 +147,7 @@ static constexpr int NOT_VALID =                                       -1;
 static constexpr int AMVP_MAX_NUM_CANDS =                               2; ///< AMVP: advanced motion vector prediction - max number of final candidates
 static constexpr int AMVP_MAX_NUM_CANDS_MEM =                           3; ///< AMVP: advanced motion vector prediction - max number of candidates
 static constexpr int AMVP_DECIMATION_FACTOR =                           2;
+static constexpr int COL_MOTION_LOG2_SIZE =                             3; ///< log2 size of the blocks of the compressed motion field used by TMVP
 static constexpr int MRG_MAX_NUM_CANDS =                                6; ///< MERGE
 static constexpr int AFFINE_MRG_MAX_NUM_CANDS =                         5; ///< AFFINE MERGE
 static constexpr int IBC_MRG_MAX_NUM_CANDS =                            6; ///< IBC MERGE
@@ -440,6 +441,30 @@ static constexpr int SBT_NUM_RDO =                                      2; ///<
 
 static constexpr int EPIPOLE_PRECISION_FIXED              = 24;
 static constexpr int CALIBRATED_PROJECTION_MAX_NUM_COEFFS = 16;
+static constexpr int GED_ROTATED_SPHERE_CACHE_SIZE        = 4; ///< maximum number of epipoles with cached frame-wide rotated spherical coordinate planes
+static constexpr int GED_COORDINATE_ARENA_PLANES          = 16; ///< number of preallocated coordinate planes for allocation-free motion vector reprojection
+static constexpr int GED_EQUIVALENT_MV_MEMO_SIZE          = 16; ///< maximum number of memorized equivalent motion vectors per block for candidate derivation
+static constexpr int GED_FIXED_POINT_BITS                 = 30; ///< fractional bits of unit vectors, rotations and trigonometric values of the fixed point geodesic motion model
+static constexpr int GED_FIXED_POINT_POSITION_BITS        = 16; ///< fractional bits of sample positions of the fixed point geodesic motion model
+static constexpr int GED_CYLINDER_SHIFT_BITS              = 22; ///< fractional bits of the cylinder shift of the fixed point geodesic motion model
+static constexpr int GED_TRIG_TABLE_BITS                  = 10; ///< log2 of the number of intervals of the sin (quarter wave) and atan tables of the fixed point geodesic motion model
+static constexpr int GED_TRIG_TABLE_SIZE                  = 1 << GED_TRIG_TABLE_BITS;
+static constexpr int GED_DMVR_WINDOW_MARGIN               = 4; ///< margin of the reprojected projected-DMVR search window, a multiple of the subblock size and at least DMVR_NUM_ITERATION
+static constexpr int GED_SEED_SEARCH_RANGE                = 8; ///< integer search range around the equivalent CLASSIC mv in the seeded GEODESIC motion search
+static constexpr int GED_FAST_DECISION_MIN_PASSES         = 64; ///< GEODESIC passes of a picture before its GED selection rate is used by the GED fast mode decision
+static constexpr int GED_FAST_DECISION_MV_THRESHOLD[3]    = { 0, 4, 16 }; ///< GED fast mode decision per preset: GEODESIC is skipped below this CLASSIC mv magnitude (1/16 luma sample)
+static constexpr int GED_FAST_DECISION_RATE_SHIFT[3]      = { 0, 5, 3 }; ///< GED fast mode decision per preset: GEODESIC is skipped if it is selected in less than 2^-shift of the passes of the picture
+static constexpr int GED_FAST_SEARCH_NUM_SAMPLES          = 5; ///< number of 4x4 subblocks (corners and center) of the subsampled cost estimate of the GED fast integer search
+static constexpr int GED_FAST_SEARCH_MIN_SUBBLOCKS        = 16; ///< minimum number of 4x4 subblocks of a block for the subsampled cost estimate of the GED fast integer search
+static constexpr int GED_FAST_SEARCH_MARGIN_SHIFT         = 2; ///< candidates with an estimated cost above best + (best >> shift) are pruned in the GED fast integer search
+static constexpr int EPIPOLE_ESTIMATION_BLOCK_SIZE        = 16; ///< block size of the motion field of the epipole estimation, in samples of the pyramid level
+static constexpr int EPIPOLE_ESTIMATION_SEARCH_RANGE      = 8; ///< full search range of the epipole estimation on the coarsest pyramid level
+static constexpr int EPIPOLE_ESTIMATION_REFINE_RANGE      = 2; ///< search range of the epipole estimation around the motion of the coarser pyramid level
+static constexpr int EPIPOLE_ESTIMATION_MAX_LEVELS        = 4; ///< maximum number of pyramid levels of the epipole estimation, including the full resolution
+static constexpr int EPIPOLE_ESTIMATION_MIN_LEVEL_HEIGHT  = 128; ///< minimum height of a subsampled pyramid level of the epipole estimation
+static constexpr int EPIPOLE_ESTIMATION_MIN_BLOCKS        = 16; ///< minimum number of textured moving blocks for an epipole estimate
+static constexpr int EPIPOLE_ESTIMATION_FIT_ITERATIONS    = 5; ///< reweighting iterations of the robust epipole fit
+static constexpr double EPIPOLE_ESTIMATION_MIN_EIGENVALUE_RATIO = 4.0; ///< minimum ratio of the two smallest eigenvalues of the epipole fit for a distinct epipole
 
 static constexpr int NUM_INTER_CU_INFO_SAVE =                           8; ///< maximum number of inter cu information saved for fast algorithm
 static constexpr int LDT_MODE_TYPE_INHERIT =                            0; ///< No need to signal mode_constraint_flag, and the modeType of the region is inherited from its parent node
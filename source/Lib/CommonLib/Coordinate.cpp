@@ -60,6 +60,13 @@ ArrayXXTCoordPtrTriple CoordinateConversion::sphericalToCartesian(ArrayXXTCoordP
   return {cart3DX, cart3DY, cart3DZ};
 }
 
+void CoordinateConversion::cartesianToSpherical(const ArrayXXTCoordMap &cart3DX, const ArrayXXTCoordMap &cart3DY, const ArrayXXTCoordMap &cart3DZ,
+                                                ArrayXXTCoordMap &sphericalR, ArrayXXTCoordMap &sphericalTheta, ArrayXXTCoordMap &sphericalPhi) {
+  sphericalR = (cart3DX.square() + cart3DY.square() + cart3DZ.square()).sqrt();
+  sphericalTheta = (cart3DZ / sphericalR).cwiseMin(1).cwiseMax(-1).acos();
+  sphericalPhi = cart3DX.binaryExpr(cart3DY, [](TCoord x, TCoord y) { return TCoord(std::atan2(y, x)); });
+}
+
 Array3TCoord CoordinateConversion::sphericalToCartesian(const Array3TCoord &spherical) {
   const TCoord cart3DX = spherical.coeff(0) * std::sin(spherical.coeff(1)) * std::cos(spherical.coeff(2));
   const TCoord cart3DY = spherical.coeff(0) * std::sin(spherical.coeff(1)) * std::sin(spherical.coeff(2));
@@ -67,6 +74,75 @@ Array3TCoord CoordinateConversion::sphericalToCartesian(const Array3TCoord &sphe
   return {cart3DX, cart3DY, cart3DZ};
 }
 
+void CoordinateConversion::sphericalToCartesian(const ArrayXXTCoordMap &sphericalR, const ArrayXXTCoordMap &sphericalTheta, const ArrayXXTCoordMap &sphericalPhi,
+                                                ArrayXXTCoordMap &cart3DX, ArrayXXTCoordMap &cart3DY, ArrayXXTCoordMap &cart3DZ) {
+  cart3DX = sphericalR * sphericalTheta.sin() * sphericalPhi.cos();
+  cart3DY = sphericalR * sphericalTheta.sin() * sphericalPhi.sin();
+  cart3DZ = sphericalR * sphericalTheta.cos();
+}
+
+Epipole::Epipole(const Array3TCoord &cartesian): cartesian(cartesian) {
+  // Calculate rotation matrix to rotate default north pole (0, 0, 1) to desired north pole using
+  // rodrigues rotation formula
+  const auto polarAxisNormalized =
+    cartesian / std::sqrt((cartesian.x() * cartesian.x() + cartesian.y() * cartesian.y() + cartesian.z() * cartesian.z()));
+  const auto cart3DCross = Array3TCoord(-polarAxisNormalized.y(), polarAxisNormalized.x(), 0);
+  const auto s = std::sqrt(cart3DCross.x() * cart3DCross.x() + cart3DCross.y() * cart3DCross.y() + cart3DCross.z() * cart3DCross.z());
+  if (s == 0) {  // epipole is parallel to current north pole.
+    rotation = Eigen::Matrix<TCoord, 3, 3>::Identity();
+    if (polarAxisNormalized.z() < 0) {
+      rotation(2, 2) = -1;
+    }
+  } else {
+    const auto c = std::max(TCoord(-1), std::min(TCoord(1), polarAxisNormalized.z()));
+    auto cart3DCrossSkew = Eigen::Matrix<TCoord, 3, 3>::Zero().eval();
+    cart3DCrossSkew(0, 1) = -cart3DCross.z();
+    cart3DCrossSkew(0, 2) = cart3DCross.y();
+    cart3DCrossSkew(1, 0) = cart3DCross.z();
+    cart3DCrossSkew(1, 2) = -cart3DCross.x();
+    cart3DCrossSkew(2, 0) = -cart3DCross.y();
+    cart3DCrossSkew(2, 1) = cart3DCross.x();
+    rotation = Eigen::Matrix<TCoord, 3, 3>::Identity() + cart3DCrossSkew + (cart3DCrossSkew*cart3DCrossSkew) * ((1-c) / (s*s));
+    rotation.transposeInPlace();
+  }
+  inverseRotation = rotation.transpose();
+  setFixedRotationIdentity();
+}
+
+void Epipole::setFixedRotationIdentity() {
+  for (int row = 0; row < 3; row++) {
+    for (int col = 0; col < 3; col++) {
+      fixedRotation[row][col] = row == col ? 1 << GED_FIXED_POINT_BITS : 0;
+    }
+  }
+}
+
+void CoordinateArena::create(int numPlanes, Eigen::Index maxNumElements) {
+  m_planes.assign(numPlanes, ArrayXTCoord(maxNumElements));
+  m_numAcquired = 0;
+  m_stacked[0].resize(3, maxNumElements);
+  m_stacked[1].resize(3, maxNumElements);
+}
+
+void CoordinateArena::destroy() {
+  m_planes.clear();
+  m_numAcquired = 0;
+  m_stacked[0].resize(3, 0);
+  m_stacked[1].resize(3, 0);
+}
+
+ArrayXXTCoordMap CoordinateArena::acquire(Eigen::Index rows, Eigen::Index cols) {
+  CHECK(m_numAcquired >= m_planes.size(), "Coordinate arena exhausted.");
+  ArrayXTCoord &plane = m_planes[m_numAcquired++];
+  CHECK(rows * cols > plane.size(), "Coordinate arena plane too small.");
+  return ArrayXXTCoordMap(plane.data(), rows, cols);
+}
+
+Eigen::Map<Eigen::Matrix<TCoord, 3, Eigen::Dynamic>> CoordinateArena::stacked(int idx, Eigen::Index numElements) {
+  CHECK(numElements > m_stacked[idx].cols(), "Coordinate arena stack too small.");
+  return Eigen::Map<Eigen::Matrix<TCoord, 3, Eigen::Dynamic>>(m_stacked[idx].data(), 3, numElements);
+}
+
 TCoord FloatingFixedConversion::fixedToFloating(int fixed, int precision) {
   return TCoord(fixed >> precision) + TCoord(fixed & ((1 << precision) - 1))/TCoord(1 << precision);
 }
@@ -6,6 +6,7 @@
 
 #include <memory>
 #include <iostream>
+#include <vector>
 #include "Common.h"
 #include "CommonDef.h"
 #include "Eigen/Dense"
@@ -19,6 +20,7 @@ typedef Eigen::Array<TCoord, Eigen::Dynamic, Eigen::Dynamic> ArrayXXTCoord;
 typedef std::shared_ptr<ArrayXXTCoord> ArrayXXTCoordPtr;
 typedef std::pair<ArrayXXTCoordPtr, ArrayXXTCoordPtr> ArrayXXTCoordPtrPair;
 typedef std::tuple<ArrayXXTCoordPtr, ArrayXXTCoordPtr, ArrayXXTCoordPtr> ArrayXXTCoordPtrTriple;
+typedef Eigen::Map<ArrayXXTCoord> ArrayXXTCoordMap;
 
 typedef Eigen::Array<bool, Eigen::Dynamic, Eigen::Dynamic> ArrayXXBool;
 typedef std::shared_ptr<ArrayXXBool> ArrayXXBoolPtr;
@@ -28,6 +30,56 @@ typedef Eigen::Array<int, 1, 2> Array2Fixed;
 typedef Eigen::ArrayXXi ArrayXXFixed;
 typedef std::shared_ptr<ArrayXXFixed> ArrayXXFixedPtr;
 typedef std::pair<ArrayXXFixedPtr, ArrayXXFixedPtr> ArrayXXFixedPtrPair;
+typedef Eigen::Map<const ArrayXXFixed> ArrayXXFixedConstMap;
+typedef std::pair<ArrayXXFixedConstMap, ArrayXXFixedConstMap> ArrayXXFixedConstMapPair;
+
+
+/// Epipole on the unit sphere with the precomputed rotation of the default north pole (0, 0, 1) onto it.
+struct Epipole {
+  Array3TCoord cartesian;                                      ///< Cartesian epipole
+  Eigen::Matrix<TCoord, 3, 3> rotation;                        ///< Rotation to the sphere with the epipole as north pole
+  Eigen::Matrix<TCoord, 3, 3, Eigen::RowMajor> inverseRotation; ///< Transpose of rotation, stored row-major (same layout as rotation.transpose())
+  int fixedRotation[3][3];                                     ///< Integer rotation with GED_FIXED_POINT_BITS fractional bits (GeodesicFixedPoint)
+
+  Epipole(): cartesian(0, 0, 1), rotation(Eigen::Matrix<TCoord, 3, 3>::Identity()), inverseRotation(rotation.transpose()) { setFixedRotationIdentity(); }
+  explicit Epipole(const Array3TCoord &cartesian);
+
+  void setFixedRotationIdentity();
+};
+
+
+/// Preallocated coordinate planes for allocation-free coordinate processing.
+/// Planes are handed out in stack order and returned when the enclosing Scope ends.
+class CoordinateArena {
+public:
+  CoordinateArena(): m_numAcquired(0) {}
+
+  void create(int numPlanes, Eigen::Index maxNumElements);
+  void destroy();
+  bool isCreated() const { return !m_planes.empty(); }
+
+  /// Contiguous view with the given dimensions on the next free plane.
+  ArrayXXTCoordMap acquire(Eigen::Index rows, Eigen::Index cols);
+
+  /// Stacked 3xN cartesian coordinates for matrix multiplication (idx 0: input, idx 1: output).
+  Eigen::Map<Eigen::Matrix<TCoord, 3, Eigen::Dynamic>> stacked(int idx, Eigen::Index numElements);
+
+  /// Returns all planes acquired within its lifetime to the arena.
+  class Scope {
+  public:
+    explicit Scope(CoordinateArena &arena): m_arena(arena), m_numAcquired(arena.m_numAcquired) {}
+    ~Scope() { m_arena.m_numAcquired = m_numAcquired; }
+
+  private:
+    CoordinateArena &m_arena;
+    const size_t m_numAcquired;
+  };
+
+protected:
+  std::vector<ArrayXTCoord> m_planes;
+  size_t m_numAcquired;
+  Eigen::Matrix<TCoord, 3, Eigen::Dynamic> m_stacked[2];
+};
 
 
 /// Coordinate conversion namespace
@@ -44,10 +96,39 @@ namespace CoordinateConversion {
   /// Transform cartesian coordinates to spherical coordinates.
   ArrayXXTCoordPtrTriple cartesianToSpherical(ArrayXXTCoordPtrTriple cart3D);
   Array3TCoord cartesianToSpherical(const Array3TCoord &cart3D);
+  /// In-place variant, output planes must not alias input planes.
+  void cartesianToSpherical(const ArrayXXTCoordMap &cart3DX, const ArrayXXTCoordMap &cart3DY, const ArrayXXTCoordMap &cart3DZ,
+                            ArrayXXTCoordMap &sphericalR, ArrayXXTCoordMap &sphericalTheta, ArrayXXTCoordMap &sphericalPhi);
 
   /// Transform spherical coordinates to cartesian coordinates.
   ArrayXXTCoordPtrTriple sphericalToCartesian(ArrayXXTCoordPtrTriple spherical);
   Array3TCoord sphericalToCartesian(const Array3TCoord &spherical);
+  /// In-place variant, output planes must not alias input planes.
+  void sphericalToCartesian(const ArrayXXTCoordMap &sphericalR, const ArrayXXTCoordMap &sphericalTheta, const ArrayXXTCoordMap &sphericalPhi,
+                            ArrayXXTCoordMap &cart3DX, ArrayXXTCoordMap &cart3DY, ArrayXXTCoordMap &cart3DZ);
+
+  /// Multiply the stacked cartesian planes with a 3x3 matrix (expression) in-place.
+  template<typename MatrixType>
+  void rotate(const MatrixType &matrix, ArrayXXTCoordMap &cart3DX, ArrayXXTCoordMap &cart3DY, ArrayXXTCoordMap &cart3DZ,
+              CoordinateArena &arena)
+  {
+    const auto N = cart3DX.size();
+
+    // Flatten and stack
+    auto cart3DFlatStacked = arena.stacked(0, N);
+    cart3DFlatStacked.row(0) = Eigen::Map<const ArrayXTCoord>(cart3DX.data(), N).matrix();
+    cart3DFlatStacked.row(1) = Eigen::Map<const ArrayXTCoord>(cart3DY.data(), N).matrix();
+    cart3DFlatStacked.row(2) = Eigen::Map<const ArrayXTCoord>(cart3DZ.data(), N).matrix();
+
+    // Apply matrix
+    auto cart3DRotFlatStacked = arena.stacked(1, N);
+    cart3DRotFlatStacked.noalias() = matrix * cart3DFlatStacked;
+
+    // Unstack
+    Eigen::Map<ArrayXTCoord>(cart3DX.data(), N) = cart3DRotFlatStacked.row(0).array();
+    Eigen::Map<ArrayXTCoord>(cart3DY.data(), N) = cart3DRotFlatStacked.row(1).array();
+    Eigen::Map<ArrayXTCoord>(cart3DZ.data(), N) = cart3DRotFlatStacked.row(2).array();
+  }
 }
 
 
@@ -171,33 +171,7 @@ void DeblockingFilter::deblockingFilterPic( CodingStructure& cs
   {
     for( int x = 0; x < pcv.widthInCtus; x++ )
     {
-      memset( m_aapucBS       [EDGE_VER].data(), 0,     m_aapucBS       [EDGE_VER].byte_size() );
-      memset( m_aapbEdgeFilter[EDGE_VER].data(), false, m_aapbEdgeFilter[EDGE_VER].byte_size() );
-      clearFilterLengthAndTransformEdge();
-      m_ctuXLumaSamples = x << pcv.maxCUWidthLog2;
-      m_ctuYLumaSamples = y << pcv.maxCUHeightLog2;
-
-      const UnitArea ctuArea( pcv.chrFormat, Area( x << pcv.maxCUWidthLog2, y << pcv.maxCUHeightLog2, pcv.maxCUWidth, pcv.maxCUWidth ) );
-      CodingUnit* firstCU = cs.getCU( ctuArea.lumaPos(), CH_L);
-      cs.slice = firstCU->slice;
-
-      // CU-based deblocking
-      for( auto &currCU : cs.traverseCUs( CS::getArea( cs, ctuArea, CH_L ), CH_L ) )
-      {
-        xDeblockCU( currCU, EDGE_VER );
-      }
-
-      if( CS::isDualITree( cs ) )
-      {
-        memset( m_aapucBS       [EDGE_VER].data(), 0,     m_aapucBS       [EDGE_VER].byte_size() );
-        memset( m_aapbEdgeFilter[EDGE_VER].data(), false, m_aapbEdgeFilter[EDGE_VER].byte_size() );
-        clearFilterLengthAndTransformEdge();
-
-        for( auto &currCU : cs.traverseCUs( CS::getArea( cs, ctuArea, CH_C ), CH_C ) )
-        {
-          xDeblockCU( currCU, EDGE_VER );
-        }
-      }
+      xDeblockCtu( cs, x, y, EDGE_VER );
     }
   }
 
@@ -206,36 +180,13 @@ void DeblockingFilter::deblockingFilterPic( CodingStructure& cs
   {
     for( int x = 0; x < pcv.widthInCtus; x++ )
     {
-      memset( m_aapucBS       [EDGE_HOR].data(), 0,     m_aapucBS       [EDGE_HOR].byte_size() );
-      memset( m_aapbEdgeFilter[EDGE_HOR].data(), false, m_aapbEdgeFilter[EDGE_HOR].byte_size() );
-      clearFilterLengthAndTransformEdge();
-      m_ctuXLumaSamples = x << pcv.maxCUWidthLog2;
-      m_ctuYLumaSamples = y << pcv.maxCUHeightLog2;
-
-      const UnitArea ctuArea( pcv.chrFormat, Area( x << pcv.maxCUWidthLog2, y << pcv.maxCUHeightLog2, pcv.maxCUWidth, pcv.maxCUWidth ) );
-      CodingUnit* firstCU = cs.getCU( ctuArea.lumaPos(), CH_L);
-      cs.slice = firstCU->slice;
-
-      // CU-based deblocking
-      for( auto &currCU : cs.traverseCUs( CS::getArea( cs, ctuArea, CH_L ), CH_L ) )
-      {
-        xDeblockCU( currCU, EDGE_HOR );
-      }
-
-      if( CS::isDualITree( cs ) )
-      {
-        memset( m_aapucBS       [EDGE_HOR].data(), 0,     m_aapucBS       [EDGE_HOR].byte_size() );
-        memset( m_aapbEdgeFilter[EDGE_HOR].data(), false, m_aapbEdgeFilter[EDGE_HOR].byte_size() );
-        clearFilterLengthAndTransformEdge();
-
-        for( auto &currCU : cs.traverseCUs( CS::getArea( cs, ctuArea, CH_C ), CH_C ) )
-        {
-          xDeblockCU( currCU, EDGE_HOR );
-        }
-      }
+      xDeblockCtu( cs, x, y, EDGE_HOR );
     }
   }
 
+  // the loop filters that follow use the slice of the last CTU
+  cs.slice = cs.getCU( Position( ( pcv.widthInCtus - 1 ) << pcv.maxCUWidthLog2, ( pcv.heightInCtus - 1 ) << pcv.maxCUHeightLog2 ), CH_L )->slice;
+
   DTRACE_PIC_COMP(D_REC_CB_LUMA_LF,   cs, cs.getRecoBuf(), COMPONENT_Y);
   DTRACE_PIC_COMP(D_REC_CB_CHROMA_LF, cs, cs.getRecoBuf(), COMPONENT_Cb);
   DTRACE_PIC_COMP(D_REC_CB_CHROMA_LF, cs, cs.getRecoBuf(), COMPONENT_Cr);
@@ -244,6 +195,29 @@ void DeblockingFilter::deblockingFilterPic( CodingStructure& cs
   DTRACE_CRC( g_trace_ctx, D_CRC, cs, cs.getRecoBuf() );
 }
 
+/**
+ - deblocking of one CTU row, for the loop filters that run on the CTU rows of the picture behind the reconstruction
+ .
+ The vertical edges of the row only modify samples within the row, its horizontal edges also the bottom samples of
+ the row above. Filtering the rows in order thus gives the same result as deblockingFilterPic(), which filters all
+ vertical edges of the picture before the horizontal ones. Unlike deblockingFilterPic(), cs.slice is left unchanged.
+ */
+void DeblockingFilter::deblockingFilterCtuRow( CodingStructure& cs, const int y )
+{
+  const PreCalcValues& pcv = *cs.pcv;
+  m_shiftHor = ::getComponentScaleX( COMPONENT_Cb, pcv.chrFormat );
+  m_shiftVer = ::getComponentScaleY( COMPONENT_Cb, pcv.chrFormat );
+
+  for( int x = 0; x < pcv.widthInCtus; x++ )
+  {
+    xDeblockCtu( cs, x, y, EDGE_VER );
+  }
+  for( int x = 0; x < pcv.widthInCtus; x++ )
+  {
+    xDeblockCtu( cs, x, y, EDGE_HOR );
+  }
+}
+
 void DeblockingFilter::resetFilterLengths()
 {
   memset(m_aapucBS[EDGE_VER].data(), 0, m_aapucBS[EDGE_VER].byte_size());
@@ -257,6 +231,44 @@ void DeblockingFilter::resetFilterLengths()
 // Protected member functions
 // ====================================================================================================================
 
+/**
+ Deblocking of the CUs of one CTU along the edges of one direction
+
+ \param cs               the coding structure of the picture
+ \param x, y             the position of the CTU in CTU units
+ \param edgeDir          the direction of the edges to be filtered
+*/
+void DeblockingFilter::xDeblockCtu( CodingStructure& cs, const int x, const int y, const DeblockEdgeDir edgeDir )
+{
+  const PreCalcValues& pcv = *cs.pcv;
+
+  memset( m_aapucBS       [edgeDir].data(), 0,     m_aapucBS       [edgeDir].byte_size() );
+  memset( m_aapbEdgeFilter[edgeDir].data(), false, m_aapbEdgeFilter[edgeDir].byte_size() );
+  clearFilterLengthAndTransformEdge();
+  m_ctuXLumaSamples = x << pcv.maxCUWidthLog2;
+  m_ctuYLumaSamples = y << pcv.maxCUHeightLog2;
+
+  const UnitArea ctuArea( pcv.chrFormat, Area( x << pcv.maxCUWidthLog2, y << pcv.maxCUHeightLog2, pcv.maxCUWidth, pcv.maxCUWidth ) );
+
+  // CU-based deblocking
+  for( auto &currCU : cs.traverseCUs( CS::getArea( cs, ctuArea, CH_L ), CH_L ) )
+  {
+    xDeblockCU( currCU, edgeDir );
+  }
+
+  if( CS::isDualITree( cs ) )
+  {
+    memset( m_aapucBS       [edgeDir].data(), 0,     m_aapucBS       [edgeDir].byte_size() );
+    memset( m_aapbEdgeFilter[edgeDir].data(), false, m_aapbEdgeFilter[edgeDir].byte_size() );
+    clearFilterLengthAndTransformEdge();
+
+    for( auto &currCU : cs.traverseCUs( CS::getArea( cs, ctuArea, CH_C ), CH_C ) )
+    {
+      xDeblockCU( currCU, edgeDir );
+    }
+  }
+}
+
 /**
  Deblocking filter process in CU-based (the same function as conventional's)
 
@@ -995,7 +1007,7 @@ void DeblockingFilter::xEdgeFilterLuma(const CodingUnit &cu, const DeblockEdgeDi
   const Slice   &slice    = *(cu.slice);
   const bool    spsPaletteEnabledFlag          = sps.getPLTMode();
   const int     bitDepthLuma                   = sps.getBitDepth(CHANNEL_TYPE_LUMA);
-  const ClpRng& clpRng( cu.cs->slice->clpRng(COMPONENT_Y) );
+  const ClpRng& clpRng( cu.slice->clpRng(COMPONENT_Y) );
 
   int      qp       = 0;
   unsigned numParts = (((edgeDir == EDGE_VER) ? lumaArea.height / pcv.minCUHeight : lumaArea.width / pcv.minCUWidth));
@@ -1373,7 +1385,7 @@ void DeblockingFilter::xEdgeFilterChroma(const CodingUnit &cu, const DeblockEdge
       {
         if ((bS[chromaIdx] == 2) || (largeBoundary && (bS[chromaIdx] == 1)))
         {
-          const ClpRng &clpRng(cu.cs->slice->clpRng(ComponentID(chromaIdx + 1)));
+          const ClpRng &clpRng(cu.slice->clpRng(ComponentID(chromaIdx + 1)));
           Pel *         tmpSrcChroma = (chromaIdx == 0) ? tmpSrcCb : tmpSrcCr;
 
           const TransformUnit &tuQ = *cuQ.cs->getTU(
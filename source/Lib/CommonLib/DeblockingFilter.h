@@ -81,6 +81,8 @@ private:
 private:
   void clearFilterLengthAndTransformEdge();
 
+  void xDeblockCtu                     ( CodingStructure& cs, const int x, const int y, const DeblockEdgeDir edgeDir );
+
   // set / get functions
   void xSetDeblockingFilterParam        ( const CodingUnit& cu );
 
@@ -142,6 +144,8 @@ public:
 
   /// picture-level deblocking filter
   void deblockingFilterPic        ( CodingStructure& cs );
+  /// deblocking filter of CTU row y, the rows must be filtered in order
+  void deblockingFilterCtuRow     ( CodingStructure& cs, const int y );
 
   static int getBeta              ( const int qp )
   {
@@ -3,6 +3,9 @@
 //
 
 #include "EpipoleList.h"
+#include "GeodesicFixedPoint.h"
+#include "Picture.h"
+#include <algorithm>
 #include <iostream>
 
 void EpipoleList::addEpipole(const Array3TCoord &epipole, const int curPOC, const int refPOC, bool makeAvailable) {
@@ -13,29 +16,50 @@ void EpipoleList::addEpipole(const Array3TCoord &epipole, const int curPOC, cons
 
 Array3TCoord EpipoleList::findEpipole(int curPOC, int refPOC) const
 {
-  const auto epipoleFixedSpherical = findEpipoleFixed(curPOC, refPOC);
+  return findEpipoleEntry(curPOC, refPOC).handle.cartesian;
+}
+
+const Epipole &EpipoleList::findEpipoleHandle(int curPOC, int refPOC) const
+{
+  return findEpipoleEntry(curPOC, refPOC).handle;
+}
+
+Array3TCoord EpipoleList::toCartesian(const Array2Fixed &epipoleFixedSpherical)
+{
   const auto epipoleSpherical = FloatingFixedConversion::fixedToFloating(epipoleFixedSpherical, EPIPOLE_PRECISION_FIXED);
   return CoordinateConversion::sphericalToCartesian({1, epipoleSpherical.coeff(0), epipoleSpherical.coeff(1)});
 }
 
+Epipole EpipoleList::toHandle(const Array2Fixed &epipoleFixedSpherical)
+{
+  Epipole handle(toCartesian(epipoleFixedSpherical));
+  GeodesicFixedPoint::deriveRotation(epipoleFixedSpherical, handle.fixedRotation);
+  return handle;
+}
+
 Array2Fixed EpipoleList::findEpipoleFixed(int curPOC, int refPOC) const
+{
+  return findEpipoleEntry(curPOC, refPOC).epipole;
+}
+
+const EpipoleList::EpipoleEntry &EpipoleList::findEpipoleEntry(int curPOC, int refPOC) const
 {
   // Check if explicit entry for given (curPOC, refPOC) combination exists
   auto iter = m_epipoleMap.find({curPOC, refPOC});
   if (iter != m_epipoleMap.end() && iter->second.isAvailable) {
-    return iter->second.epipole;
+    return iter->second;
   }
 
   // Check if per POC entry for given curPOC exist
   iter = m_epipoleMap.find({curPOC, -1});
   if (iter != m_epipoleMap.end() && iter->second.isAvailable) {
-    return iter->second.epipole;
+    return iter->second;
   }
 
   // Check if global entry exists
   iter = m_epipoleMap.find({-1, -1});
   if (iter != m_epipoleMap.end() && iter->second.isAvailable) {
-    return iter->second.epipole;
+    return iter->second;
   }
 
   CHECK(true, "No epipole for given (curPOC, refPOC) combination (" + std::to_string(curPOC) + ", " + std::to_string(refPOC) + ") found.");
@@ -65,7 +89,7 @@ Array2TCoord EpipoleList::derivePredictorClosest(int curPOC, bool old) const
   Array2Fixed predictors[2] = { globalEpipoleEntry.epipole, globalEpipoleEntry.epipole };
   for (const auto &item : m_epipoleMap)
   {
-    if (!item.second.isAvailable)
+    if (!item.second.isAvailable || item.second.isRetired)
     {
       continue;
     }
@@ -111,10 +135,47 @@ bool EpipoleList::hasEpipole(int curPOC, int refPOC) const
 
 void EpipoleList::makeAvailable(int curPOC)
 {
-  for (auto& iter : m_epipoleMap)
+  // The entries of a POC are adjacent in the map, starting with the lowest reference POC.
+  for (auto iter = m_epipoleMap.lower_bound({curPOC, std::numeric_limits<int>::min()});
+       iter != m_epipoleMap.end() && iter->first.first == curPOC; ++iter)
+  {
+    iter->second.isAvailable = true;
+  }
+}
+
+void EpipoleList::retireUnreferenced(const PicList &picList)
+{
+  std::vector<int> referencedPOCs;
+  for (const Picture *pic: picList)
+  {
+    if (pic->referenced)
+    {
+      referencedPOCs.push_back(pic->getPOC());
+    }
+  }
+
+  // The global epipole and registered epipoles of pictures yet to be coded are kept.
+  for (auto &iter : m_epipoleMap)
+  {
+    if (iter.first.first != -1 && iter.second.isAvailable
+        && std::find(referencedPOCs.begin(), referencedPOCs.end(), iter.first.first) == referencedPOCs.end())
+    {
+      iter.second.isRetired = true;
+    }
+  }
+}
+
+void EpipoleList::eraseRetired()
+{
+  for (auto iter = m_epipoleMap.begin(); iter != m_epipoleMap.end();)
   {
-    if (iter.first.first == curPOC) {
-      iter.second.isAvailable = true;
+    if (iter->second.isRetired)
+    {
+      iter = m_epipoleMap.erase(iter);
+    }
+    else
+    {
+      ++iter;
     }
   }
 }
@@ -126,9 +187,7 @@ void EpipoleList::printSummary() const
     if (iter.first.first == -1 && iter.first.second == -1 && iter.second.epipole.isZero()) {
       continue;
     }
-    const auto epipoleSpherical = FloatingFixedConversion::fixedToFloating(iter.second.epipole, EPIPOLE_PRECISION_FIXED);
-    const auto epipole = CoordinateConversion::sphericalToCartesian({1, epipoleSpherical.coeff(0), epipoleSpherical.coeff(1)});
-    std::cout << iter.first.first << ", " << iter.first.second << ": (" << epipole << ")\n";
+    std::cout << iter.first.first << ", " << iter.first.second << ": (" << iter.second.handle.cartesian << ")\n";
   }
   std::cout << "----- Epipole config -----\n";
 }
@@ -4,11 +4,15 @@
 
 #pragma once
 
+#include <list>
 #include <map>
 #include <utility>
 #include "Coordinate.h"
 #include "Unit.h"
 
+struct Picture;
+typedef std::list<Picture*> PicList;
+
 class EpipoleList
 {
 public:
@@ -26,6 +30,8 @@ public:
 
   void addEpipole(const Array3TCoord &epipole, int curPOC = -1, int refPOC = -1, bool makeAvailable = false);
   Array3TCoord findEpipole(int curPOC, int refPOC) const;
+  /** @brief Epipole with precomputed rotation for (curPOC, refPOC). The reference stays valid until the entry is erased by eraseRetired(). */
+  const Epipole &findEpipoleHandle(int curPOC, int refPOC) const;
   int count() const {
     bool globalIsDefault = m_epipoleMap.at({-1, -1}).epipole.isZero();
     return int(m_epipoleMap.size()) - (globalIsDefault ? 1 : 0);
@@ -44,18 +50,34 @@ public:
   /** @brief Make the epipoles for the current POC available. */
   void makeAvailable(int curPOC);
 
+  /**
+   * @brief Retire the available epipoles of the POCs without a picture marked as used for reference in picList.
+   * Retired epipoles are no longer used for prediction, but stay valid for lookups until eraseRetired().
+   * Called after the reference picture marking of each inter picture, so that encoder and decoder predict alike.
+   */
+  void retireUnreferenced(const PicList &picList);
+  /** @brief Remove the retired epipoles; their handles become invalid. */
+  void eraseRetired();
+
   void printSummary() const;
 
 protected:
   typedef std::pair<int, int> POCHash;
   struct EpipoleEntry {
     Array2Fixed epipole;
+    Epipole handle;  ///< Cartesian epipole and rotation derived from the fixed precision spherical epipole
     bool isAvailable;
+    bool isRetired;  ///< The pictures of the POC are no longer used for reference
 
-    EpipoleEntry(): epipole(0, 0), isAvailable(false) {}
-    explicit EpipoleEntry(Array2Fixed epipole, bool isAvailable = false): epipole(std::move(epipole)), isAvailable(isAvailable) {}
+    EpipoleEntry(): epipole(0, 0), handle(toHandle(epipole)), isAvailable(false), isRetired(false) {}
+    explicit EpipoleEntry(Array2Fixed epipole, bool isAvailable = false): epipole(std::move(epipole)), handle(toHandle(this->epipole)), isAvailable(isAvailable), isRetired(false) {}
   };
 
+  static Array3TCoord toCartesian(const Array2Fixed &epipoleFixedSpherical);
+  /** @brief Epipole with floating point and integer rotation, both derived from the fixed precision spherical epipole. */
+  static Epipole toHandle(const Array2Fixed &epipoleFixedSpherical);
+
+  const EpipoleEntry &findEpipoleEntry(int curPOC, int refPOC) const;
   Array2Fixed findEpipoleFixed(int curPOC, int refPOC) const;
 
   Array2TCoord derivePredictorClosest(int curPOC, bool old = false) const;
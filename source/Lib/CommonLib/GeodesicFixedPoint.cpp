@@ -0,0 +1,399 @@
+//
+// Integer implementation of the geodesic motion model for the equirectangular projection.
+//
+
+#include "GeodesicFixedPoint.h"
+#include "Rom.h"
+
+#include <cmath>
+#include <cstdlib>
+
+static const int64_t FIXED_ONE = int64_t(1) << GED_FIXED_POINT_BITS;
+static const int64_t HALF_TURN = int64_t(1) << 31;
+static const int64_t FULL_TURN = int64_t(1) << 32;
+static const int64_t RADIAN_TO_BINARY_ANGLE = 683565276;  ///< round(2^32 / (2 * pi))
+
+static inline int64_t roundShift(int64_t value, int shift)
+{
+  return shift > 0 ? (value + (int64_t(1) << (shift - 1))) >> shift : value << -shift;
+}
+
+/** Division rounded half away from zero, divisor must be positive */
+static inline int64_t divRound(int64_t dividend, int64_t divisor)
+{
+  return dividend >= 0 ? (dividend + divisor / 2) / divisor : -((-dividend + divisor / 2) / divisor);
+}
+
+static inline uint64_t square(int64_t value)
+{
+  return uint64_t(value) * uint64_t(value);
+}
+
+void GeodesicFixedPoint::init(const Size &resolution, GeodesicMotionModel::Flavor flavor)
+{
+  m_width = resolution.width;
+  m_height = resolution.height;
+  m_flavor = flavor;
+
+  const uint32_t angleResolution = uint32_t(divRound(HALF_TURN, m_height));
+  m_tanAngleResolution = divRound(int64_t(sin(angleResolution)) << GED_FIXED_POINT_BITS, cos(angleResolution));
+}
+
+int GeodesicFixedPoint::sin(uint32_t angle)
+{
+  const int fracBits = 30 - GED_TRIG_TABLE_BITS;
+  const uint32_t quadrant = angle >> 30;
+  uint32_t remainder = angle & ((1u << 30) - 1);
+  if (quadrant & 1) {
+    remainder = (1u << 30) - remainder;
+  }
+  const uint32_t index = remainder >> fracBits;
+  int value = g_gedSinTable[index];
+  if (index < GED_TRIG_TABLE_SIZE) {
+    const int64_t frac = remainder & ((1u << fracBits) - 1);
+    value += int(((g_gedSinTable[index + 1] - g_gedSinTable[index]) * frac) >> fracBits);
+  }
+  return quadrant & 2 ? -value : value;
+}
+
+int64_t GeodesicFixedPoint::atan2(int64_t y, int64_t x)
+{
+  if (x == 0 && y == 0) {
+    return 0;
+  }
+
+  // Reduce to the first octant and interpolate the table at min / max.
+  const int fracBits = 16;
+  const int64_t absX = std::llabs(x);
+  const int64_t absY = std::llabs(y);
+  const bool swapped = absY > absX;
+  const int64_t ratio = ((swapped ? absX : absY) << (GED_TRIG_TABLE_BITS + fracBits)) / (swapped ? absY : absX);
+  const int64_t index = ratio >> fracBits;
+  int64_t angle = g_gedAtanTable[index];
+  if (index < GED_TRIG_TABLE_SIZE) {
+    angle += ((g_gedAtanTable[index + 1] - g_gedAtanTable[index]) * (ratio & ((1 << fracBits) - 1))) >> fracBits;
+  }
+
+  if (swapped) {
+    angle = (HALF_TURN >> 1) - angle;
+  }
+  if (x < 0) {
+    angle = HALF_TURN - angle;
+  }
+  return y < 0 ? -angle : angle;
+}
+
+uint64_t GeodesicFixedPoint::sqrt(uint64_t value)
+{
+  // The estimate is corrected to the exact result, so the rounding of the floating point square root does not matter.
+  const uint64_t maxRoot = 0xFFFFFFFFull;
+  uint64_t root = std::min<uint64_t>(uint64_t(std::sqrt(double(value))), maxRoot);
+  while (root * root > value) {
+    root--;
+  }
+  while (root < maxRoot && (root + 1) * (root + 1) <= value) {
+    root++;
+  }
+  return root;
+}
+
+void GeodesicFixedPoint::deriveRotation(const Array2Fixed &epipoleSpherical, int rotation[3][3])
+{
+  const uint32_t theta = uint32_t(roundShift(int64_t(epipoleSpherical.coeff(0)) * RADIAN_TO_BINARY_ANGLE, EPIPOLE_PRECISION_FIXED));
+  const uint32_t phi = uint32_t(roundShift(int64_t(epipoleSpherical.coeff(1)) * RADIAN_TO_BINARY_ANGLE, EPIPOLE_PRECISION_FIXED));
+  Vector epipole = { roundShift(int64_t(sin(theta)) * cos(phi), GED_FIXED_POINT_BITS),
+                     roundShift(int64_t(sin(theta)) * sin(phi), GED_FIXED_POINT_BITS),
+                     cos(theta) };
+  const int64_t norm = int64_t(sqrt(square(epipole.x) + square(epipole.y) + square(epipole.z)));
+  epipole = { divRound(epipole.x << GED_FIXED_POINT_BITS, norm), divRound(epipole.y << GED_FIXED_POINT_BITS, norm),
+              divRound(epipole.z << GED_FIXED_POINT_BITS, norm) };
+
+  for (int row = 0; row < 3; row++) {
+    for (int col = 0; col < 3; col++) {
+      rotation[row][col] = row == col ? int(FIXED_ONE) : 0;
+    }
+  }
+  if ((epipole.x == 0 && epipole.y == 0) || FIXED_ONE + epipole.z <= 0) {
+    // Epipole is parallel to the default north pole.
+    if (epipole.z < 0) {
+      rotation[2][2] = -int(FIXED_ONE);
+    }
+    return;
+  }
+
+  // Rodrigues rotation formula I + K + K^2 / (1 + c) with the skew-symmetric matrix K of (0, 0, 1) x epipole, transposed
+  const int64_t skew[3][3] = { { 0, 0, epipole.x }, { 0, 0, epipole.y }, { -epipole.x, -epipole.y, 0 } };
+  for (int row = 0; row < 3; row++) {
+    for (int col = 0; col < 3; col++) {
+      const int64_t skewSquared = skew[row][0] * skew[0][col] + skew[row][1] * skew[1][col] + skew[row][2] * skew[2][col];
+      rotation[col][row] += int(skew[row][col] + divRound(skewSquared, FIXED_ONE + epipole.z));
+    }
+  }
+}
+
+GeodesicFixedPoint::Vector GeodesicFixedPoint::toSphere(const Point &position) const
+{
+  const uint32_t phi = uint32_t(-divRound(position.x << (32 - GED_FIXED_POINT_POSITION_BITS), m_width));
+  const uint32_t theta = uint32_t(divRound(position.y << (31 - GED_FIXED_POINT_POSITION_BITS), m_height));
+  return toSphere(sin(theta), cos(theta), sin(phi), cos(phi));
+}
+
+GeodesicFixedPoint::Vector GeodesicFixedPoint::toSphere(int sinTheta, int cosTheta, int sinPhi, int cosPhi) const
+{
+  return { roundShift(int64_t(sinTheta) * cosPhi, GED_FIXED_POINT_BITS), roundShift(int64_t(sinTheta) * sinPhi, GED_FIXED_POINT_BITS), cosTheta };
+}
+
+GeodesicFixedPoint::Point GeodesicFixedPoint::fromSphere(const Vector &cart3D) const
+{
+  const int64_t theta = atan2(int64_t(sqrt(square(cart3D.x) + square(cart3D.y))), cart3D.z);
+  int64_t phi = atan2(cart3D.y, cart3D.x);
+  phi = phi > 0 ? phi - FULL_TURN : phi;
+  return { roundShift(-phi * m_width, 32 - GED_FIXED_POINT_POSITION_BITS), roundShift(theta * m_height, 31 - GED_FIXED_POINT_POSITION_BITS) };
+}
+
+GeodesicFixedPoint::Vector GeodesicFixedPoint::rotate(const int rotation[3][3], const Vector &cart3D)
+{
+  return { roundShift(rotation[0][0] * cart3D.x + rotation[0][1] * cart3D.y + rotation[0][2] * cart3D.z, GED_FIXED_POINT_BITS),
+           roundShift(rotation[1][0] * cart3D.x + rotation[1][1] * cart3D.y + rotation[1][2] * cart3D.z, GED_FIXED_POINT_BITS),
+           roundShift(rotation[2][0] * cart3D.x + rotation[2][1] * cart3D.y + rotation[2][2] * cart3D.z, GED_FIXED_POINT_BITS) };
+}
+
+GeodesicFixedPoint::Vector GeodesicFixedPoint::rotateInverse(const int rotation[3][3], const Vector &cart3D)
+{
+  return { roundShift(rotation[0][0] * cart3D.x + rotation[1][0] * cart3D.y + rotation[2][0] * cart3D.z, GED_FIXED_POINT_BITS),
+           roundShift(rotation[0][1] * cart3D.x + rotation[1][1] * cart3D.y + rotation[2][1] * cart3D.z, GED_FIXED_POINT_BITS),
+           roundShift(rotation[0][2] * cart3D.x + rotation[1][2] * cart3D.y + rotation[2][2] * cart3D.z, GED_FIXED_POINT_BITS) };
+}
+
+int64_t GeodesicFixedPoint::centerInclination(const Epipole &epipole, const Point &blockCenter, int64_t &radius) const
+{
+  const Vector center = rotate(epipole.fixedRotation, toSphere(blockCenter));
+  const int64_t rho = int64_t(sqrt(square(center.x) + square(center.y)));
+  const int64_t norm = int64_t(sqrt(square(center.x) + square(center.y) + square(center.z)));
+  radius = divRound(rho << GED_FIXED_POINT_BITS, norm);
+  return atan2(rho, center.z);
+}
+
+void GeodesicFixedPoint::motionParam(const Epipole &epipole, const Mv &motionVector, int shiftHor, int shiftVer,
+                                     const Point &blockCenter, MotionParam &param) const
+{
+  // Angle resolution pi / height per sample
+  const uint32_t thetaShift = uint32_t(divRound(int64_t(motionVector.hor) << (31 - shiftHor), m_height));
+  const uint32_t phiShift = uint32_t(divRound(int64_t(motionVector.ver) << (31 - shiftVer), m_height));
+  param.cosTheta = cos(thetaShift);
+  param.sinTheta = sin(thetaShift);
+  param.cosPhi = cos(phiShift);
+  param.sinPhi = sin(phiShift);
+  param.sinCenterTheta = 0;
+  param.radius = FIXED_ONE;
+  param.cylindricalShift = 0;
+
+  switch (m_flavor)
+  {
+  case GeodesicMotionModel::VISHWANATH_ORIGINAL:
+    break;
+  case GeodesicMotionModel::VISHWANATH_MODULATED:
+  {
+    int64_t radius;
+    param.sinCenterTheta = sin(uint32_t(centerInclination(epipole, blockCenter, radius) + thetaShift));
+    break;
+  }
+  case GeodesicMotionModel::REGENSKY_GEO_BLOCK:
+    centerInclination(epipole, blockCenter, param.radius);
+    // fall through
+  case GeodesicMotionModel::REGENSKY_GEO_GLOBAL:
+    // Cylinder shift deltaZ * mvX with deltaZ = 1 / tan(pi / 2 + pi / height) = -tan(pi / height)
+    param.cylindricalShift = -divRound(m_tanAngleResolution * motionVector.hor, int64_t(1) << (GED_FIXED_POINT_BITS - GED_CYLINDER_SHIFT_BITS + shiftHor));
+    break;
+  }
+}
+
+bool GeodesicFixedPoint::moveRotated(const MotionParam &param, Vector &cart3DRot) const
+{
+  const int64_t rho = int64_t(sqrt(square(cart3DRot.x) + square(cart3DRot.y)));
+  if (rho == 0) {
+    return false;
+  }
+  const int64_t z = cart3DRot.z;
+
+  // Moved inclination as unnormalized direction (rho, z)
+  int64_t rhoMoved = 0;
+  int64_t zMoved = 0;
+  switch (m_flavor)
+  {
+  case GeodesicMotionModel::VISHWANATH_ORIGINAL:
+    rhoMoved = roundShift(rho * param.cosTheta + z * param.sinTheta, GED_FIXED_POINT_BITS);
+    zMoved = roundShift(z * param.cosTheta - rho * param.sinTheta, GED_FIXED_POINT_BITS);
+    break;
+  case GeodesicMotionModel::VISHWANATH_MODULATED:
+  {
+    // Shift atan(sin(theta) / (k - cos(theta))) with k = sin(thetaC + dTheta) / sin(dTheta) as direction (cos, sin)
+    int64_t shiftCos = param.sinCenterTheta - roundShift(z * param.sinTheta, GED_FIXED_POINT_BITS);
+    int64_t shiftSin = roundShift(rho * param.sinTheta, GED_FIXED_POINT_BITS);
+    if (shiftCos < 0) {
+      shiftCos = -shiftCos;
+      shiftSin = -shiftSin;
+    } else if (shiftCos == 0 && shiftSin == 0) {
+      shiftCos = 1;
+    }
+    rhoMoved = roundShift(rho * shiftCos + z * shiftSin, GED_FIXED_POINT_BITS);
+    zMoved = roundShift(z * shiftCos - rho * shiftSin, GED_FIXED_POINT_BITS);
+    break;
+  }
+  case GeodesicMotionModel::REGENSKY_GEO_GLOBAL:
+  case GeodesicMotionModel::REGENSKY_GEO_BLOCK:
+    // Point (radius, radius * cot(theta) + shift) on the cylinder
+    rhoMoved = roundShift(param.radius * rho, GED_FIXED_POINT_BITS);
+    zMoved = roundShift(param.radius * z, GED_FIXED_POINT_BITS) + roundShift(param.cylindricalShift * rho, GED_CYLINDER_SHIFT_BITS);
+    break;
+  }
+
+  // Normalize to (sin, cos) of the moved inclination
+  int scale = 0;
+  while ((std::max(std::llabs(rhoMoved), std::llabs(zMoved)) >> scale) >= FIXED_ONE << 1) {
+    scale++;
+  }
+  rhoMoved = roundShift(rhoMoved, scale);
+  zMoved = roundShift(zMoved, scale);
+  const int64_t norm = int64_t(sqrt(square(rhoMoved) + square(zMoved)));
+  if (norm == 0) {
+    return false;
+  }
+  const int64_t sinThetaMoved = divRound(rhoMoved << GED_FIXED_POINT_BITS, norm);
+  const int64_t cosThetaMoved = divRound(zMoved << GED_FIXED_POINT_BITS, norm);
+
+  // Moved azimuth
+  const int64_t x = roundShift(cart3DRot.x * param.cosPhi - cart3DRot.y * param.sinPhi, GED_FIXED_POINT_BITS);
+  const int64_t y = roundShift(cart3DRot.x * param.sinPhi + cart3DRot.y * param.cosPhi, GED_FIXED_POINT_BITS);
+
+  cart3DRot = { divRound(x * sinThetaMoved, rho), divRound(y * sinThetaMoved, rho), cosThetaMoved };
+  return true;
+}
+
+void GeodesicFixedPoint::reprojectSubblocks(const Epipole &epipole, const Point &origin, int rows, int cols, const Mv &motionVector,
+                                            const Point &blockCenter, int64_t offset, int scaleShiftX, int scaleShiftY,
+                                            int shiftHor, int shiftVer, int *fixedX, int *fixedY) const
+{
+  CHECKD(rows > (MAX_CU_SIZE >> 2) || cols > (MAX_CU_SIZE >> 2), "Too many subblocks.");
+  const int outShiftHor = GED_FIXED_POINT_POSITION_BITS + scaleShiftX - shiftHor;
+  const int outShiftVer = GED_FIXED_POINT_POSITION_BITS + scaleShiftY - shiftVer;
+  const int64_t step = int64_t(4) << GED_FIXED_POINT_POSITION_BITS;
+
+  if (motionVector.hor == 0 && motionVector.ver == 0) {
+    for (int col = 0; col < cols; col++) {
+      for (int row = 0; row < rows; row++) {
+        fixedX[col * rows + row] = int(roundShift(origin.x + col * step - offset, outShiftHor));
+        fixedY[col * rows + row] = int(roundShift(origin.y + row * step - offset, outShiftVer));
+      }
+    }
+    return;
+  }
+
+  MotionParam param;
+  motionParam(epipole, motionVector, MV_FRACTIONAL_BITS_INTERNAL, MV_FRACTIONAL_BITS_INTERNAL, blockCenter, param);
+
+  // The inclination only depends on the row and the azimuth only on the column.
+  int sinTheta[MAX_CU_SIZE >> 2], cosTheta[MAX_CU_SIZE >> 2];
+  int sinPhi[MAX_CU_SIZE >> 2], cosPhi[MAX_CU_SIZE >> 2];
+  for (int row = 0; row < rows; row++) {
+    const uint32_t theta = uint32_t(divRound((origin.y + row * step) << (31 - GED_FIXED_POINT_POSITION_BITS), m_height));
+    sinTheta[row] = sin(theta);
+    cosTheta[row] = cos(theta);
+  }
+  for (int col = 0; col < cols; col++) {
+    const uint32_t phi = uint32_t(-divRound((origin.x + col * step) << (32 - GED_FIXED_POINT_POSITION_BITS), m_width));
+    sinPhi[col] = sin(phi);
+    cosPhi[col] = cos(phi);
+  }
+
+  for (int col = 0; col < cols; col++) {
+    for (int row = 0; row < rows; row++) {
+      Point moved = { origin.x + col * step, origin.y + row * step };
+      Vector cart3DRot = rotate(epipole.fixedRotation, toSphere(sinTheta[row], cosTheta[row], sinPhi[col], cosPhi[col]));
+      if (moveRotated(param, cart3DRot)) {
+        moved = fromSphere(rotateInverse(epipole.fixedRotation, cart3DRot));
+      }
+      fixedX[col * rows + row] = int(roundShift(moved.x - offset, outShiftHor));
+      fixedY[col * rows + row] = int(roundShift(moved.y - offset, outShiftVer));
+    }
+  }
+}
+
+bool GeodesicFixedPoint::modelMotionAt(const Epipole &epipole, const Point &position, const Mv &motionVector, int shiftHor, int shiftVer,
+                                       const Point &blockCenter, Point &moved) const
+{
+  if (motionVector.hor == 0 && motionVector.ver == 0) {
+    moved = position;
+    return true;
+  }
+
+  MotionParam param;
+  motionParam(epipole, motionVector, shiftHor, shiftVer, blockCenter, param);
+  Vector cart3DRot = rotate(epipole.fixedRotation, toSphere(position));
+  if (!moveRotated(param, cart3DRot)) {
+    return false;
+  }
+  moved = fromSphere(rotateInverse(epipole.fixedRotation, cart3DRot));
+  return true;
+}
+
+bool GeodesicFixedPoint::motionVectorForEquivalentShiftAt(const Epipole &epipole, const Point &position, const Point &moved, const Point &blockCenter,
+                                                          int shiftHor, int shiftVer, Mv &motionVector) const
+{
+  const Vector cart3DRot = rotate(epipole.fixedRotation, toSphere(position));
+  const Vector cart3DMovedRot = rotate(epipole.fixedRotation, toSphere(moved));
+  const int64_t rho = int64_t(sqrt(square(cart3DRot.x) + square(cart3DRot.y)));
+  const int64_t rhoMoved = int64_t(sqrt(square(cart3DMovedRot.x) + square(cart3DMovedRot.y)));
+
+  // Angles in units of the angle resolution pi / height
+  const int64_t dPhi = atan2(cart3DMovedRot.y, cart3DMovedRot.x) - atan2(cart3DRot.y, cart3DRot.x);
+  const int mvY = int(roundShift((dPhi * m_height) << shiftVer, 31));
+
+  int64_t dTheta = 0;
+  switch (m_flavor)
+  {
+  case GeodesicMotionModel::VISHWANATH_ORIGINAL:
+    dTheta = atan2(rhoMoved, cart3DMovedRot.z) - atan2(rho, cart3DRot.z);
+    break;
+  case GeodesicMotionModel::VISHWANATH_MODULATED:
+  {
+    // Inclination shift of the block center atan(sin(thetaC) / (k - cos(thetaC))) with k = sin(thetaMoved) / sin(thetaMoved - theta)
+    int64_t radius;
+    const uint32_t centerTheta = uint32_t(centerInclination(epipole, blockCenter, radius));
+    const int64_t thetaMoved = atan2(rhoMoved, cart3DMovedRot.z);
+    const int sinDTheta = sin(uint32_t(thetaMoved - atan2(rho, cart3DRot.z)));
+    int64_t shiftSin = roundShift(int64_t(sin(centerTheta)) * sinDTheta, GED_FIXED_POINT_BITS);
+    int64_t shiftCos = sin(uint32_t(thetaMoved)) - roundShift(int64_t(cos(centerTheta)) * sinDTheta, GED_FIXED_POINT_BITS);
+    if (shiftCos < 0) {
+      shiftCos = -shiftCos;
+      shiftSin = -shiftSin;
+    }
+    dTheta = atan2(shiftSin, shiftCos);
+    break;
+  }
+  case GeodesicMotionModel::REGENSKY_GEO_GLOBAL:
+  case GeodesicMotionModel::REGENSKY_GEO_BLOCK:
+  {
+    // Shift along the cylinder (radius * (cot(thetaMoved) - cot(theta))) / deltaZ with deltaZ = -tan(pi / height)
+    if (rho == 0 || rhoMoved == 0) {
+      return false;
+    }
+    const int64_t dCot = divRound(cart3DMovedRot.z << GED_FIXED_POINT_BITS, rhoMoved) - divRound(cart3DRot.z << GED_FIXED_POINT_BITS, rho);
+    if (std::llabs(dCot) >= int64_t(1) << 40) {
+      return false;
+    }
+    int64_t radius = FIXED_ONE;
+    if (m_flavor == GeodesicMotionModel::REGENSKY_GEO_BLOCK) {
+      centerInclination(epipole, blockCenter, radius);
+    }
+    const int64_t dCotHigh = dCot >> 20;
+    const int64_t dCotLow = dCot - (dCotHigh << 20);
+    const int64_t dZ = roundShift(dCotHigh * radius, GED_FIXED_POINT_BITS - 20) + roundShift(dCotLow * radius, GED_FIXED_POINT_BITS);
+    motionVector = Mv(int(-divRound(dZ << shiftHor, m_tanAngleResolution)), mvY);
+    return true;
+  }
+  }
+
+  motionVector = Mv(int(roundShift((dTheta * m_height) << shiftHor, 31)), mvY);
+  return true;
+}
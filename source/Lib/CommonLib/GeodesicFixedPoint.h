@@ -0,0 +1,97 @@
+//
+// Integer implementation of the geodesic motion model for the equirectangular projection.
+//
+
+#pragma once
+
+#include "CommonDef.h"
+#include "Coordinate.h"
+#include "Mv.h"
+#include "MotionModels/GeodesicMotionModel.h"
+
+#include <cstdint>
+
+
+/**
+ * Geodesic motion model in fixed point arithmetic, selected by sps_ged_fixed_point_flag.
+ * Trigonometric functions use the quarter wave sin and the atan table of Rom.h with linear interpolation, the rotation to the
+ * epipole-aligned sphere is derived from the signalled epipole in integer arithmetic (Epipole::fixedRotation).
+ * Angles are binary angles (2^32 per turn), unit vectors and rotations have GED_FIXED_POINT_BITS and sample positions
+ * GED_FIXED_POINT_POSITION_BITS fractional bits. Results only depend on integer operations and are identical on all platforms.
+ */
+class GeodesicFixedPoint {
+public:
+  /** Luma sample position with GED_FIXED_POINT_POSITION_BITS fractional bits */
+  struct Point {
+    int64_t x;
+    int64_t y;
+  };
+
+  GeodesicFixedPoint(): m_width(0), m_height(0), m_flavor(GeodesicMotionModel::VISHWANATH_ORIGINAL), m_tanAngleResolution(0) {}
+  void init(const Size &resolution, GeodesicMotionModel::Flavor flavor);
+
+  static int sin(uint32_t angle);
+  static int cos(uint32_t angle) { return sin(angle + (1u << 30)); }
+  /** Binary angle of (x, y) in [-2^31, 2^31], 0 for (0, 0). The magnitudes of x and y must be below 2^36. */
+  static int64_t atan2(int64_t y, int64_t x);
+  /** Largest integer not above the square root */
+  static uint64_t sqrt(uint64_t value);
+  /** Rotation of the default north pole (0, 0, 1) onto the epipole with spherical coordinates in EPIPOLE_PRECISION_FIXED */
+  static void deriveRotation(const Array2Fixed &epipoleSpherical, int rotation[3][3]);
+
+  /** @brief Move a grid of rows x cols subblock coordinates that are 4 luma samples apart.
+   *
+   * @param origin First subblock coordinate in luma samples
+   * @param motionVector Motion vector in luma samples with MV_FRACTIONAL_BITS_INTERNAL fractional bits
+   * @param blockCenter Block center in luma samples
+   * @param offset Subblock coordinate offset subtracted from the moved positions
+   * @param scaleShiftX, scaleShiftY Component scale of the output positions
+   * @param shiftHor, shiftVer Fractional bits of the output positions
+   * @param fixedX, fixedY Moved positions in column-major order
+   */
+  void reprojectSubblocks(const Epipole &epipole, const Point &origin, int rows, int cols, const Mv &motionVector, const Point &blockCenter,
+                          int64_t offset, int scaleShiftX, int scaleShiftY, int shiftHor, int shiftVer, int *fixedX, int *fixedY) const;
+
+  /** @brief Position moved by the motion vector with shiftHor/shiftVer fractional bits. Returns false if the motion is undefined at the position. */
+  bool modelMotionAt(const Epipole &epipole, const Point &position, const Mv &motionVector, int shiftHor, int shiftVer,
+                     const Point &blockCenter, Point &moved) const;
+  /** @brief Motion vector with shiftHor/shiftVer fractional bits that moves position to moved. Returns false if there is none. */
+  bool motionVectorForEquivalentShiftAt(const Epipole &epipole, const Point &position, const Point &moved, const Point &blockCenter,
+                                        int shiftHor, int shiftVer, Mv &motionVector) const;
+
+protected:
+  /** Cartesian vector with GED_FIXED_POINT_BITS fractional bits */
+  struct Vector {
+    int64_t x;
+    int64_t y;
+    int64_t z;
+  };
+
+  /** Motion of one block on the epipole-aligned sphere */
+  struct MotionParam {
+    int     cosTheta;          ///< Inclination shift (VISHWANATH_ORIGINAL)
+    int     sinTheta;          ///< Inclination shift (VISHWANATH_ORIGINAL, VISHWANATH_MODULATED)
+    int     sinCenterTheta;    ///< Sine of the moved block center inclination (VISHWANATH_MODULATED)
+    int64_t radius;            ///< Cylinder radius (REGENSKY_GEO_GLOBAL/BLOCK)
+    int64_t cylindricalShift;  ///< Shift along the cylinder axis with GED_CYLINDER_SHIFT_BITS fractional bits (REGENSKY_GEO_GLOBAL/BLOCK)
+    int     cosPhi;            ///< Azimuth shift
+    int     sinPhi;            ///< Azimuth shift
+  };
+
+  Vector toSphere(const Point &position) const;
+  Vector toSphere(int sinTheta, int cosTheta, int sinPhi, int cosPhi) const;
+  Point fromSphere(const Vector &cart3D) const;
+  static Vector rotate(const int rotation[3][3], const Vector &cart3D);
+  static Vector rotateInverse(const int rotation[3][3], const Vector &cart3D);
+
+  /** Inclination of the block center on the epipole-aligned sphere */
+  int64_t centerInclination(const Epipole &epipole, const Point &blockCenter, int64_t &radius) const;
+  void motionParam(const Epipole &epipole, const Mv &motionVector, int shiftHor, int shiftVer, const Point &blockCenter, MotionParam &param) const;
+  /** Move a vector on the epipole-aligned sphere, returns false at the poles */
+  bool moveRotated(const MotionParam &param, Vector &cart3DRot) const;
+
+  int64_t m_width;
+  int64_t m_height;
+  GeodesicMotionModel::Flavor m_flavor;
+  int64_t m_tanAngleResolution;  ///< tan(pi / height) with GED_FIXED_POINT_BITS fractional bits
+};
@@ -0,0 +1,95 @@
+//
+// Fused equirectangular geodesic reprojection of 4x4 subblock grids.
+//
+
+#include "GeodesicReprojection.h"
+
+#include "Eigen/Dense"
+
+#include <type_traits>
+
+
+namespace
+{
+typedef Eigen::internal::packet_traits<TCoord> TCoordPacketTraits;
+typedef TCoordPacketTraits::type PacketTCoord;
+
+/// sin and cos of the generic Eigen path are evaluated with packet math if available.
+static constexpr bool PACKET_TRIG = TCoordPacketTraits::Vectorizable && TCoordPacketTraits::HasSin && TCoordPacketTraits::HasCos;
+static constexpr int PACKET_SIZE = PACKET_TRIG ? int(TCoordPacketTraits::size) : 1;
+
+template<bool packetTrig>
+struct PacketSinCos
+{
+  static void run(const TCoord *x, TCoord *sinX, TCoord *cosX)
+  {
+    const PacketTCoord packet = Eigen::internal::ploadu<PacketTCoord>(x);
+    Eigen::internal::pstoreu(sinX, Eigen::internal::psin(packet));
+    Eigen::internal::pstoreu(cosX, Eigen::internal::pcos(packet));
+  }
+};
+
+template<>
+struct PacketSinCos<false>
+{
+  static void run(const TCoord *x, TCoord *sinX, TCoord *cosX)
+  {
+    sinX[0] = std::sin(x[0]);
+    cosX[0] = std::cos(x[0]);
+  }
+};
+}
+
+
+GeodesicReprojection::GeodesicReprojection()
+{
+  m_packetSize = PACKET_SIZE;
+  m_reprojectSubblocks = xReprojectSubblocks;
+
+#if ENABLE_SIMD_OPT_GED && EIGEN_VERSION_AT_LEAST(3, 4, 0)
+#ifdef TARGET_SIMD_X86
+  // The x86 kernels replicate the SSE4.1 packet math of Eigen 3.4 (psincos); older versions keep the Eigen path.
+  if (std::is_same<TCoord, float>::value && TCoordPacketTraits::size == 4 && TCoordPacketTraits::HasRound)
+  {
+    initGeodesicReprojectionX86();
+  }
+#endif
+#endif
+}
+
+void GeodesicReprojection::xReprojectSubblocks(const TCoord *sphericalR, const TCoord *sphericalTheta, const TCoord *sphericalPhi,
+                                               const TCoord *cart2DX, const TCoord *cart2DY, int numElements, int numPacketElements,
+                                               const GeodesicReprojectionParam &param, int *fixedX, int *fixedY)
+{
+  TCoord theta[PACKET_SIZE], sinTheta[PACKET_SIZE], cosTheta[PACKET_SIZE];
+  TCoord phi[PACKET_SIZE], sinPhi[PACKET_SIZE], cosPhi[PACKET_SIZE];
+  TCoord fixedFloatX, fixedFloatY;
+
+  // Packet part
+  for (int i = 0; i < numPacketElements; i += PACKET_SIZE)
+  {
+    for (int k = 0; k < PACKET_SIZE; ++k)
+    {
+      theta[k] = moveTheta(param, sphericalTheta[i + k]);
+      phi[k] = sphericalPhi[i + k] + param.phiShift;
+    }
+    PacketSinCos<PACKET_TRIG>::run(theta, sinTheta, cosTheta);
+    PacketSinCos<PACKET_TRIG>::run(phi, sinPhi, cosPhi);
+    for (int k = 0; k < PACKET_SIZE; ++k)
+    {
+      movedPosition(param, sphericalR[i + k], sinTheta[k], cosTheta[k], sinPhi[k], cosPhi[k], cart2DX[i + k], cart2DY[i + k], fixedFloatX, fixedFloatY);
+      fixedX[i + k] = int(std::round(fixedFloatX));
+      fixedY[i + k] = int(std::round(fixedFloatY));
+    }
+  }
+
+  // Scalar tail
+  for (int i = numPacketElements; i < numElements; ++i)
+  {
+    const TCoord thetaMoved = moveTheta(param, sphericalTheta[i]);
+    const TCoord phiMoved = sphericalPhi[i] + param.phiShift;
+    movedPosition(param, sphericalR[i], std::sin(thetaMoved), std::cos(thetaMoved), std::sin(phiMoved), std::cos(phiMoved), cart2DX[i], cart2DY[i], fixedFloatX, fixedFloatY);
+    fixedX[i] = int(std::round(fixedFloatX));
+    fixedY[i] = int(std::round(fixedFloatY));
+  }
+}
@@ -0,0 +1,130 @@
+//
+// Fused equirectangular geodesic reprojection of 4x4 subblock grids.
+//
+
+#pragma once
+
+#include "CommonDef.h"
+
+#include <cmath>
+#include <algorithm>
+
+
+/** Parameters of the fused reprojection from rotated spherical subblock coordinates to fixed precision positions. */
+struct GeodesicReprojectionParam {
+  /** Geodesic motion (REGENSKY_GEO_GLOBAL or REGENSKY_GEO_BLOCK) */
+  bool   globalCylinder;        ///< true: unit cylinder (REGENSKY_GEO_GLOBAL), false: block center adapted cylinder (REGENSKY_GEO_BLOCK)
+  TCoord cylindricalRadius;     ///< Cylinder radius for REGENSKY_GEO_BLOCK
+  TCoord cylindricalShift;      ///< Shift along the cylinder axis, i.e., deltaZ * mvX
+  TCoord phiShift;              ///< Shift in azimuth, i.e., angleResolution * mvY
+  TCoord inverseRotation[3][3]; ///< Rotation from the epipole-aligned sphere back to the original sphere
+
+  /** Equirectangular projection */
+  TCoord width;
+  TCoord height;
+  TCoord pixelOffset;
+
+  /** Fixed precision output */
+  TCoord offset4x4;             ///< Subblock coordinate offset subtracted from the moved positions
+  bool   rescale;               ///< Rescale to chroma with scaleX/Y
+  TCoord scaleX;
+  TCoord scaleY;
+  TCoord fixedScaleHor;         ///< 1 << shiftHor
+  TCoord fixedScaleVer;         ///< 1 << shiftVer
+};
+
+
+/**
+ * Maps rotated spherical coordinates of subblocks plus a motion vector to fixed precision moved positions in one pass.
+ * The result is bit-exact to the generic Eigen path (GeodesicMotionModel + EquirectangularProjection + MVReprojection):
+ * the first numPacketElements elements use the packet sin/cos/round of Eigen, the remaining elements use the scalar
+ * std:: functions, and all other operations are evaluated in the same order.
+ */
+class GeodesicReprojection {
+public:
+  GeodesicReprojection();
+  ~GeodesicReprojection() {}
+
+  /** Number of leading elements of an array with numElements elements that Eigen evaluates with packet math. */
+  int numPacketElements(int numElements) const { return numElements - numElements % m_packetSize; }
+
+  void( *m_reprojectSubblocks )( const TCoord *sphericalR, const TCoord *sphericalTheta, const TCoord *sphericalPhi,
+                                 const TCoord *cart2DX, const TCoord *cart2DY, int numElements, int numPacketElements,
+                                 const GeodesicReprojectionParam &param, int *fixedX, int *fixedY );
+
+  /** Scalar motion on the cylinder, identical to GeodesicMotionModel::modelGeodesicMotion. */
+  static inline TCoord moveTheta(const GeodesicReprojectionParam &param, TCoord theta)
+  {
+    if (param.globalCylinder) {
+      const TCoord cylindricalZMoved = 1 / std::tan(theta) + param.cylindricalShift;
+      return TCoord(std::atan2(1, cylindricalZMoved));
+    }
+    const TCoord cylindricalZMoved = param.cylindricalRadius / std::tan(theta) + param.cylindricalShift;
+    return TCoord(std::atan2(param.cylindricalRadius, cylindricalZMoved));
+  }
+
+  /** Scalar inclination (acos) identical to CoordinateConversion::cartesianToSpherical. */
+  static inline TCoord inclination(TCoord cart3DZ, TCoord sphericalR)
+  {
+    return std::acos(std::max(std::min(cart3DZ / sphericalR, TCoord(1)), TCoord(-1)));
+  }
+
+  /** Scalar azimuth (atan2) identical to CoordinateConversion::cartesianToSpherical. */
+  static inline TCoord azimuth(TCoord cart3DX, TCoord cart3DY)
+  {
+    return TCoord(std::atan2(cart3DY, cart3DX));
+  }
+
+  /** Scalar remainder of the reprojection after sin/cos of the moved spherical coordinates, returns the unrounded fixed precision position. */
+  static inline void movedPosition(const GeodesicReprojectionParam &param, TCoord sphericalR,
+                                   TCoord sinTheta, TCoord cosTheta, TCoord sinPhi, TCoord cosPhi,
+                                   TCoord cart2DX, TCoord cart2DY, TCoord &fixedX, TCoord &fixedY)
+  {
+    // Back to cartesian
+    const TCoord cart3DRotX = sphericalR * sinTheta * cosPhi;
+    const TCoord cart3DRotY = sphericalR * sinTheta * sinPhi;
+    const TCoord cart3DRotZ = sphericalR * cosTheta;
+
+    // Undo rotation to desired epipole
+    const TCoord (*m)[3] = param.inverseRotation;
+    const TCoord cart3DX = m[0][0] * cart3DRotX + (m[0][1] * cart3DRotY + m[0][2] * cart3DRotZ);
+    const TCoord cart3DY = m[1][0] * cart3DRotX + (m[1][1] * cart3DRotY + m[1][2] * cart3DRotZ);
+    const TCoord cart3DZ = m[2][0] * cart3DRotX + (m[2][1] * cart3DRotY + m[2][2] * cart3DRotZ);
+
+    // Project to the equirectangular image plane
+    const TCoord r = std::sqrt(cart3DX * cart3DX + cart3DY * cart3DY + cart3DZ * cart3DZ);
+    const TCoord theta = inclination(cart3DZ, r);
+    TCoord phi = azimuth(cart3DX, cart3DY);
+    phi = phi > 0 ? phi - TCoord(2) * TCoord(M_PI) : phi;
+    TCoord x = -(phi / (TCoord(2) * TCoord(M_PI))) * param.width - param.pixelOffset;
+    TCoord y = (theta / TCoord(M_PI)) * param.height - param.pixelOffset;
+
+    // Perform no motion in case of NaN
+    if (std::isnan(x) || std::isnan(y)) {
+      x = cart2DX;
+      y = cart2DY;
+    }
+    x = x - param.offset4x4;
+    y = y - param.offset4x4;
+    if (param.rescale) {
+      x = x / param.scaleX;
+      y = y / param.scaleY;
+    }
+    fixedX = x * param.fixedScaleHor;
+    fixedY = y * param.fixedScaleVer;
+  }
+
+protected:
+  static void xReprojectSubblocks( const TCoord *sphericalR, const TCoord *sphericalTheta, const TCoord *sphericalPhi,
+                                   const TCoord *cart2DX, const TCoord *cart2DY, int numElements, int numPacketElements,
+                                   const GeodesicReprojectionParam &param, int *fixedX, int *fixedY );
+
+  int m_packetSize;  ///< Float packet size of the generic Eigen path
+
+#ifdef TARGET_SIMD_X86
+public:
+  void initGeodesicReprojectionX86();
+  template <X86_VEXT vext>
+  void _initGeodesicReprojectionX86();
+#endif
+};
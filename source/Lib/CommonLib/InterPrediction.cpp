@@ -156,6 +156,7 @@ void InterPrediction::destroy()
     m_cRefSamplesDMVRL1[ch] = nullptr;
   }
   m_IBCBuffer.destroy();
+  m_reprojectionArena.destroy();
 }
 
 void InterPrediction::init( RdCost* pcRdCost, ChromaFormat chromaFormatIDC, const int ctuSize, MVReprojection* mvReprojection )
@@ -239,6 +240,10 @@ void InterPrediction::init( RdCost* pcRdCost, ChromaFormat chromaFormatIDC, cons
   }
 
   m_mvReprojection = mvReprojection;
+  if (!m_reprojectionArena.isCreated())
+  {
+    m_reprojectionArena.create(Size(MAX_CU_SIZE, MAX_CU_SIZE));
+  }
 }
 
 // ====================================================================================================================
@@ -711,8 +716,8 @@ void InterPrediction::xPredInterBlkMM(const ComponentID compID, const Prediction
 #if INTERPRED_PROFILING
   auto start_mvReprojTime = std::chrono::high_resolution_clock::now();
 #endif
-  ArrayXXFixedPtrPair cart2DProjMovedFixedSubblocks = m_mvReprojection->reprojectMotionVectorSubblocks(
-    blockPos, blockSize, mv, motionModel, compID, chFmt, pu.cs->slice->getPOC(), refPic->getPOC());
+  const ArrayXXFixedConstMapPair cart2DProjMovedFixedSubblocks = m_mvReprojection->reprojectMotionVectorSubblocks(
+    blockPos, blockSize, mv, motionModel, compID, chFmt, pu.cs->slice->getPOC(), refPic->getPOC(), m_reprojectionArena);
 #if INTERPRED_PROFILING
   auto end_mvReprojTime = std::chrono::high_resolution_clock::now();
   dbg_mvReprojTime += std::chrono::duration<double>(end_mvReprojTime - start_mvReprojTime).count();
@@ -722,15 +727,12 @@ void InterPrediction::xPredInterBlkMM(const ComponentID compID, const Prediction
   auto start_fracCalcTime = std::chrono::high_resolution_clock::now();
 #endif
   // MVReprojection returns fixed precision moved subblock positions with precision (decimal shift)
-  // according to the current component ID and chroma format.
-  int shiftHor = int(MV_FRACTIONAL_BITS_INTERNAL + getComponentScaleX(compID, chFmt));
-  int shiftVer = int(MV_FRACTIONAL_BITS_INTERNAL + getComponentScaleY(compID, chFmt));
-  ArrayXXFixed xPos, yPos;  // Integer pixel coordinates
-  ArrayXXFixed xFrac, yFrac; // Fractional pixel coordinates
-  xPos = std::get<0>(cart2DProjMovedFixedSubblocks)->unaryExpr([shiftHor](int val){ return val >> shiftHor; });
-  yPos = std::get<1>(cart2DProjMovedFixedSubblocks)->unaryExpr([shiftVer](int val){ return val >> shiftVer; });
-  xFrac = std::get<0>(cart2DProjMovedFixedSubblocks)->unaryExpr([shiftHor](int val){ return val & ((1 << shiftHor) - 1); });
-  yFrac = std::get<1>(cart2DProjMovedFixedSubblocks)->unaryExpr([shiftVer](int val){ return val & ((1 << shiftVer) - 1); });
+  // according to the current component ID and chroma format. Integer and fractional pixel coordinates
+  // are split per subblock below.
+  const int shiftHor = int(MV_FRACTIONAL_BITS_INTERNAL + getComponentScaleX(compID, chFmt));
+  const int shiftVer = int(MV_FRACTIONAL_BITS_INTERNAL + getComponentScaleY(compID, chFmt));
+  const ArrayXXFixedConstMap &xFixed = std::get<0>(cart2DProjMovedFixedSubblocks);
+  const ArrayXXFixedConstMap &yFixed = std::get<1>(cart2DProjMovedFixedSubblocks);
 #if INTERPRED_PROFILING
   auto end_fracCalcTime = std::chrono::high_resolution_clock::now();
   dbg_fracCalcTime += std::chrono::duration<double>(end_fracCalcTime - start_fracCalcTime).count();
@@ -775,55 +777,39 @@ void InterPrediction::xPredInterBlkMM(const ComponentID compID, const Prediction
   const int scaleY = 1 << getComponentScaleY(compID, chFmt);
   int maxCUWidth = int(pu.cs->sps->getMaxCUWidth()) / scaleX;
   int maxCUHeight = int(pu.cs->sps->getMaxCUHeight()) / scaleY;
-  for (int col = 0; col < blockSize.width / subblockSize.width; ++col) {
-    for (int row = 0; row < blockSize.height / subblockSize.height; ++row) {
-      if (xPos(row, col) < -maxCUWidth or yPos(row, col) < -maxCUHeight or xPos(row, col) >= refBuf.width + maxCUWidth - subblockSize.width or yPos(row, col) >= refBuf.height + maxCUHeight - subblockSize.height)
+  const int numRows = blockSize.height / subblockSize.height;
+  const int numCols = blockSize.width / subblockSize.width;
+  int xPos[MAX_CU_SIZE / MIN_PU_SIZE], yPos[MAX_CU_SIZE / MIN_PU_SIZE];
+  int xFrac[MAX_CU_SIZE / MIN_PU_SIZE], yFrac[MAX_CU_SIZE / MIN_PU_SIZE];
+  const auto isOutside = [&](int col) {
+    return xPos[col] < -maxCUWidth or yPos[col] < -maxCUHeight or xPos[col] >= refBuf.width + maxCUWidth - subblockSize.width or yPos[col] >= refBuf.height + maxCUHeight - subblockSize.height;
+  };
+  for (int row = 0; row < numRows; ++row) {
+    Pel *dstRow = dstBuf.buf + row * subblockSize.height * dstBuf.stride;
+    for (int col = 0; col < numCols; ++col) {
+      xPos[col]  = xFixed(row, col) >> shiftHor;               // Integer pixel coordinates
+      yPos[col]  = yFixed(row, col) >> shiftVer;
+      xFrac[col] = xFixed(row, col) & ((1 << shiftHor) - 1);  // Fractional pixel coordinates
+      yFrac[col] = yFixed(row, col) & ((1 << shiftVer) - 1);
+    }
+
+    // Interpolate the row of subblocks in segments between subblocks outside of the reference picture
+    int col = 0;
+    while (col < numCols) {
+      if (isOutside(col))
       {
         dstBuf.subBuf(col * int(subblockSize.width), row * int(subblockSize.height), subblockSize.width, subblockSize.height).memset(0);
+        col++;
         continue;
       }
-      if (yFrac(row, col) == 0)
-      {
-        m_if.filterHor(compID,
-                       (Pel *) refBuf.buf + yPos(row, col) * refBuf.stride + xPos(row, col),
-                       refBuf.stride,
-                       dstBuf.buf + row * subblockSize.height * dstBuf.stride + col * subblockSize.width,
-                       dstBuf.stride,
-                       int(subblockSize.width), int(subblockSize.height), xFrac(row, col), rndRes, clpRng, filterIdx, useAltHpelIf);
-      }
-      else if (xFrac(row, col) == 0)
+      int segmentEnd = col + 1;
+      while (segmentEnd < numCols && !isOutside(segmentEnd))
       {
-        m_if.filterVer(compID,
-                       (Pel *) refBuf.buf + yPos(row, col) * refBuf.stride + xPos(row, col),
-                       refBuf.stride,
-                       dstBuf.buf + row * subblockSize.height * dstBuf.stride + col * subblockSize.width,
-                       dstBuf.stride,
-                       int(subblockSize.width), int(subblockSize.height), yFrac(row, col), true, rndRes, clpRng, filterIdx, useAltHpelIf);
-      }
-      else
-      {
-        PelBuf tmpBuf = PelBuf(m_filteredBlockTmp[0][compID], subblockSize);
-        // TODO: tmpBuf.stride = dstBuf.stride? Probably speeds up data copy by a little bit...
-        tmpBuf.stride = dstBuf.stride;
-
-        int vFilterSize = isLuma(compID) ? NTAPS_LUMA : NTAPS_CHROMA;
-        if (bilinearMC)
-        {
-          vFilterSize = NTAPS_BILINEAR;
-        }
-        m_if.filterHor(compID, (Pel *) refBuf.buf + yPos(row, col) * refBuf.stride + xPos(row, col) - ((vFilterSize >> 1) - 1) * refBuf.stride,
-                       refBuf.stride,
-                       tmpBuf.buf,
-                       tmpBuf.stride,
-                       int(subblockSize.width), int(subblockSize.height) + vFilterSize - 1, xFrac(row, col), false, clpRng, filterIdx, useAltHpelIf);
-        JVET_J0090_SET_CACHE_ENABLE(false);
-        m_if.filterVer(compID,
-                       (Pel *) tmpBuf.buf + ((vFilterSize >> 1) - 1) * tmpBuf.stride,
-                       tmpBuf.stride,
-                       dstBuf.buf + row * subblockSize.height * dstBuf.stride + col * subblockSize.width,
-                       dstBuf.stride,
-                       int(subblockSize.width), int(subblockSize.height), yFrac(row, col), false, rndRes, clpRng, filterIdx, useAltHpelIf);
+        segmentEnd++;
       }
+      m_if.filterSubblocks(compID, refBuf.buf, refBuf.stride, dstRow + col * subblockSize.width, dstBuf.stride, subblockSize,
+                           segmentEnd - col, xPos + col, yPos + col, xFrac + col, yFrac + col, rndRes, clpRng, filterIdx, useAltHpelIf);
+      col = segmentEnd;
     }
   }
   JVET_J0090_SET_CACHE_ENABLE(
@@ -840,7 +826,7 @@ void InterPrediction::xPredInterBlkMM(const ComponentID compID, const Prediction
   {
     // Extended sample values for BDOF
     dstBuf.buf = m_filteredBlockTmp[2 + m_iRefListIdx][compID];
-    xNearestNeighborPaddingForBDOF(xPos, yPos, xFrac, yFrac, refBuf, dstBuf, bdofWidth, bdofHeight, clpRng);
+    xNearestNeighborPaddingForBDOF(xFixed, yFixed, shiftHor, shiftVer, refBuf, dstBuf, bdofWidth, bdofHeight, clpRng);
 
     // restore data
     dstBuf.buf    = backupDstBufPtr;
@@ -855,16 +841,20 @@ void InterPrediction::xPredInterBlkMM(const ComponentID compID, const Prediction
 #endif
 }
 
-void InterPrediction::xNearestNeighborPaddingForBDOF(const ArrayXXFixed &xPos, const ArrayXXFixed &yPos,
-                                                     const ArrayXXFixed &xFrac, const ArrayXXFixed &yFrac,
+void InterPrediction::xNearestNeighborPaddingForBDOF(const ArrayXXFixedConstMap &xFixed, const ArrayXXFixedConstMap &yFixed,
+                                                     int shiftHor, int shiftVer,
                                                      CPelBuf refBuf, PelBuf dstBuf,
                                                      int bdofWidth, int bdofHeight,
                                                      ClpRng clpRng)
 {
   const int shift = IF_INTERNAL_FRAC_BITS(clpRng.bd);
   int xOffset, yOffset;
-  const int rows = xPos.rows();
-  const int cols = xPos.cols();
+  const int rows = int(xFixed.rows());
+  const int cols = int(xFixed.cols());
+  const auto xPos = [&](int row, int col) { return xFixed(row, col) >> shiftHor; };
+  const auto yPos = [&](int row, int col) { return yFixed(row, col) >> shiftVer; };
+  const auto xFrac = [&](int row, int col) { return xFixed(row, col) & ((1 << shiftHor) - 1); };
+  const auto yFrac = [&](int row, int col) { return yFixed(row, col) & ((1 << shiftVer) - 1); };
 
   // Loop through 4x4 subblock shifts in top row
   for (int col = 0; col < cols; ++col)
@@ -2485,6 +2475,43 @@ void InterPrediction::xProcessDMVRProjected(PredictionUnit& pu, PelUnitBuf &pcYu
       PredictionUnit subPu = pu;
       subPu.UnitArea::operator=(UnitArea(pu.chromaFormat, Area(x, y, dx, dy)));
 
+      // With sps_ged_dmvr_window_flag, the neighbourhood of the merge mv is reprojected once per list and the integer
+      // search costs are read from shifted windows instead of reprojecting the sub-PU for every offset.
+      const int  margin    = GED_DMVR_WINDOW_MARGIN;
+      const bool useWindow = pu.cs->sps->getUseGEDDMVRWindow() && x >= margin && y >= margin
+                             && x + dx + margin <= int(pu.cs->pps->getPicWidthInLumaSamples())
+                             && y + dy + margin <= int(pu.cs->pps->getPicHeightInLumaSamples());
+      if (useWindow)
+      {
+        PredictionUnit windowPu = subPu;
+        windowPu.UnitArea::operator=(UnitArea(pu.chromaFormat, Area(x - margin, y - margin, dx + 2 * margin, dy + 2 * margin)));
+        for (int refList = 0; refList < NUM_REF_PIC_LIST_01; refList++)
+        {
+          PelUnitBuf windowBuf(CHROMA_400, PelBuf(m_dmvrWindowGED[refList], GED_DMVR_WINDOW_STRIDE, dx + 2 * margin, dy + 2 * margin));
+          xPredInterBlkMM(COMPONENT_Y, windowPu, refList == 0 ? refPicL0 : refPicL1, mergeMv[refList], windowBuf, motionModel, true,
+                          pu.cs->slice->getClpRngs().comp[COMPONENT_Y], false, false,
+                          pu.cu->slice->getScalingRatio(RefPicList(refList), pu.refIdx[refList]), false);
+        }
+      }
+      const auto offsetCost = [&](const Mv &offset, const Mv &totalMv0, const Mv &totalMv1) {
+        if (useWindow)
+        {
+          const Pel *window0 = m_dmvrWindowGED[0] + (margin + offset.getVer()) * GED_DMVR_WINDOW_STRIDE + margin + offset.getHor();
+          const Pel *window1 = m_dmvrWindowGED[1] + (margin - offset.getVer()) * GED_DMVR_WINDOW_STRIDE + margin - offset.getHor();
+          return xDMVRCost(bd, const_cast<Pel *>(window0), GED_DMVR_WINDOW_STRIDE, window1, GED_DMVR_WINDOW_STRIDE, dx, dy);
+        }
+        xPredInterBlkMM(COMPONENT_Y, subPu, refPicL0, totalMv0, srcPred0, motionModel, true,
+                        pu.cs->slice->getClpRngs().comp[COMPONENT_Y], false, false,
+                        pu.cu->slice->getScalingRatio(REF_PIC_LIST_0, pu.refIdx[REF_PIC_LIST_0]), false);
+        xPredInterBlkMM(COMPONENT_Y, subPu, refPicL1, totalMv1, srcPred1, motionModel, true,
+                        pu.cs->slice->getClpRngs().comp[COMPONENT_Y], false, false,
+                        pu.cu->slice->getScalingRatio(REF_PIC_LIST_1, pu.refIdx[REF_PIC_LIST_1]), false);
+        return xDMVRCost(bd,
+                         srcPred0.bufs[COMPONENT_Y].buf, srcPred0.bufs[COMPONENT_Y].stride,
+                         srcPred1.bufs[COMPONENT_Y].buf, srcPred1.bufs[COMPONENT_Y].stride,
+                         dx, dy);
+      };
+
       uint64_t  minCost         = MAX_UINT64;
       bool      notZeroCost     = true;
       int16_t   totalDeltaMV[2] = { 0, 0 };
@@ -2507,16 +2534,7 @@ void InterPrediction::xProcessDMVRProjected(PredictionUnit& pu, PelUnitBuf &pcYu
 
         if (i == 0)
         {
-          xPredInterBlkMM(COMPONENT_Y, subPu, refPicL0, totalMv0, srcPred0, motionModel, true,
-                          pu.cs->slice->getClpRngs().comp[COMPONENT_Y], false, false,
-                          pu.cu->slice->getScalingRatio(REF_PIC_LIST_0, pu.refIdx[REF_PIC_LIST_0]), false);
-          xPredInterBlkMM(COMPONENT_Y, subPu, refPicL1, totalMv1, srcPred1, motionModel, true,
-                          pu.cs->slice->getClpRngs().comp[COMPONENT_Y], false, false,
-                          pu.cu->slice->getScalingRatio(REF_PIC_LIST_1, pu.refIdx[REF_PIC_LIST_1]), false);
-          minCost = xDMVRCost(bd,
-                              srcPred0.bufs[COMPONENT_Y].buf, srcPred0.bufs[COMPONENT_Y].stride,
-                              srcPred1.bufs[COMPONENT_Y].buf, srcPred1.bufs[COMPONENT_Y].stride,
-                              dx, dy);
+          minCost = offsetCost(Mv(0, 0), totalMv0, totalMv1);
           minCost -= (minCost >> 2);
           if (minCost < (dx * dy))
           {
@@ -2541,20 +2559,10 @@ void InterPrediction::xProcessDMVRProjected(PredictionUnit& pu, PelUnitBuf &pcYu
           totalMv0 = totalMv0Orig + (m_pSearchOffset[nIdx] << MV_FRACTIONAL_BITS_INTERNAL);
           totalMv1 = totalMv1Orig - (m_pSearchOffset[nIdx] << MV_FRACTIONAL_BITS_INTERNAL);
 
-          xPredInterBlkMM(COMPONENT_Y, subPu, refPicL0, totalMv0, srcPred0, motionModel, true,
-                          pu.cs->slice->getClpRngs().comp[COMPONENT_Y], false, false,
-                          pu.cu->slice->getScalingRatio(REF_PIC_LIST_0, pu.refIdx[REF_PIC_LIST_0]), false);
-          xPredInterBlkMM(COMPONENT_Y, subPu, refPicL1, totalMv1, srcPred1, motionModel, true,
-                          pu.cs->slice->getClpRngs().comp[COMPONENT_Y], false, false,
-                          pu.cu->slice->getScalingRatio(REF_PIC_LIST_1, pu.refIdx[REF_PIC_LIST_1]), false);
-
           if (*(pSADsArray + sadOffset) == MAX_UINT64)
           {
-            const uint64_t cost = xDMVRCost(bd,
-                                            srcPred0.bufs[COMPONENT_Y].buf, srcPred0.bufs[COMPONENT_Y].stride,
-                                            srcPred1.bufs[COMPONENT_Y].buf, srcPred1.bufs[COMPONENT_Y].stride,
-                                            dx, dy);
-            *(pSADsArray + sadOffset) = cost;
+            const Mv totalOffset = m_pSearchOffset[nIdx] + Mv(totalDeltaMV[0], totalDeltaMV[1]);
+            *(pSADsArray + sadOffset) = offsetCost(totalOffset, totalMv0, totalMv1);
           }
           if (*(pSADsArray + sadOffset) < minCost)
           {
@@ -110,6 +110,9 @@ protected:
                              Mv(-2, 1), Mv(-1, 1), Mv(0, 1), Mv(1, 1), Mv(2, 1),
                              Mv(-2, 2), Mv(-1, 2), Mv(0, 2), Mv(1, 2), Mv(2, 2) };
   uint64_t m_SADsArray[((2 * DMVR_NUM_ITERATION) + 1) * ((2 * DMVR_NUM_ITERATION) + 1)];
+  /// reprojected projected-DMVR search windows around the merge mv of the current sub-PU (sps_ged_dmvr_window_flag)
+  static constexpr int GED_DMVR_WINDOW_STRIDE = DMVR_SUBCU_WIDTH + 2 * GED_DMVR_WINDOW_MARGIN;
+  Pel m_dmvrWindowGED[NUM_REF_PIC_LIST_01][GED_DMVR_WINDOW_STRIDE * (DMVR_SUBCU_HEIGHT + 2 * GED_DMVR_WINDOW_MARGIN)];
 
   static constexpr int AFFINE_SUBBLOCK_WIDTH_EXT  = AFFINE_SUBBLOCK_SIZE + 2 * PROF_BORDER_EXT_W;
   static constexpr int AFFINE_SUBBLOCK_HEIGHT_EXT = AFFINE_SUBBLOCK_SIZE + 2 * PROF_BORDER_EXT_H;
@@ -129,14 +132,15 @@ protected:
 
   // Multi-model inter prediction
   MVReprojection*       m_mvReprojection;
+  ReprojectionArena     m_reprojectionArena;
 
   int                  m_IBCBufferWidth;
   PelStorage           m_IBCBuffer;
   void xIntraBlockCopy          (PredictionUnit &pu, PelUnitBuf &predBuf, const ComponentID compID);
   int             rightShiftMSB(int numer, int    denom);
   void            applyBiOptFlow(const PredictionUnit &pu, const CPelUnitBuf &yuvSrc0, const CPelUnitBuf &yuvSrc1, const int &refIdx0, const int &refIdx1, PelUnitBuf &yuvDst, const BitDepths &clipBitDepths);
-  void xNearestNeighborPaddingForBDOF(const ArrayXXFixed &xPos, const ArrayXXFixed &yPos,
-                                      const ArrayXXFixed &xFrac, const ArrayXXFixed &yFrac,
+  void xNearestNeighborPaddingForBDOF(const ArrayXXFixedConstMap &xFixed, const ArrayXXFixedConstMap &yFixed,
+                                      int shiftHor, int shiftVer,
                                       CPelBuf refBuf, PelBuf dstBuf,
                                       int bdofWidth, int bdofHeight,
                                       ClpRng clpRng);
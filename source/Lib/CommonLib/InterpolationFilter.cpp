@@ -364,6 +364,9 @@ InterpolationFilter::InterpolationFilter()
   m_filterCopy[1][0]   = filterCopy<true, false>;
   m_filterCopy[1][1]   = filterCopy<true, true>;
 
+  m_filterSubblocks4x4[0] = filterSubblocks4x4<false>;
+  m_filterSubblocks4x4[1] = filterSubblocks4x4<true>;
+
   m_weightedGeoBlk = xWeightedGeoBlk;
 }
 
@@ -643,6 +646,35 @@ void InterpolationFilter::filter(const ClpRng &clpRng, Pel const *src, const ptr
   }
 }
 
+/**
+ * \brief Apply separable 8-tap luma interpolation to 4x4 subblocks with individual fractional phases
+ *
+ * \param  clpRng       Clipping range
+ * \param  src          Pointers to the source samples of each subblock
+ * \param  srcStride    Stride of the source samples
+ * \param  dst          Pointers to the destination samples of each subblock
+ * \param  dstStride    Stride of the destination samples
+ * \param  coeffHor     Horizontal filter coefficients of each subblock
+ * \param  coeffVer     Vertical filter coefficients of each subblock
+ * \param  numSubblocks Number of subblocks
+ */
+template<bool isLast>
+void InterpolationFilter::filterSubblocks4x4(const ClpRng &clpRng, Pel const *const *src, const ptrdiff_t srcStride,
+                                             Pel *const *dst, const ptrdiff_t dstStride,
+                                             TFilterCoeff const *const *coeffHor, TFilterCoeff const *const *coeffVer,
+                                             int numSubblocks)
+{
+  Pel tmp[4 * (4 + NTAPS_LUMA - 1)];
+
+  for (int i = 0; i < numSubblocks; i++)
+  {
+    filter<NTAPS_LUMA, false, true, false>(clpRng, src[i] - (NTAPS_LUMA / 2 - 1) * srcStride, srcStride, tmp, 4, 4,
+                                           4 + NTAPS_LUMA - 1, coeffHor[i], false);
+    filter<NTAPS_LUMA, true, false, isLast>(clpRng, tmp + (NTAPS_LUMA / 2 - 1) * 4, 4, dst[i], dstStride, 4, 4,
+                                            coeffVer[i], false);
+  }
+}
+
 static constexpr int tapToIdx(const int N)
 {
   return N == 8 ? 0 : (N == 4 ? 1 : (N == 2 ? 2 : (N == 6 ? 3 : 4)));
@@ -866,6 +898,78 @@ void InterpolationFilter::xWeightedGeoBlk(const PredictionUnit &pu, const uint32
   }
 }
 
+void InterpolationFilter::filterSubblocks(const ComponentID compID, Pel const *src, const ptrdiff_t srcStride, Pel *dst,
+                                          const ptrdiff_t dstStride, const Size &subblockSize, int numSubblocks,
+                                          const int *xPos, const int *yPos, const int *xFrac, const int *yFrac,
+                                          bool isLast, const ClpRng &clpRng, int nFilterIdx, bool useAltHpelIf)
+{
+  static constexpr int MAX_NUM_SUBBLOCKS = MAX_CU_SIZE / MIN_PU_SIZE;
+  CHECK(numSubblocks > MAX_NUM_SUBBLOCKS, "Too many subblocks");
+  CHECK(subblockSize.height > MIN_PU_SIZE, "Unsupported subblock height");
+
+  const int width  = int(subblockSize.width);
+  const int height = int(subblockSize.height);
+  const int vFilterSize = nFilterIdx == FILTER_DMVR ? NTAPS_BILINEAR : (isLuma(compID) ? NTAPS_LUMA : NTAPS_CHROMA);
+  const bool batch4x4 = isLuma(compID) && nFilterIdx == FILTER_DEFAULT && width == 4 && height == 4;
+
+  // Isolated 2D luma subblocks are collected and interpolated in one batch
+  Pel const    *batchSrc[MAX_NUM_SUBBLOCKS];
+  Pel          *batchDst[MAX_NUM_SUBBLOCKS];
+  TFilterCoeff const *batchCoeffHor[MAX_NUM_SUBBLOCKS];
+  TFilterCoeff const *batchCoeffVer[MAX_NUM_SUBBLOCKS];
+  int numBatched = 0;
+
+  for (int i = 0; i < numSubblocks;)
+  {
+    // Merge neighbouring subblocks with the same phase that continue in the reference picture
+    int numMerged = 1;
+    while (i + numMerged < numSubblocks && xFrac[i + numMerged] == xFrac[i] && yFrac[i + numMerged] == yFrac[i]
+           && yPos[i + numMerged] == yPos[i] && xPos[i + numMerged] == xPos[i] + numMerged * width)
+    {
+      numMerged++;
+    }
+
+    Pel const *srcSubblock = src + yPos[i] * srcStride + xPos[i];
+    Pel       *dstSubblock = dst + i * width;
+    const int  mergedWidth = numMerged * width;
+
+    if (yFrac[i] == 0)
+    {
+      filterHor(compID, srcSubblock, srcStride, dstSubblock, dstStride, mergedWidth, height, xFrac[i], isLast, clpRng,
+                nFilterIdx, useAltHpelIf);
+    }
+    else if (xFrac[i] == 0)
+    {
+      filterVer(compID, srcSubblock, srcStride, dstSubblock, dstStride, mergedWidth, height, yFrac[i], true, isLast,
+                clpRng, nFilterIdx, useAltHpelIf);
+    }
+    else if (batch4x4 && numMerged == 1 && !(useAltHpelIf && (xFrac[i] == 8 || yFrac[i] == 8)))
+    {
+      batchSrc[numBatched]      = srcSubblock;
+      batchDst[numBatched]      = dstSubblock;
+      batchCoeffHor[numBatched] = m_lumaFilter[xFrac[i]];
+      batchCoeffVer[numBatched] = m_lumaFilter[yFrac[i]];
+      numBatched++;
+    }
+    else
+    {
+      filterHor(compID, srcSubblock - ((vFilterSize >> 1) - 1) * srcStride, srcStride, m_subblockTmp, mergedWidth,
+                mergedWidth, height + vFilterSize - 1, xFrac[i], false, clpRng, nFilterIdx, useAltHpelIf);
+      JVET_J0090_SET_CACHE_ENABLE(false);
+      filterVer(compID, m_subblockTmp + ((vFilterSize >> 1) - 1) * mergedWidth, mergedWidth, dstSubblock, dstStride,
+                mergedWidth, height, yFrac[i], false, isLast, clpRng, nFilterIdx, useAltHpelIf);
+    }
+
+    i += numMerged;
+  }
+
+  if (numBatched > 0)
+  {
+    m_filterSubblocks4x4[isLast](clpRng, batchSrc, srcStride, batchDst, dstStride, batchCoeffHor, batchCoeffVer,
+                                 numBatched);
+  }
+}
+
 /**
  * \brief turn on SIMD fuc
  *
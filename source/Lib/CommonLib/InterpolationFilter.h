@@ -86,6 +86,11 @@ public:
   void filterVer(const ClpRng &clpRng, Pel const *src, ptrdiff_t srcStride, Pel *dst, ptrdiff_t dstStride, int width,
                  int height, bool isFirst, bool isLast, TFilterCoeff const *coeff, bool biMCForDMVR);
 
+  template<bool isLast>
+  static void filterSubblocks4x4(const ClpRng &clpRng, Pel const *const *src, ptrdiff_t srcStride, Pel *const *dst,
+                                 ptrdiff_t dstStride, TFilterCoeff const *const *coeffHor,
+                                 TFilterCoeff const *const *coeffVer, int numSubblocks);
+
   static void xWeightedGeoBlk(const PredictionUnit &pu, const uint32_t width, const uint32_t height, const ComponentID compIdx, const uint8_t splitDir, PelUnitBuf& predDst, PelUnitBuf& predSrc0, PelUnitBuf& predSrc1);
   void weightedGeoBlk(const PredictionUnit &pu, const uint32_t width, const uint32_t height, const ComponentID compIdx, const uint8_t splitDir, PelUnitBuf& predDst, PelUnitBuf& predSrc0, PelUnitBuf& predSrc1);
 protected:
@@ -112,6 +117,10 @@ public:
                                int width, int height, TFilterCoeff const *coeff, bool biMCForDMVR);
   void (*m_filterCopy[2][2])(const ClpRng &clpRng, Pel const *src, ptrdiff_t srcStride, Pel *dst, ptrdiff_t dstStride,
                              int width, int height, bool biMCForDMVR);
+  /// Separable 8-tap interpolation of 4x4 luma subblocks with individual source positions and fractional phases, [isLast]
+  void (*m_filterSubblocks4x4[2])(const ClpRng &clpRng, Pel const *const *src, ptrdiff_t srcStride, Pel *const *dst,
+                                  ptrdiff_t dstStride, TFilterCoeff const *const *coeffHor,
+                                  TFilterCoeff const *const *coeffVer, int numSubblocks);
   void( *m_weightedGeoBlk )(const PredictionUnit &pu, const uint32_t width, const uint32_t height, const ComponentID compIdx, const uint8_t splitDir, PelUnitBuf& predDst, PelUnitBuf& predSrc0, PelUnitBuf& predSrc1);
 
   void initInterpolationFilter( bool enable );
@@ -126,11 +135,24 @@ public:
   void filterVer(const ComponentID compID, Pel const *src, ptrdiff_t srcStride, Pel *dst, ptrdiff_t dstStride,
                  int width, int height, int frac, bool isFirst, bool isLast, const ClpRng &clpRng,
                  int nFilterIdx = FILTER_DEFAULT, bool useAltHpelIf = false);
+  /**
+   * Interpolation of a row of subblocks with individual integer positions and fractional phases (e.g., GED motion
+   * compensation). Subblock i is read at src + yPos[i] * srcStride + xPos[i] and written to dst + i * subblockSize.width.
+   * Neighbouring subblocks with the same phase and contiguous reference positions are filtered in one call.
+   */
+  void filterSubblocks(const ComponentID compID, Pel const *src, ptrdiff_t srcStride, Pel *dst, ptrdiff_t dstStride,
+                       const Size &subblockSize, int numSubblocks, const int *xPos, const int *yPos, const int *xFrac,
+                       const int *yFrac, bool isLast, const ClpRng &clpRng, int nFilterIdx = FILTER_DEFAULT,
+                       bool useAltHpelIf = false);
+
 #if JVET_J0090_MEMORY_BANDWITH_MEASURE
   void cacheAssign( CacheModel *cache ) { m_cacheModel = cache; }
 #endif
 
   static TFilterCoeff const * const getChromaFilterTable(const int deltaFract) { return m_chromaFilter[deltaFract]; };
+
+private:
+  Pel m_subblockTmp[MAX_CU_SIZE * (MIN_PU_SIZE + NTAPS_LUMA - 1)];  ///< Intermediate buffer of filterSubblocks
 };
 
 //! \}
@@ -6,6 +6,8 @@
 
 LookupTable::LookupTable(std::function<TCoord(TCoord)> function, std::pair<TCoord, TCoord> range, int samples)
 {
+  CHECK(samples < 2, "Lookup table requires at least two samples.")
+  CHECK(range.second <= range.first, "Lookup table range must not be empty.")
   m_range = range;
   m_samples = samples;
   init(function);
@@ -13,63 +15,103 @@ LookupTable::LookupTable(std::function<TCoord(TCoord)> function, std::pair<TCoor
 
 void LookupTable::init(const std::function<TCoord(TCoord)> &function)
 {
-  m_inputs = ArrayXTCoord::LinSpaced(m_samples, m_range.first, m_range.second);
-  m_outputs = m_inputs.unaryExpr(function);
+  m_forward.samples = ArrayXTCoord::LinSpaced(m_samples, m_range.first, m_range.second).unaryExpr(function);
+  m_forward.first = m_range.first;
+  m_forward.scale = TCoord(m_samples - 1) / (m_range.second - m_range.first);
+  initInverse();
+}
+
+void LookupTable::initInverse()
+{
+  // Resample the inverse onto m_samples uniformly spaced outputs between the first sample and the largest sample.
+  // Non-decreasing envelope of the forward samples, so that the inverse is well defined.
+  const ArrayXTCoord &forward = m_forward.samples;
+  std::vector<double> envelope(m_samples);
+  envelope[0] = forward[0];
+  for (int i = 1; i < m_samples; i++)
+  {
+    envelope[i] = std::max(envelope[i - 1], double(forward[i]));
+  }
+
+  const double outputFirst = envelope[0];
+  const double outputLast  = envelope[m_samples - 1];
+  const double inputStep   = (double(m_range.second) - double(m_range.first)) / double(m_samples - 1);
+  m_inverse.samples.resize(m_samples);
+  m_inverse.first = TCoord(outputFirst);
+  if (outputLast <= outputFirst)
+  {
+    // Constant function, every output maps to the first input
+    m_inverse.samples.setConstant(m_range.first);
+    m_inverse.scale = 0;
+    return;
+  }
+  m_inverse.scale = TCoord(double(m_samples - 1) / (outputLast - outputFirst));
+
+  int i = 0;
+  for (int k = 0; k < m_samples; k++)
+  {
+    const double output = outputFirst + (outputLast - outputFirst) * double(k) / double(m_samples - 1);
+    while (i < m_samples - 2 && envelope[i + 1] < output)
+    {
+      i++;
+    }
+    const double low  = envelope[i];
+    const double high = envelope[i + 1];
+    const double frac = high > low ? std::min(1.0, std::max(0.0, (output - low) / (high - low))) : 0.0;
+    m_inverse.samples[k] = TCoord(double(m_range.first) + (double(i) + frac) * inputStep);
+  }
+}
+
+void LookupTable::Grid::interpolate(const TCoord *value, TCoord *result, int num) const
+{
+  // Branch-free index arithmetic, only the two sample loads per value are gathers.
+  const TCoord *data    = samples.data();
+  const int     maxIdx  = int(samples.size()) - 2;
+  const TCoord  maxPos  = TCoord(samples.size() - 1);
+  for (int n = 0; n < num; n++)
+  {
+    const TCoord pos  = std::min(maxPos, std::max(TCoord(0), (value[n] - first) * scale));
+    const int    idx  = std::min(maxIdx, int(pos));
+    const TCoord frac = pos - TCoord(idx);
+    const TCoord low  = data[idx];
+    result[n] = low + frac * (data[idx + 1] - low);
+  }
 }
 
 TCoord LookupTable::lookup(TCoord value) const
 {
-  return m_outputs(static_cast<int>(std::round(std::max(TCoord(0), std::min(TCoord(1), (value - m_range.first) / (m_range.second - m_range.first))) * TCoord(m_samples - 1))));
+  TCoord result;
+  m_forward.interpolate(&value, &result, 1);
+  return result;
+}
+
+void LookupTable::lookup(const TCoord *value, TCoord *result, int num) const
+{
+  m_forward.interpolate(value, result, num);
 }
 
 ArrayXXTCoordPtr LookupTable::lookup(ArrayXXTCoordPtr value) const
 {
-  Eigen::ArrayXXi indices = (((*value - m_range.first) / (m_range.second - m_range.first)) * TCoord(m_samples - 1)).round().cast<int>().cwiseMax(0).cwiseMin(m_samples-1);
-  return std::make_shared<ArrayXXTCoord>(indices.unaryExpr([this](int index){return m_outputs(static_cast<int>(index));}));
+  ArrayXXTCoordPtr result = std::make_shared<ArrayXXTCoord>(value->rows(), value->cols());
+  m_forward.interpolate(value->data(), result->data(), int(value->size()));
+  return result;
 }
 
 TCoord LookupTable::inverseLookup(TCoord value) const
 {
-    std::pair<int, bool> res = findInsertIdx(value);
-    if (res.second) {
-      return m_inputs[res.first];
-    } else {
-      if (res.first == 0) {
-        return m_inputs[0];
-      } else if (res.first == m_outputs.size()) {
-        return m_inputs[res.first - 1];
-      } else {
-        TCoord dLow = value - m_outputs[res.first - 1];
-        TCoord dHigh = m_outputs[res.first] - value;
-        if (dLow < dHigh) {
-          return m_inputs[res.first - 1];
-        } else {
-          return m_inputs[res.first];
-        }
-      }
-    }
+  TCoord result;
+  m_inverse.interpolate(&value, &result, 1);
+  return result;
 }
 
-ArrayXXTCoordPtr LookupTable::inverseLookup(ArrayXXTCoordPtr value) const
+void LookupTable::inverseLookup(const TCoord *value, TCoord *result, int num) const
 {
-  return std::make_shared<ArrayXXTCoord>(value->unaryExpr([this](TCoord value){return this->inverseLookup(value);}));
+  m_inverse.interpolate(value, result, num);
 }
 
-std::pair<int, bool> LookupTable::findInsertIdx(TCoord value) const
+ArrayXXTCoordPtr LookupTable::inverseLookup(ArrayXXTCoordPtr value) const
 {
-  // Find insert index with binary sort.
-  int iLow = 0;
-  int iHigh = static_cast<int>(m_outputs.size()) - 1;
-
-  while (iLow <= iHigh) {
-    int iSplit = (iLow + iHigh) / 2;
-    if (m_outputs[iSplit] == value) {
-      return {iSplit, true};
-    } else if (m_outputs[iSplit] < value) {
-      iLow = iSplit + 1;
-    } else {
-      iHigh = iSplit - 1;
-    }
-  }
-  return {iHigh + 1, false};
+  ArrayXXTCoordPtr result = std::make_shared<ArrayXXTCoord>(value->rows(), value->cols());
+  m_inverse.interpolate(value->data(), result->data(), int(value->size()));
+  return result;
 }
@@ -8,7 +8,12 @@
 #include "Coordinate.h"
 
 
-/// Lookup table for fast function approximation.
+/**
+ * Lookup table for fast function approximation.
+ * The function is sampled on a uniform input grid and linearly interpolated. The inverse is resampled onto a uniform grid
+ * of output values at construction, so both directions reduce to index arithmetic without search. The inverse assumes a
+ * non-decreasing function; where the samples decrease, it maps to the first input that reaches the value.
+ */
 class LookupTable {
 public:
   LookupTable() = default;
@@ -16,17 +21,30 @@ public:
 
   ArrayXXTCoordPtr lookup(ArrayXXTCoordPtr value) const;
   TCoord lookup(TCoord value) const;
+  /** @brief Write the function values of num inputs to result. value and result may alias. */
+  void lookup(const TCoord *value, TCoord *result, int num) const;
 
   ArrayXXTCoordPtr inverseLookup(ArrayXXTCoordPtr value) const;
   TCoord inverseLookup(TCoord value) const;
+  /** @brief Write the inverse function values of num outputs to result. value and result may alias. */
+  void inverseLookup(const TCoord *value, TCoord *result, int num) const;
 
 protected:
+  /** Uniformly sampled function */
+  struct Grid {
+    ArrayXTCoord samples;
+    TCoord       first{0};
+    TCoord       scale{0};  ///< Inverse of the grid spacing
+
+    void interpolate(const TCoord *value, TCoord *result, int num) const;
+  };
+
   void init(const std::function<TCoord(TCoord)> &function);
-  std::pair<int, bool> findInsertIdx(TCoord value) const;
+  void initInverse();
 
 protected:
-  ArrayXTCoord m_inputs;
-  ArrayXTCoord m_outputs;
   std::pair<TCoord, TCoord> m_range;
   int m_samples;
+  Grid m_forward;
+  Grid m_inverse;
 };
@@ -14,6 +14,8 @@ struct MMConfig
 {
   bool              GED{false}; /**< Geodesic motion model */
   GeodesicMotionModel::Flavor GEDFlavor{GeodesicMotionModel::VISHWANATH_ORIGINAL}; /**< Geodesic motion model flavor for geodesic motion models */
+  bool              GEDFixedPoint{false}; /**< Integer geodesic motion model (GeodesicFixedPoint) */
+  bool              GEDDMVRWindow{false}; /**< Projected DMVR costs from one reprojected search window per list */
   bool              MMMVP{false}; /**< Multi-model motion vector prediction */
   int               MMOffset4x4{0}; /**< Multi-model 4x4 subblock offset */
   int               projectionFct{0}; /**< Projection function */
@@ -4,36 +4,109 @@
 
 #include "MVReprojection.h"
 
+MVReprojectionData::MVReprojectionData(const Projection *projection, const Size &resolution, const SPS *sps, const EpipoleList *epipoleList):
+  m_projection(projection), m_epipoleList(epipoleList), m_resolution(resolution),
+  m_offset4x4(sps->getMMOffset4x4() == 4 ? TCoord(1.5) : TCoord(sps->getMMOffset4x4())),
+  m_gedFlavor(sps->getGEDFlavor()), m_activeMotionModels(sps->getActiveMotionModels()), m_useGED(false),
+  m_useGEDFixedPoint(sps->getUseGEDFixedPoint()),
+  m_offset4x4Fixed(sps->getMMOffset4x4() == 4 ? 3 << (GED_FIXED_POINT_POSITION_BITS - 1) : int64_t(sps->getMMOffset4x4()) << GED_FIXED_POINT_POSITION_BITS)
+{
+  m_cart2DProj[0] = std::make_shared<ArrayXXTCoord>(Eigen::Array<TCoord, 1, Eigen::Dynamic>::LinSpaced(m_resolution.width / 4, m_offset4x4, TCoord(m_resolution.width - 4) + m_offset4x4).replicate(m_resolution.height / 4, 1));
+  m_cart2DProj[1] = std::make_shared<ArrayXXTCoord>(Eigen::Array<TCoord, Eigen::Dynamic, 1>::LinSpaced(m_resolution.height / 4, m_offset4x4, TCoord(m_resolution.height - 4) + m_offset4x4).replicate(1, m_resolution.width / 4));
+
+  for (auto motionModelID : m_activeMotionModels) {
+    CHECK(motionModelID != CLASSIC && motionModelID != GEODESIC, "Invalid motion model.");
+    if (motionModelID == GEODESIC) {
+      m_useGED = true;
+      m_rotatedSphereTables = std::make_shared<RotatedSphereTables>(projection, ArrayXXTCoordPtrPair(m_cart2DProj[0], m_cart2DProj[1]));
+    }
+  }
+
+  if (m_useGED && m_useGEDFixedPoint) {
+    const EquirectangularProjection *equirectangularProjection = dynamic_cast<const EquirectangularProjection*>(projection);
+    CHECK(equirectangularProjection == nullptr || equirectangularProjection->pixelOffset() != 0,
+          "The integer geodesic motion model requires the equirectangular projection without pixel offset.");
+    m_gedFixedPoint.init(m_resolution, m_gedFlavor);
+  }
+}
+
 void MVReprojection::init(const Projection *projection, const Size &resolution, const SPS *sps, const EpipoleList* epipoleList) {
-  m_projection = projection;
-  m_resolution = resolution;
-  m_offset4x4 = sps->getMMOffset4x4() == 4 ? TCoord(1.5) : TCoord(sps->getMMOffset4x4());
-  m_epipoleList = epipoleList;
-  fillCache();
-
-  for (auto motionModelID : sps->getActiveMotionModels()) {
-    MotionModel* motionModel;
+  init(std::make_shared<const MVReprojectionData>(projection, resolution, sps, epipoleList));
+}
+
+void MVReprojection::init(const std::shared_ptr<const MVReprojectionData> &data) {
+  m_data = data;
+  m_equivalentMvMemo = EquivalentMvMemo();
+
+  for (auto &motionModel : m_motionModels) {
+    motionModel.reset();
+  }
+  for (auto motionModelID : m_data->m_activeMotionModels) {
     switch(motionModelID) {
     case CLASSIC:
-      motionModel = new TranslationalMotionModel();
+      m_motionModels[motionModelID].reset(new TranslationalMotionModel());
       break;
     case GEODESIC:
-      motionModel = new GeodesicMotionModel(projection, M_PI / resolution.height, sps->getGEDFlavor());
-      static_cast<GeodesicMotionModel*>(motionModel)->fillCache({m_cart2DProj[0], m_cart2DProj[1]});
+    {
+      GeodesicMotionModel *geodesicMotionModel = new GeodesicMotionModel(m_data->m_projection, M_PI / m_data->m_resolution.height, m_data->m_gedFlavor);
+      geodesicMotionModel->setRotatedSphereTables(m_data->m_rotatedSphereTables);
+      m_motionModels[motionModelID].reset(geodesicMotionModel);
       break;
+    }
     default:
       CHECK(true, "Invalid motion model.");
     }
-    m_motionModels[motionModelID] = motionModel;
   }
 
   m_initialized = true;
 }
 
-void MVReprojection::fillCache()
+void MVReprojection::setTableBudget(size_t budgetBytes)
 {
-  m_cart2DProj[0] = std::make_shared<ArrayXXTCoord>(Eigen::Array<TCoord, 1, Eigen::Dynamic>::LinSpaced(m_resolution.width / 4, m_offset4x4, TCoord(m_resolution.width - 4) + m_offset4x4).replicate(m_resolution.height / 4, 1));
-  m_cart2DProj[1] = std::make_shared<ArrayXXTCoord>(Eigen::Array<TCoord, Eigen::Dynamic, 1>::LinSpaced(m_resolution.height / 4, m_offset4x4, TCoord(m_resolution.height - 4) + m_offset4x4).replicate(1, m_resolution.width / 4));
+  if (m_data->m_useGED) {
+    m_data->m_rotatedSphereTables->setBudget(budgetBytes);
+  }
+}
+
+void MVReprojection::prepareTables(const Slice &slice, ThreadPool *threadPool)
+{
+  if (!m_data->m_useGED || m_data->m_useGEDFixedPoint || slice.isIntra()) {
+    return;
+  }
+
+  std::vector<const Epipole*> epipoles;
+  for (int list = 0; list < NUM_REF_PIC_LIST_01; list++) {
+    for (int refIdx = 0; refIdx < slice.getNumRefIdx(RefPicList(list)); refIdx++) {
+      epipoles.push_back(&m_data->m_epipoleList->findEpipoleHandle(slice.getPOC(), slice.getRefPOC(RefPicList(list), refIdx)));
+    }
+  }
+  m_data->m_rotatedSphereTables->prepare(epipoles, threadPool);
+}
+
+void ReprojectionArena::create(const Size &maxBlockSize)
+{
+  // Chroma subblocks are scaled with the component, so the number of subblocks per block equals luma.
+  const Eigen::Index maxNumSubblocks = Eigen::Index(maxBlockSize.width / 4) * Eigen::Index(maxBlockSize.height / 4);
+  m_coordinates.create(GED_COORDINATE_ARENA_PLANES, maxNumSubblocks);
+  m_fixed[0].resize(maxNumSubblocks);
+  m_fixed[1].resize(maxNumSubblocks);
+  m_fieldValid = false;
+}
+
+void ReprojectionArena::destroy()
+{
+  m_coordinates.destroy();
+  m_fixed[0].resize(0);
+  m_fixed[1].resize(0);
+  m_fieldValid = false;
+}
+
+bool ReprojectionArena::FieldKey::operator==(const FieldKey &other) const
+{
+  return lumaPos == other.lumaPos && lumaSize == other.lumaSize && motionVector == other.motionVector
+         && motionModelID == other.motionModelID && chroma == other.chroma
+         && scaleShiftX == other.scaleShiftX && scaleShiftY == other.scaleShiftY
+         && epipole == other.epipole && (epipoleCartesian == other.epipoleCartesian).all();
 }
 
 Size MVReprojection::subblockSize(const ComponentID compID, const ChromaFormat chromaFormat)
@@ -43,14 +116,45 @@ Size MVReprojection::subblockSize(const ComponentID compID, const ChromaFormat c
   return {width, height};
 }
 
-ArrayXXFixedPtrPair
+ArrayXXFixedConstMapPair
 MVReprojection::reprojectMotionVectorSubblocks(const Position &position, const Size &size,
                                                  const Mv &motionVector, MotionModelID motionModelID,
                                                  ComponentID compID, ChromaFormat chromaFormat,
-                                                 int curPOC, int refPOC)
+                                                 int curPOC, int refPOC,
+                                                 ReprojectionArena &arena)
 {
    CHECK(motionModelID == CLASSIC, "This method should not be called with motion model 'CLASSIC'.");
 
+  // The integer GED moves the same luma grid points around the same luma block center for all components and returns
+  // them at the precision of the component, so the chroma fields equal the luma field. The floating point path derives
+  // chroma from its own coordinates and block center; there only Cb and Cr share their field.
+  const int scaleShiftX = getComponentScaleX(compID, chromaFormat);
+  const int scaleShiftY = getComponentScaleY(compID, chromaFormat);
+  const Epipole &epipole = m_data->m_epipoleList->findEpipoleHandle(curPOC, refPOC);
+  ReprojectionArena::FieldKey fieldKey;
+  fieldKey.lumaPos = Position(position.x << scaleShiftX, position.y << scaleShiftY);
+  fieldKey.lumaSize = Size(size.width << scaleShiftX, size.height << scaleShiftY);
+  fieldKey.motionVector = motionVector;
+  fieldKey.motionModelID = motionModelID;
+  fieldKey.chroma = !m_data->m_useGEDFixedPoint && isChroma(compID);
+  fieldKey.scaleShiftX = m_data->m_useGEDFixedPoint ? 0 : scaleShiftX;
+  fieldKey.scaleShiftY = m_data->m_useGEDFixedPoint ? 0 : scaleShiftY;
+  fieldKey.epipole = &epipole;
+  fieldKey.epipoleCartesian = epipole.cartesian;
+
+  if (arena.m_fieldValid && arena.m_fieldKey == fieldKey) {
+    const Size subblockSize = MVReprojection::subblockSize(compID, chromaFormat);
+    const Eigen::Index rows = size.height / subblockSize.height;
+    const Eigen::Index cols = size.width / subblockSize.width;
+    return {ArrayXXFixedConstMap(arena.m_fixed[0].data(), rows, cols), ArrayXXFixedConstMap(arena.m_fixed[1].data(), rows, cols)};
+  }
+  arena.m_fieldKey = fieldKey;
+  arena.m_fieldValid = true;
+
+   if (m_data->m_useGEDFixedPoint) {
+     return reprojectMotionVectorSubblocksFixed(position, size, motionVector, compID, chromaFormat, curPOC, refPOC, arena);
+   }
+
    // Chroma-related parameters
    const Size subblockSize = MVReprojection::subblockSize(compID, chromaFormat);
    // Component scale to align to luma scale
@@ -60,29 +164,29 @@ MVReprojection::reprojectMotionVectorSubblocks(const Position &position, const S
    const int shiftHor = int(MV_FRACTIONAL_BITS_INTERNAL + getComponentScaleX(compID, chromaFormat));
    const int shiftVer = int(MV_FRACTIONAL_BITS_INTERNAL + getComponentScaleY(compID, chromaFormat));
 
-   // Calculate coordinates or extract from cache.
-  ArrayXXTCoordPtr cart2DProjX, cart2DProjY;
-  ArrayXXTCoordPtr cart2DPersX, cart2DPersY;
-  ArrayXXBoolPtr vip;
+  const Eigen::Index rows = size.height / subblockSize.height;
+  const Eigen::Index cols = size.width / subblockSize.width;
+  CoordinateArena &coordinates = arena.m_coordinates;
+  CoordinateArena::Scope scope(coordinates);
+
+  // Calculate coordinates or extract from cache.
+  ArrayXXTCoordMap cart2DProjX = coordinates.acquire(rows, cols);
+  ArrayXXTCoordMap cart2DProjY = coordinates.acquire(rows, cols);
   if (isLuma(compID)) {
-    if (m_lastPosition == position and m_lastSize == size) {
-      cart2DProjX = m_lastCart2DProj[0];
-      cart2DProjY = m_lastCart2DProj[1];
-    } else {
-      cart2DProjX = std::make_shared<ArrayXXTCoord>(m_cart2DProj[0]->block(position.y/subblockSize.height, position.x/subblockSize.width, size.height/subblockSize.height, size.width/subblockSize.width));
-      cart2DProjY = std::make_shared<ArrayXXTCoord>(m_cart2DProj[1]->block(position.y/subblockSize.height, position.x/subblockSize.width, size.height/subblockSize.height, size.width/subblockSize.width));
-      m_lastPosition = position;
-      m_lastSize = size;
-      m_lastCart2DProj[0] = cart2DProjX;
-      m_lastCart2DProj[1] = cart2DProjY;
-    }
+    cart2DProjX = m_data->m_cart2DProj[0]->block(position.y/subblockSize.height, position.x/subblockSize.width, rows, cols);
+    cart2DProjY = m_data->m_cart2DProj[1]->block(position.y/subblockSize.height, position.x/subblockSize.width, rows, cols);
   } else {
-    Array2TCoord lumaScaledStartPos(TCoord(position.x) * scaleX + m_offset4x4,
-                                    TCoord(position.y) * scaleY + m_offset4x4);
+    Array2TCoord lumaScaledStartPos(TCoord(position.x) * scaleX + m_data->m_offset4x4,
+                                    TCoord(position.y) * scaleY + m_data->m_offset4x4);
     Array2TCoord lumaScaledEndPos(lumaScaledStartPos.x() + TCoord(size.width - subblockSize.width) * scaleX,
                                   lumaScaledStartPos.y() + TCoord(size.height - subblockSize.height) * scaleY);
-    cart2DProjX = std::make_shared<ArrayXXTCoord>(Eigen::Array<TCoord, 1, Eigen::Dynamic>::LinSpaced(size.width / subblockSize.width, lumaScaledStartPos.x(), lumaScaledEndPos.x()).replicate(size.height / subblockSize.height, 1));
-    cart2DProjY = std::make_shared<ArrayXXTCoord>(Eigen::Array<TCoord, Eigen::Dynamic, 1>::LinSpaced(size.height / subblockSize.height, lumaScaledStartPos.y(), lumaScaledEndPos.y()).replicate(1, size.width / subblockSize.width));
+    CoordinateArena::Scope linSpacedScope(coordinates);
+    ArrayXXTCoordMap linSpacedX = coordinates.acquire(1, cols);
+    ArrayXXTCoordMap linSpacedY = coordinates.acquire(rows, 1);
+    linSpacedX = Eigen::Array<TCoord, 1, Eigen::Dynamic>::LinSpaced(cols, lumaScaledStartPos.x(), lumaScaledEndPos.x());
+    linSpacedY = Eigen::Array<TCoord, Eigen::Dynamic, 1>::LinSpaced(rows, lumaScaledStartPos.y(), lumaScaledEndPos.y());
+    cart2DProjX = linSpacedX.replicate(rows, 1);
+    cart2DProjY = linSpacedY.replicate(1, cols);
   }
 
   // Motion vector as floating point
@@ -91,39 +195,77 @@ MVReprojection::reprojectMotionVectorSubblocks(const Position &position, const S
 
   // Epipole setup
   if (motionModelID == GEODESIC) {
-    static_cast<GeodesicMotionModel*>(m_motionModels[motionModelID])->setEpipole(m_epipoleList->findEpipole(curPOC, refPOC));
+    auto geodesicMotionModel = static_cast<GeodesicMotionModel*>(m_motionModels[motionModelID].get());
+    geodesicMotionModel->setEpipole(epipole);
+    if (isLuma(compID)) {
+      // Frame-wide rotated coordinates are built once per epipole and shared by all blocks.
+      geodesicMotionModel->updateRotatedSphereCache();
+    }
   }
 
-  // Motion modeling
-  ArrayXXTCoordPtrPair cart2DProjMoved;
   Array2TCoord blockCenter = Array2TCoord(position.x, position.y) + (Array2TCoord(size.width, size.height) - 1) / TCoord(2);
+
+  // Fused GED reprojection. Chroma without motion keeps the exact identity of the generic motion modeling.
+  if (motionModelID == GEODESIC && static_cast<GeodesicMotionModel*>(m_motionModels[motionModelID].get())->isFusedReprojectionSupported()
+      && (isLuma(compID) || mvX != 0 || mvY != 0)) {
+    auto geodesicMotionModel = static_cast<GeodesicMotionModel*>(m_motionModels[motionModelID].get());
+    ArrayXXTCoordMap sphericalR = coordinates.acquire(rows, cols);
+    ArrayXXTCoordMap sphericalTheta = coordinates.acquire(rows, cols);
+    ArrayXXTCoordMap sphericalPhi = coordinates.acquire(rows, cols);
+    if (isLuma(compID)) {
+      geodesicMotionModel->toRotatedSphereCached(Position(position.x/subblockSize.width, position.y/subblockSize.height),
+                                                 Size(size.width/subblockSize.width, size.height/subblockSize.height),
+                                                 sphericalR, sphericalTheta, sphericalPhi);
+    } else {
+      geodesicMotionModel->toRotatedSphere(cart2DProjX, cart2DProjY, sphericalR, sphericalTheta, sphericalPhi, coordinates);
+    }
+
+    GeodesicReprojectionParam param;
+    geodesicMotionModel->fillReprojectionParam(param, {mvX, mvY}, blockCenter);
+    param.offset4x4 = m_data->m_offset4x4;
+    param.rescale = isChroma(compID);
+    param.scaleX = scaleX;
+    param.scaleY = scaleY;
+    param.fixedScaleHor = TCoord(1 << shiftHor);
+    param.fixedScaleVer = TCoord(1 << shiftVer);
+
+    const int numElements = int(rows * cols);
+    m_geodesicReprojection.m_reprojectSubblocks(sphericalR.data(), sphericalTheta.data(), sphericalPhi.data(),
+                                                cart2DProjX.data(), cart2DProjY.data(),
+                                                numElements, m_geodesicReprojection.numPacketElements(numElements),
+                                                param, arena.m_fixed[0].data(), arena.m_fixed[1].data());
+    return {ArrayXXFixedConstMap(arena.m_fixed[0].data(), rows, cols), ArrayXXFixedConstMap(arena.m_fixed[1].data(), rows, cols)};
+  }
+
+  // Motion modeling
+  ArrayXXTCoordMap cart2DProjMovedX = coordinates.acquire(rows, cols);
+  ArrayXXTCoordMap cart2DProjMovedY = coordinates.acquire(rows, cols);
   if (isLuma(compID) && motionModelID == GEODESIC) {
     // Use cached motion modeling method for GED on luma channel
-    cart2DProjMoved = static_cast<GeodesicMotionModel*>(m_motionModels[motionModelID])->modelMotionCached(Position(position.x/subblockSize.width, position.y/subblockSize.height),
-                                                                                                          Size(size.width/subblockSize.width, size.height/subblockSize.height),
-                                                                                                          {mvX, mvY}, blockCenter);
+    static_cast<GeodesicMotionModel*>(m_motionModels[motionModelID].get())->modelMotionCached(Position(position.x/subblockSize.width, position.y/subblockSize.height),
+                                                                                        Size(size.width/subblockSize.width, size.height/subblockSize.height),
+                                                                                        cart2DProjMovedX, cart2DProjMovedY,
+                                                                                        {mvX, mvY}, blockCenter, coordinates);
   } else {
-    cart2DProjMoved = m_motionModels[motionModelID]->modelMotion({cart2DProjX, cart2DProjY}, {mvX, mvY}, blockCenter);
+    m_motionModels[motionModelID]->modelMotion(cart2DProjX, cart2DProjY, cart2DProjMovedX, cart2DProjMovedY, {mvX, mvY}, blockCenter, coordinates);
   }
 
-  ArrayXXTCoordPtr cart2DProjMovedX = std::get<0>(cart2DProjMoved);
-  ArrayXXTCoordPtr cart2DProjMovedY = std::get<1>(cart2DProjMoved);
-
-  // Perform no motion in case of NaN.
-  ArrayXXBool isNaN = cart2DProjMovedX->isNaN() || cart2DProjMovedY->isNaN();
-  cart2DProjMovedX = std::make_shared<ArrayXXTCoord>(isNaN.select(*cart2DProjX, *cart2DProjMovedX) - m_offset4x4);
-  cart2DProjMovedY = std::make_shared<ArrayXXTCoord>(isNaN.select(*cart2DProjY, *cart2DProjMovedY) - m_offset4x4);
+  // Perform no motion in case of NaN. The result is written in-place to the original coordinates.
+  cart2DProjX = (cart2DProjMovedX.isNaN() || cart2DProjMovedY.isNaN()).select(cart2DProjX, cart2DProjMovedX) - m_data->m_offset4x4;
+  cart2DProjY = (cart2DProjMovedX.isNaN() || cart2DProjMovedY.isNaN()).select(cart2DProjY, cart2DProjMovedY) - m_data->m_offset4x4;
 
   // Rescale to chroma if necessary
   if (isChroma(compID)) {
-    *cart2DProjMovedX = *cart2DProjMovedX / scaleX;
-    *cart2DProjMovedY = *cart2DProjMovedY / scaleY;
+    cart2DProjX = cart2DProjX / scaleX;
+    cart2DProjY = cart2DProjY / scaleY;
   }
 
-  // Return as fixed precision array
-  ArrayXXFixedPtr cart2DProjMovedFixedX = std::make_shared<ArrayXXFixed>((*cart2DProjMovedX * (1 << shiftHor)).round().cast<int>());
-  ArrayXXFixedPtr cart2DProjMovedFixedY = std::make_shared<ArrayXXFixed>((*cart2DProjMovedY * (1 << shiftVer)).round().cast<int>());
-  return {cart2DProjMovedFixedX, cart2DProjMovedFixedY};
+  // Return as fixed precision array views into the arena
+  Eigen::Map<ArrayXXFixed> cart2DProjMovedFixedX(arena.m_fixed[0].data(), rows, cols);
+  Eigen::Map<ArrayXXFixed> cart2DProjMovedFixedY(arena.m_fixed[1].data(), rows, cols);
+  cart2DProjMovedFixedX = (cart2DProjX * (1 << shiftHor)).round().cast<int>();
+  cart2DProjMovedFixedY = (cart2DProjY * (1 << shiftVer)).round().cast<int>();
+  return {ArrayXXFixedConstMap(arena.m_fixed[0].data(), rows, cols), ArrayXXFixedConstMap(arena.m_fixed[1].data(), rows, cols)};
 }
 
 Mv MVReprojection::motionVectorInDesiredMotionModel(const Position &position, const Mv &motionVectorOrig,
@@ -131,48 +273,218 @@ Mv MVReprojection::motionVectorInDesiredMotionModel(const Position &position, co
                                                     int shiftHor, int shiftVer,
                                                     int curPOCOrig, int refPOCOrig, int curPOCDesired, int refPOCDesired,
                                                     const Position &candidateBlockPos, const Size &candidateBlockSize,
-                                                    const Position &currentBlockPos, const Size &currentBlockSize) const {
+                                                    const Position &currentBlockPos, const Size &currentBlockSize) {
   if (motionVectorOrig.hor == 0 && motionVectorOrig.ver == 0) {
     return {0, 0};
   }
 
+  static const Epipole noEpipole;
+  const Epipole &epipoleOrig = motionModelIDOrig == GEODESIC ? m_data->m_epipoleList->findEpipoleHandle(curPOCOrig, refPOCOrig) : noEpipole;
+  const Epipole &epipoleDesired = motionModelIDDesired == GEODESIC ? m_data->m_epipoleList->findEpipoleHandle(curPOCDesired, refPOCDesired) : noEpipole;
   if (motionModelIDDesired == motionModelIDOrig) {
-    if (motionModelIDDesired != GEODESIC
-        || (m_epipoleList->findEpipole(curPOCOrig, refPOCOrig) == m_epipoleList->findEpipole(curPOCDesired, refPOCDesired)).all()) {
+    if (motionModelIDDesired != GEODESIC || (epipoleOrig.cartesian == epipoleDesired.cartesian).all()) {
       return motionVectorOrig;
     }
   }
 
+  // Candidates of the same block are derived repeatedly for merge and AMVP lists
+  if (m_equivalentMvMemo.blockPos != currentBlockPos || m_equivalentMvMemo.blockSize != currentBlockSize) {
+    m_equivalentMvMemo.blockPos = currentBlockPos;
+    m_equivalentMvMemo.blockSize = currentBlockSize;
+    m_equivalentMvMemo.numEntries = 0;
+    m_equivalentMvMemo.nextEntry = 0;
+  }
+  for (int i = 0; i < m_equivalentMvMemo.numEntries; i++) {
+    const EquivalentMvMemo::Entry &entry = m_equivalentMvMemo.entries[i];
+    if (entry.position == position && entry.motionVectorOrig == motionVectorOrig
+        && entry.motionModelIDOrig == motionModelIDOrig && entry.motionModelIDDesired == motionModelIDDesired
+        && entry.shiftHor == shiftHor && entry.shiftVer == shiftVer
+        && entry.candidateBlockPos == candidateBlockPos && entry.candidateBlockSize == candidateBlockSize
+        && (entry.epipoleOrig == epipoleOrig.cartesian).all() && (entry.epipoleDesired == epipoleDesired.cartesian).all()) {
+      return entry.motionVectorDesired;
+    }
+  }
+
+  if (m_data->m_useGEDFixedPoint) {
+    const Mv motionVectorDesired = motionVectorInDesiredMotionModelFixed(position, motionVectorOrig, motionModelIDOrig, motionModelIDDesired, shiftHor, shiftVer,
+                                                                         epipoleOrig, epipoleDesired, candidateBlockPos, candidateBlockSize,
+                                                                         currentBlockPos, currentBlockSize);
+    storeEquivalentMv(position, motionVectorOrig, motionModelIDOrig, motionModelIDDesired, shiftHor, shiftVer, candidateBlockPos, candidateBlockSize,
+                      epipoleOrig, epipoleDesired, motionVectorDesired);
+    return motionVectorDesired;
+  }
+
   // Original motion vector as floating point
   const TCoord mvX = TCoord(motionVectorOrig.hor >> shiftHor) + TCoord(motionVectorOrig.hor & ((1 << shiftHor) - 1))/TCoord(1 << shiftHor);
   const TCoord mvY = TCoord(motionVectorOrig.ver >> shiftVer) + TCoord(motionVectorOrig.ver & ((1 << shiftVer) - 1))/TCoord(1 << shiftVer);
 
   // Motion modeling with original motion model
   Array2TCoord blockCenterCandidate = Array2TCoord(candidateBlockPos.x, candidateBlockPos.y) + (Array2TCoord(candidateBlockSize.width, candidateBlockSize.height) - 1) / TCoord(2);
-  ArrayXXTCoordPtr cart2DX = std::make_shared<ArrayXXTCoord>(Eigen::Index(1), Eigen::Index(1));
-  ArrayXXTCoordPtr cart2DY = std::make_shared<ArrayXXTCoord>(Eigen::Index(1), Eigen::Index(1));
-  cart2DX->coeffRef(0) = TCoord(position.x);
-  cart2DY->coeffRef(0) = TCoord(position.y);
   if (motionModelIDOrig == GEODESIC) {
-    static_cast<GeodesicMotionModel*>(m_motionModels[motionModelIDOrig])->setEpipole(m_epipoleList->findEpipole(curPOCOrig, refPOCOrig));
+    static_cast<GeodesicMotionModel*>(m_motionModels[motionModelIDOrig].get())->setEpipole(epipoleOrig);
   }
-  const ArrayXXTCoordPtrPair cart2DProjMovedOrig = m_motionModels[motionModelIDOrig]->modelMotion({cart2DX, cart2DY}, {mvX, mvY}, blockCenterCandidate);
+  const Array2TCoord shiftedPosition = m_motionModels[motionModelIDOrig]->modelMotionAt(Array2TCoord(TCoord(position.x), TCoord(position.y)), {mvX, mvY}, blockCenterCandidate);
 
   // Get equivalent motion vector with desired motion model
-  const Array2TCoord shiftedPosition = Array2TCoord(std::get<0>(cart2DProjMovedOrig)->coeff(0), std::get<1>(cart2DProjMovedOrig)->coeff(0));
   if (motionModelIDDesired == GEODESIC) {
-    static_cast<GeodesicMotionModel*>(m_motionModels[motionModelIDDesired])->setEpipole(m_epipoleList->findEpipole(curPOCDesired, refPOCDesired));
+    static_cast<GeodesicMotionModel*>(m_motionModels[motionModelIDDesired].get())->setEpipole(epipoleDesired);
   }
   Array2TCoord blockCenterCurrent = Array2TCoord(currentBlockPos.x, currentBlockPos.y) + (Array2TCoord(currentBlockSize.width, currentBlockSize.height) - 1) / TCoord(2);
   const Array2TCoord mvDesired = m_motionModels[motionModelIDDesired]->motionVectorForEquivalentPixelShiftAt(position, shiftedPosition, blockCenterCurrent);
 
-  // Return zero mv if invalid
-  if (std::isnan(mvDesired.x()) || std::isnan(mvDesired.y())) {
-    return {0, 0};
+  // Zero mv if invalid, fixed precision mv otherwise
+  Mv motionVectorDesired(0, 0);
+  if (!std::isnan(mvDesired.x()) && !std::isnan(mvDesired.y())) {
+    motionVectorDesired.hor = static_cast<int>(std::round(mvDesired.x() * TCoord(1 << shiftHor)));
+    motionVectorDesired.ver = static_cast<int>(std::round(mvDesired.y() * TCoord(1 << shiftVer)));
+  }
+
+  storeEquivalentMv(position, motionVectorOrig, motionModelIDOrig, motionModelIDDesired, shiftHor, shiftVer, candidateBlockPos, candidateBlockSize,
+                    epipoleOrig, epipoleDesired, motionVectorDesired);
+  return motionVectorDesired;
+}
+
+void MVReprojection::storeEquivalentMv(const Position &position, const Mv &motionVectorOrig, MotionModelID motionModelIDOrig,
+                                       MotionModelID motionModelIDDesired, int shiftHor, int shiftVer,
+                                       const Position &candidateBlockPos, const Size &candidateBlockSize,
+                                       const Epipole &epipoleOrig, const Epipole &epipoleDesired, const Mv &motionVectorDesired)
+{
+  EquivalentMvMemo::Entry &entry = m_equivalentMvMemo.entries[m_equivalentMvMemo.nextEntry];
+  entry.position = position;
+  entry.motionVectorOrig = motionVectorOrig;
+  entry.motionModelIDOrig = motionModelIDOrig;
+  entry.motionModelIDDesired = motionModelIDDesired;
+  entry.shiftHor = shiftHor;
+  entry.shiftVer = shiftVer;
+  entry.candidateBlockPos = candidateBlockPos;
+  entry.candidateBlockSize = candidateBlockSize;
+  entry.epipoleOrig = epipoleOrig.cartesian;
+  entry.epipoleDesired = epipoleDesired.cartesian;
+  entry.motionVectorDesired = motionVectorDesired;
+  m_equivalentMvMemo.nextEntry = (m_equivalentMvMemo.nextEntry + 1) % GED_EQUIVALENT_MV_MEMO_SIZE;
+  m_equivalentMvMemo.numEntries = std::min(m_equivalentMvMemo.numEntries + 1, GED_EQUIVALENT_MV_MEMO_SIZE);
+}
+
+/** Block center in luma samples with GED_FIXED_POINT_POSITION_BITS fractional bits */
+static GeodesicFixedPoint::Point blockCenterFixed(const Position &position, const Size &size, int scaleShiftX, int scaleShiftY)
+{
+  return { int64_t(2 * (int(position.x) << scaleShiftX) + int(size.width << scaleShiftX) - 1) << (GED_FIXED_POINT_POSITION_BITS - 1),
+           int64_t(2 * (int(position.y) << scaleShiftY) + int(size.height << scaleShiftY) - 1) << (GED_FIXED_POINT_POSITION_BITS - 1) };
+}
+
+ArrayXXFixedConstMapPair MVReprojection::reprojectMotionVectorSubblocksFixed(const Position &position, const Size &size, const Mv &motionVector,
+                                                                             ComponentID compID, ChromaFormat chromaFormat, int curPOC, int refPOC,
+                                                                             ReprojectionArena &arena) const
+{
+  const Size subblockSize = MVReprojection::subblockSize(compID, chromaFormat);
+  const int scaleShiftX = getComponentScaleX(compID, chromaFormat);
+  const int scaleShiftY = getComponentScaleY(compID, chromaFormat);
+  const int rows = size.height / subblockSize.height;
+  const int cols = size.width / subblockSize.width;
+
+  // Subblock positions and block center in luma samples, the motion vector is in luma samples for all components.
+  const GeodesicFixedPoint::Point origin = { (int64_t(position.x) << (GED_FIXED_POINT_POSITION_BITS + scaleShiftX)) + m_data->m_offset4x4Fixed,
+                                             (int64_t(position.y) << (GED_FIXED_POINT_POSITION_BITS + scaleShiftY)) + m_data->m_offset4x4Fixed };
+  m_data->m_gedFixedPoint.reprojectSubblocks(m_data->m_epipoleList->findEpipoleHandle(curPOC, refPOC), origin, rows, cols, motionVector,
+                                             blockCenterFixed(position, size, scaleShiftX, scaleShiftY), m_data->m_offset4x4Fixed,
+                                             scaleShiftX, scaleShiftY, MV_FRACTIONAL_BITS_INTERNAL + scaleShiftX, MV_FRACTIONAL_BITS_INTERNAL + scaleShiftY,
+                                             arena.m_fixed[0].data(), arena.m_fixed[1].data());
+  return {ArrayXXFixedConstMap(arena.m_fixed[0].data(), rows, cols), ArrayXXFixedConstMap(arena.m_fixed[1].data(), rows, cols)};
+}
+
+void MVReprojection::reprojectSubblockSamples(const Position &position, const Size &size, const Mv &motionVector, MotionModelID motionModelID,
+                                              int curPOC, int refPOC, int numSubblocks, const Position *subblocks, int *xFixed, int *yFixed)
+{
+  CHECK(motionModelID != GEODESIC, "Subblock samples are only supported for motion model 'GEODESIC'.");
+  const Epipole &epipole = m_data->m_epipoleList->findEpipoleHandle(curPOC, refPOC);
+  const int outShift = GED_FIXED_POINT_POSITION_BITS - MV_FRACTIONAL_BITS_INTERNAL;
+
+  if (m_data->m_useGEDFixedPoint) {
+    const GeodesicFixedPoint::Point blockCenter = blockCenterFixed(position, size, 0, 0);
+    for (int i = 0; i < numSubblocks; i++) {
+      const GeodesicFixedPoint::Point point = { (int64_t(position.x + 4 * subblocks[i].x) << GED_FIXED_POINT_POSITION_BITS) + m_data->m_offset4x4Fixed,
+                                                (int64_t(position.y + 4 * subblocks[i].y) << GED_FIXED_POINT_POSITION_BITS) + m_data->m_offset4x4Fixed };
+      GeodesicFixedPoint::Point moved;
+      if (!m_data->m_gedFixedPoint.modelMotionAt(epipole, point, motionVector, MV_FRACTIONAL_BITS_INTERNAL, MV_FRACTIONAL_BITS_INTERNAL, blockCenter, moved)) {
+        moved = point;
+      }
+      xFixed[i] = int((moved.x - m_data->m_offset4x4Fixed + (int64_t(1) << (outShift - 1))) >> outShift);
+      yFixed[i] = int((moved.y - m_data->m_offset4x4Fixed + (int64_t(1) << (outShift - 1))) >> outShift);
+    }
+    return;
+  }
+
+  auto geodesicMotionModel = static_cast<GeodesicMotionModel*>(m_motionModels[motionModelID].get());
+  geodesicMotionModel->setEpipole(epipole);
+  const Array2TCoord mv(TCoord(motionVector.hor) / TCoord(1 << MV_FRACTIONAL_BITS_INTERNAL), TCoord(motionVector.ver) / TCoord(1 << MV_FRACTIONAL_BITS_INTERNAL));
+  const Array2TCoord blockCenter = Array2TCoord(position.x, position.y) + (Array2TCoord(size.width, size.height) - 1) / TCoord(2);
+
+  // Fused reprojection of the selected subblocks from the frame-wide rotated spherical coordinates
+  if (geodesicMotionModel->isFusedReprojectionSupported() && numSubblocks <= GED_FAST_SEARCH_NUM_SAMPLES) {
+    TCoord spherical[3][GED_FAST_SEARCH_NUM_SAMPLES], cart2D[2][GED_FAST_SEARCH_NUM_SAMPLES];
+    for (int i = 0; i < numSubblocks; i++) {
+      ArrayXXTCoordMap sphericalR(&spherical[0][i], 1, 1), sphericalTheta(&spherical[1][i], 1, 1), sphericalPhi(&spherical[2][i], 1, 1);
+      geodesicMotionModel->toRotatedSphereCached(Position(position.x / 4 + subblocks[i].x, position.y / 4 + subblocks[i].y), Size(1, 1),
+                                                 sphericalR, sphericalTheta, sphericalPhi);
+      cart2D[0][i] = TCoord(position.x + 4 * subblocks[i].x) + m_data->m_offset4x4;
+      cart2D[1][i] = TCoord(position.y + 4 * subblocks[i].y) + m_data->m_offset4x4;
+    }
+    GeodesicReprojectionParam param;
+    geodesicMotionModel->fillReprojectionParam(param, mv, blockCenter);
+    param.offset4x4 = m_data->m_offset4x4;
+    param.rescale = false;
+    param.scaleX = 1;
+    param.scaleY = 1;
+    param.fixedScaleHor = TCoord(1 << MV_FRACTIONAL_BITS_INTERNAL);
+    param.fixedScaleVer = TCoord(1 << MV_FRACTIONAL_BITS_INTERNAL);
+    m_geodesicReprojection.m_reprojectSubblocks(spherical[0], spherical[1], spherical[2], cart2D[0], cart2D[1], numSubblocks,
+                                                m_geodesicReprojection.numPacketElements(numSubblocks), param, xFixed, yFixed);
+    return;
+  }
+
+  for (int i = 0; i < numSubblocks; i++) {
+    const Array2TCoord point(TCoord(position.x + 4 * subblocks[i].x) + m_data->m_offset4x4, TCoord(position.y + 4 * subblocks[i].y) + m_data->m_offset4x4);
+    Array2TCoord moved = geodesicMotionModel->modelMotionAt(point, mv, blockCenter);
+    if (std::isnan(moved.x()) || std::isnan(moved.y())) {
+      moved = point;
+    }
+    xFixed[i] = int(std::round((moved.x() - m_data->m_offset4x4) * TCoord(1 << MV_FRACTIONAL_BITS_INTERNAL)));
+    yFixed[i] = int(std::round((moved.y() - m_data->m_offset4x4) * TCoord(1 << MV_FRACTIONAL_BITS_INTERNAL)));
+  }
+}
+
+Mv MVReprojection::motionVectorInDesiredMotionModelFixed(const Position &position, const Mv &motionVectorOrig, MotionModelID motionModelIDOrig,
+                                                         MotionModelID motionModelIDDesired, int shiftHor, int shiftVer,
+                                                         const Epipole &epipoleOrig, const Epipole &epipoleDesired,
+                                                         const Position &candidateBlockPos, const Size &candidateBlockSize,
+                                                         const Position &currentBlockPos, const Size &currentBlockSize) const
+{
+  const GeodesicFixedPoint &gedFixedPoint = m_data->m_gedFixedPoint;
+  const GeodesicFixedPoint::Point point = { int64_t(position.x) << GED_FIXED_POINT_POSITION_BITS, int64_t(position.y) << GED_FIXED_POINT_POSITION_BITS };
+
+  // Motion modeling with original motion model
+  GeodesicFixedPoint::Point shiftedPoint;
+  if (motionModelIDOrig == GEODESIC) {
+    if (!gedFixedPoint.modelMotionAt(epipoleOrig, point, motionVectorOrig, shiftHor, shiftVer, blockCenterFixed(candidateBlockPos, candidateBlockSize, 0, 0), shiftedPoint)) {
+      return {0, 0};
+    }
+  } else {
+    shiftedPoint = { point.x + ((int64_t(motionVectorOrig.hor) << GED_FIXED_POINT_POSITION_BITS) >> shiftHor),
+                     point.y + ((int64_t(motionVectorOrig.ver) << GED_FIXED_POINT_POSITION_BITS) >> shiftVer) };
   }
 
-  // Return fixed precision mv
-  int mvXFixed = static_cast<int>(std::round(mvDesired.x() * TCoord(1 << shiftHor)));
-  int mvYFixed = static_cast<int>(std::round(mvDesired.y() * TCoord(1 << shiftVer)));
-  return {mvXFixed, mvYFixed};
+  // Equivalent motion vector with desired motion model, zero mv if invalid
+  Mv motionVectorDesired(0, 0);
+  if (motionModelIDDesired == GEODESIC) {
+    if (!gedFixedPoint.motionVectorForEquivalentShiftAt(epipoleDesired, point, shiftedPoint, blockCenterFixed(currentBlockPos, currentBlockSize, 0, 0),
+                                                        shiftHor, shiftVer, motionVectorDesired)) {
+      return {0, 0};
+    }
+  } else {
+    const int64_t roundHor = int64_t(1) << (GED_FIXED_POINT_POSITION_BITS - shiftHor - 1);
+    const int64_t roundVer = int64_t(1) << (GED_FIXED_POINT_POSITION_BITS - shiftVer - 1);
+    motionVectorDesired = Mv(int((shiftedPoint.x - point.x + roundHor) >> (GED_FIXED_POINT_POSITION_BITS - shiftHor)),
+                             int((shiftedPoint.y - point.y + roundVer) >> (GED_FIXED_POINT_POSITION_BITS - shiftVer)));
+  }
+  return motionVectorDesired;
 }
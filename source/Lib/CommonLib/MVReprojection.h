@@ -11,35 +11,95 @@
 #include "Picture.h"
 #include "MotionModels/models.h"
 #include "EpipoleList.h"
+#include "GeodesicFixedPoint.h"
+#include "ThreadPool.h"
 
 #include <iomanip>
+#include <memory>
 #include <set>
+#include <vector>
 
+/// Caller-owned scratch memory for allocation-free motion vector reprojection of blocks up to a maximum size.
+class ReprojectionArena {
+public:
+  void create(const Size &maxBlockSize);
+  void destroy();
+  bool isCreated() const { return m_coordinates.isCreated(); }
+
+protected:
+  friend class MVReprojection;
+
+  CoordinateArena m_coordinates;  /**< Floating point coordinate planes */
+  Eigen::ArrayXi m_fixed[2];  /**< Fixed precision moved subblock positions returned as views */
+
+  /// Request the moved subblock positions in m_fixed were derived for; a following component with the same key reuses them
+  struct FieldKey {
+    Position lumaPos;  /**< Block position in luma samples */
+    Size lumaSize;  /**< Block size in luma samples */
+    Mv motionVector;
+    MotionModelID motionModelID;
+    bool chroma;  /**< Derived by the floating point chroma path, which differs from luma */
+    int scaleShiftX, scaleShiftY;
+    const Epipole *epipole;
+    Array3TCoord epipoleCartesian;
+
+    bool operator==(const FieldKey &other) const;
+  };
+  FieldKey m_fieldKey;
+  bool m_fieldValid = false;
+};
+
+
+/// Immutable per-sequence reprojection data, shared read-only by all MVReprojection contexts of encoder or decoder threads.
+class MVReprojectionData {
+public:
+  MVReprojectionData(const Projection *projection, const Size &resolution, const SPS *sps, const EpipoleList *epipoleList);
+
+protected:
+  friend class MVReprojection;
+
+  const Projection *m_projection;
+  const EpipoleList *m_epipoleList;  /**< Link to epipole list */
+  const Size m_resolution;
+  const TCoord m_offset4x4;  /**< Coordinate offset for reprojection within 4x4 subblocks (0.0-3.0) */
+  const GeodesicMotionModel::Flavor m_gedFlavor;
+  std::vector<MotionModelID> m_activeMotionModels;
+  bool m_useGED;  /**< Geodesic motion model is active */
+  const bool m_useGEDFixedPoint;  /**< Geodesic motion model in integer arithmetic (sps_ged_fixed_point_flag) */
+  const int64_t m_offset4x4Fixed;  /**< m_offset4x4 with GED_FIXED_POINT_POSITION_BITS fractional bits */
+  GeodesicFixedPoint m_gedFixedPoint;
+  ArrayXXTCoordPtr m_cart2DProj[2];  /**< Cartesian coordinates of the 4x4 subblocks of the original image */
+  std::shared_ptr<RotatedSphereTables> m_rotatedSphereTables;  /**< Frame-wide GED coordinate tables per epipole (thread-safe) */
+};
+
+
+/// Reprojection context with the motion models and caches of one thread. Contexts on the same MVReprojectionData may be used concurrently.
 class MVReprojection {
 
 public:
 
-  MVReprojection(): m_projection(nullptr), m_offset4x4(0) {};
-  ~MVReprojection() {
-    for (auto & motionModel : m_motionModels) {
-      if(motionModel) {
-        // TODO: Delete motion model
-        motionModel = nullptr;
-      }
-    }
-  }
+  MVReprojection(): m_initialized(false) {};
 
+  /** @brief Create the shared sequence data and a context on it. */
   void init(const Projection *projection, const Size &resolution, const SPS *sps, const EpipoleList* epipoleList);
+  /** @brief Create a context on existing shared sequence data, e.g., for another thread. */
+  void init(const std::shared_ptr<const MVReprojectionData> &data);
   bool isInitialized() const { return m_initialized; }
-  MotionModel* getMotionModel(MotionModelID id) { return m_motionModels[id]; }
+  const std::shared_ptr<const MVReprojectionData>& getData() const { return m_data; }
+  MotionModel* getMotionModel(MotionModelID id) { return m_motionModels[id].get(); }
 
-protected:
-  void fillCache();
+  /** @brief Limit the memory for the frame-wide GED coordinate tables in bytes (0: default). */
+  void setTableBudget(size_t budgetBytes);
+  /** @brief Build the frame-wide GED coordinate tables for the epipoles of all reference pictures of the slice ahead of the CTU loop. */
+  void prepareTables(const Slice &slice, ThreadPool *threadPool);
 
 public:
   static Size subblockSize(ComponentID compID, ChromaFormat chromaFormat);
 
   /** @brief Reproject the motion vector on 4x4 subblocks (luma) or corresponding scaled subblocks (chroma).
+   *
+   * The components of a block are meant to be reprojected one after the other with the same arena: the field of Cb is
+   * reused for Cr, and with the integer GED the field of luma is reused for both chroma components.
    *
    * @param position Block origin position
    * @param size Block size
@@ -49,33 +109,73 @@ public:
    * @param chromaFormat Chroma format (e.g., 400, 422, 420, 444)
    * @param curPOC Picture order count of current frame for epipole selection
    * @param refPOC Picture order count of reference frame for epipole selection
+   * @param arena Scratch memory; the returned views stay valid until the next call with the same arena
    * @return Moved subblock origin positions with horizontal and vertical precision according to componentScaleX/Y for component id and chroma format
    */
-  ArrayXXFixedPtrPair reprojectMotionVectorSubblocks(const Position &position, const Size &size,
-                                                     const Mv &motionVector,
-                                                     MotionModelID motionModelID,
-                                                     ComponentID compID, ChromaFormat chromaFormat,
-                                                     int curPOC, int refPOC);
+  ArrayXXFixedConstMapPair reprojectMotionVectorSubblocks(const Position &position, const Size &size,
+                                                          const Mv &motionVector,
+                                                          MotionModelID motionModelID,
+                                                          ComponentID compID, ChromaFormat chromaFormat,
+                                                          int curPOC, int refPOC,
+                                                          ReprojectionArena &arena);
+
+  /** @brief Reproject the motion vector on selected 4x4 luma subblocks only, e.g., for cost estimates in the motion search.
+   *
+   * @param subblocks Subblock positions within the block in subblock units
+   * @param xFixed, yFixed Moved subblock origin positions with MV_FRACTIONAL_BITS_INTERNAL precision, same as reprojectMotionVectorSubblocks
+   */
+  void reprojectSubblockSamples(const Position &position, const Size &size, const Mv &motionVector, MotionModelID motionModelID,
+                                int curPOC, int refPOC, int numSubblocks, const Position *subblocks, int *xFixed, int *yFixed);
 
   /** @brief Find the motion vector in the desired motion model that leads to the same motion vector at position as the original motion vector in the original motion model. */
   Mv motionVectorInDesiredMotionModel(const Position &position, const Mv &motionVectorOrig, MotionModelID motionModelIDOrig,
                                       MotionModelID motionModelIDDesired, int shiftHor, int shiftVer,
                                       int curPOCOrig, int refPOCOrig, int curPOCDesired, int refPOCDesired,
                                       const Position &candidateBlockPos, const Size &candidateBlockSize,
-                                      const Position &currentBlockPos, const Size &currentBlockSize) const;
+                                      const Position &currentBlockPos, const Size &currentBlockSize);
 
 protected:
-  const Projection *m_projection;
-  MotionModel* m_motionModels[NUM_MODELS];
-  const EpipoleList* m_epipoleList;  /**< Link to epipole list */
+  /** @brief Integer GED reprojection of the subblocks, see reprojectMotionVectorSubblocks. */
+  ArrayXXFixedConstMapPair reprojectMotionVectorSubblocksFixed(const Position &position, const Size &size, const Mv &motionVector,
+                                                               ComponentID compID, ChromaFormat chromaFormat, int curPOC, int refPOC,
+                                                               ReprojectionArena &arena) const;
+  /** @brief Integer equivalent motion vector derivation, see motionVectorInDesiredMotionModel. */
+  Mv motionVectorInDesiredMotionModelFixed(const Position &position, const Mv &motionVectorOrig, MotionModelID motionModelIDOrig,
+                                           MotionModelID motionModelIDDesired, int shiftHor, int shiftVer,
+                                           const Epipole &epipoleOrig, const Epipole &epipoleDesired,
+                                           const Position &candidateBlockPos, const Size &candidateBlockSize,
+                                           const Position &currentBlockPos, const Size &currentBlockSize) const;
+  void storeEquivalentMv(const Position &position, const Mv &motionVectorOrig, MotionModelID motionModelIDOrig,
+                         MotionModelID motionModelIDDesired, int shiftHor, int shiftVer,
+                         const Position &candidateBlockPos, const Size &candidateBlockSize,
+                         const Epipole &epipoleOrig, const Epipole &epipoleDesired, const Mv &motionVectorDesired);
+
+  std::shared_ptr<const MVReprojectionData> m_data;
+  std::unique_ptr<MotionModel> m_motionModels[NUM_MODELS];  /**< Motion models with the current epipole of this context */
   bool m_initialized;
 
-  Size m_resolution;
-  TCoord m_offset4x4; /**< Coordinate offset for reprojection within 4x4 subblocks (0.0-3.0) */
-  ArrayXXTCoordPtr m_cart2DProj[2];  /**< Cache for cartesian coordinates of pixels in original image */
+  GeodesicReprojection m_geodesicReprojection;  /**< Fused GED reprojection for the equirectangular projection */
 
-  /** Encoder luma caching */
-  Position m_lastPosition;  /**< Last cached block position */
-  Size m_lastSize;  /**< Last cached block size */
-  ArrayXXTCoordPtr m_lastCart2DProj[2];  /**< Cartesian coordinates in original image of last block with position and size */
+  /// Memo of equivalent motion vectors derived for the candidate lists of the current block
+  struct EquivalentMvMemo {
+    struct Entry {
+      Position position;
+      Mv motionVectorOrig;
+      MotionModelID motionModelIDOrig;
+      MotionModelID motionModelIDDesired;
+      int shiftHor;
+      int shiftVer;
+      Position candidateBlockPos;
+      Size candidateBlockSize;
+      Array3TCoord epipoleOrig;
+      Array3TCoord epipoleDesired;
+      Mv motionVectorDesired;
+    };
+    Position blockPos;
+    Size blockSize;
+    Entry entries[GED_EQUIVALENT_MV_MEMO_SIZE];
+    int numEntries = 0;
+    int nextEntry = 0;
+  };
+  EquivalentMvMemo m_equivalentMvMemo;
 };
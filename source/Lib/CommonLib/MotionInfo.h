@@ -156,6 +156,36 @@ struct MvField
   }
 };
 
+/// luma position of the block of a motion vector (GED motion model), stored in 4 bytes per entry of the motion buffers
+struct MotionBlockPos
+{
+  uint16_t x;
+  uint16_t y;
+
+  MotionBlockPos()                    : x(0), y(0) { }
+  MotionBlockPos(const Position &pos) : x(uint16_t(pos.x)), y(uint16_t(pos.y))
+  {
+    CHECKD(pos.x < 0 || pos.y < 0 || pos.x > UINT16_MAX || pos.y > UINT16_MAX, "Block position exceeds the range of the motion storage");
+  }
+
+  operator Position() const { return Position(x, y); }
+};
+
+/// luma size of the block of a motion vector (GED motion model), stored in 2 bytes per entry of the motion buffers
+struct MotionBlockSize
+{
+  uint8_t width;
+  uint8_t height;
+
+  MotionBlockSize()                  : width(0), height(0) { }
+  MotionBlockSize(const Size &size)  : width(uint8_t(size.width)), height(uint8_t(size.height))
+  {
+    CHECKD(size.width > UINT8_MAX || size.height > UINT8_MAX, "Block size exceeds the range of the motion storage");
+  }
+
+  operator Size() const { return Size(width, height); }
+};
+
 struct MotionInfo
 {
   bool     isInter;
@@ -168,8 +198,8 @@ struct MotionInfo
   MotionModelID motionModel[ NUM_REF_PIC_LIST_01 ];
   uint8_t  bcwIdx;
   Mv       bv;
-  Position blockPos[ NUM_REF_PIC_LIST_01 ];
-  Size     blockSize[ NUM_REF_PIC_LIST_01 ];
+  MotionBlockPos  blockPos[ NUM_REF_PIC_LIST_01 ];
+  MotionBlockSize blockSize[ NUM_REF_PIC_LIST_01 ];
 #if GDR_ENABLED
   bool      sourceClean;  // source Position is clean/dirty
   Position  sourcePos;    // source Position of Mv
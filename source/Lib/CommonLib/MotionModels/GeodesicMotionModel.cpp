@@ -4,51 +4,153 @@
 
 #include "GeodesicMotionModel.h"
 
+#include <algorithm>
 #include <cmath>
 
-void GeodesicMotionModel::fillCache(const ArrayXXTCoordPtrPair &cart2DProj)
-{
-  m_cachedCart2DProj = cart2DProj;
-}
-
 void GeodesicMotionModel::setEpipole(const Array3TCoord &epipole)
 {
   // Avoid recalculating the rotation matrix if not necessary.
-  if ((epipole == m_epipole).all()) {
+  if ((epipole == m_epipole.cartesian).all()) {
     return;
   }
+  m_epipole = Epipole(epipole);
+}
 
+void GeodesicMotionModel::setEpipole(const Epipole &epipole)
+{
   m_epipole = epipole;
+}
 
-  // Calculate rotation matrix to rotate default north pole (0, 0, 1) to desired north pole using
-  // rodrigues rotation formula
-  const auto polarAxisNormalized =
-    epipole / std::sqrt((epipole.x() * epipole.x() + epipole.y() * epipole.y() + epipole.z() * epipole.z()));
-  const auto cart3DCross = Array3TCoord(-polarAxisNormalized.y(), polarAxisNormalized.x(), 0);
-  const auto s = std::sqrt(cart3DCross.x() * cart3DCross.x() + cart3DCross.y() * cart3DCross.y() + cart3DCross.z() * cart3DCross.z());
-  if (s == 0) {  // epipole is parallel to current north pole.
-    m_rotationMatrix = Eigen::Matrix<TCoord, 3, 3>::Identity();
-    if (polarAxisNormalized.z() < 0) {
-      m_rotationMatrix(2, 2) = -1;
-    }
+RotatedSphereTables::RotatedSphereTables(const Projection *projection, const ArrayXXTCoordPtrPair &cart2DProj):
+  m_projection(projection), m_cart2DProj(cart2DProj), m_capacity(GED_ROTATED_SPHERE_CACHE_SIZE)
+{
+}
+
+void RotatedSphereTables::setBudget(size_t budgetBytes)
+{
+  std::unique_lock<std::mutex> lock(m_mutex);
+  if (budgetBytes == 0) {
+    m_capacity = GED_ROTATED_SPHERE_CACHE_SIZE;
   } else {
-    const auto c = std::max(TCoord(-1), std::min(TCoord(1), polarAxisNormalized.z()));
-    auto cart3DCrossSkew = Eigen::Matrix<TCoord, 3, 3>::Zero().eval();
-    cart3DCrossSkew(0, 1) = -cart3DCross.z();
-    cart3DCrossSkew(0, 2) = cart3DCross.y();
-    cart3DCrossSkew(1, 0) = cart3DCross.z();
-    cart3DCrossSkew(1, 2) = -cart3DCross.x();
-    cart3DCrossSkew(2, 0) = -cart3DCross.y();
-    cart3DCrossSkew(2, 1) = cart3DCross.x();
-    m_rotationMatrix = Eigen::Matrix<TCoord, 3, 3>::Identity() + cart3DCrossSkew + (cart3DCrossSkew*cart3DCrossSkew) * ((1-c) / (s*s));
-    m_rotationMatrix.transposeInPlace();
+    const size_t planesBytes = 3 * size_t(m_cart2DProj.first->size()) * sizeof(TCoord);
+    m_capacity = std::max<size_t>(1, budgetBytes / planesBytes);
+  }
+  while (m_planes.size() > m_capacity) {
+    m_planes.pop_back();
+  }
+}
+
+RotatedSphereTables::PlanesPtr RotatedSphereTables::get(const Epipole &epipole)
+{
+  std::unique_lock<std::mutex> lock(m_mutex);
+  for (auto iter = m_planes.begin(); iter != m_planes.end(); ++iter) {
+    if (((*iter)->epipole == epipole.cartesian).all()) {
+      // Move to front to keep the most recently used epipoles.
+      if (iter != m_planes.begin()) {
+        std::shared_ptr<Planes> planes = *iter;
+        m_planes.erase(iter);
+        m_planes.push_front(planes);
+      }
+      return m_planes.front();
+    }
+  }
+
+  // Rotate the 4x4 subblock grid of the whole frame once for the new epipole.
+  std::shared_ptr<Planes> planes = allocatePlanes(epipole);
+  computePlanes(epipole, *planes, 0, int(m_cart2DProj.first->cols()));
+  m_planes.push_front(planes);
+  if (m_planes.size() > m_capacity) {
+    m_planes.pop_back();
+  }
+  return planes;
+}
+
+void RotatedSphereTables::prepare(const std::vector<const Epipole*> &epipoles, ThreadPool *threadPool)
+{
+  std::unique_lock<std::mutex> lock(m_mutex);
+
+  // Requested epipoles first, already computed planes are reused.
+  std::deque<std::shared_ptr<Planes>> planesList;
+  std::vector<const Epipole*> missing;
+  for (const Epipole *epipole : epipoles) {
+    if (planesList.size() == m_capacity) {
+      break;
+    }
+    auto isEpipole = [epipole](const std::shared_ptr<Planes> &planes) { return (planes->epipole == epipole->cartesian).all(); };
+    if (std::any_of(planesList.begin(), planesList.end(), isEpipole)) {
+      continue;
+    }
+    auto iter = std::find_if(m_planes.begin(), m_planes.end(), isEpipole);
+    if (iter != m_planes.end()) {
+      planesList.push_back(*iter);
+      m_planes.erase(iter);
+    } else {
+      planesList.push_back(allocatePlanes(*epipole));
+      missing.push_back(epipole);
+    }
+  }
+
+  // Column chunks with a multiple of four elements keep the packet/scalar split of Eigen identical to the frame-wide evaluation.
+  const int cols = int(m_cart2DProj.first->cols());
+  int chunkCols = cols;
+  if (threadPool) {
+    chunkCols = std::min(cols, std::max(4, ((cols + threadPool->numThreads() - 1) / threadPool->numThreads() + 3) & ~3));
+  }
+  const int numChunks = (cols + chunkCols - 1) / chunkCols;
+  const size_t numComputed = planesList.size() - missing.size();
+
+  ThreadPool::parallelFor(threadPool, 0, int(missing.size()) * numChunks, [&](int task) {
+    const int index = task / numChunks;
+    const int startCol = (task % numChunks) * chunkCols;
+    computePlanes(*missing[index], *planesList[numComputed + index], startCol, std::min(chunkCols, cols - startCol));
+  });
+
+  // Least recently used planes of other epipoles fill the remaining capacity.
+  for (auto &planes : m_planes) {
+    if (planesList.size() == m_capacity) {
+      break;
+    }
+    planesList.push_back(planes);
+  }
+  m_planes.swap(planesList);
+}
+
+std::shared_ptr<RotatedSphereTables::Planes> RotatedSphereTables::allocatePlanes(const Epipole &epipole) const
+{
+  std::shared_ptr<Planes> planes = std::make_shared<Planes>();
+  planes->epipole = epipole.cartesian;
+  for (auto &plane : planes->spherical) {
+    plane = std::make_shared<ArrayXXTCoord>(m_cart2DProj.first->rows(), m_cart2DProj.first->cols());
+  }
+  return planes;
+}
+
+void RotatedSphereTables::computePlanes(const Epipole &epipole, Planes &planes, int startCol, int numCols) const
+{
+  const ArrayXXTCoordPtrPair cart2D(std::make_shared<ArrayXXTCoord>(m_cart2DProj.first->middleCols(startCol, numCols)),
+                                    std::make_shared<ArrayXXTCoord>(m_cart2DProj.second->middleCols(startCol, numCols)));
+  const auto spherical = GeodesicMotionModel::toRotatedSphere(m_projection, cart2D, epipole);
+  planes.spherical[0]->middleCols(startCol, numCols) = *std::get<0>(spherical);
+  planes.spherical[1]->middleCols(startCol, numCols) = *std::get<1>(spherical);
+  planes.spherical[2]->middleCols(startCol, numCols) = *std::get<2>(spherical);
+}
+
+void GeodesicMotionModel::updateRotatedSphereCache()
+{
+  if (!m_rotatedSpherePlanes || !(m_rotatedSpherePlanes->epipole == m_epipole.cartesian).all()) {
+    m_rotatedSpherePlanes = m_rotatedSphereTables->get(m_epipole);
   }
 }
 
 ArrayXXTCoordPtrTriple GeodesicMotionModel::toRotatedSphere(const ArrayXXTCoordPtrPair &cart2D) const
+{
+  return toRotatedSphere(m_projection, cart2D, m_epipole);
+}
+
+ArrayXXTCoordPtrTriple GeodesicMotionModel::toRotatedSphere(const Projection *projection, const ArrayXXTCoordPtrPair &cart2D, const Epipole &epipole)
 {
   // To sphere
-  const auto cart3D = m_projection->toSphere(cart2D);
+  const auto cart3D = projection->toSphere(cart2D);
 
   const auto rows = std::get<0>(cart3D)->rows();
   const auto cols = std::get<0>(cart3D)->cols();
@@ -63,7 +165,7 @@ ArrayXXTCoordPtrTriple GeodesicMotionModel::toRotatedSphere(const ArrayXXTCoordP
   cart3DFlatStacked << cart3DXFlat, cart3DYFlat, cart3DZFlat;
 
   // - Apply rotation matrix
-  const auto cart3DRotFlatStacked = m_rotationMatrix * cart3DFlatStacked;
+  const auto cart3DRotFlatStacked = epipole.rotation * cart3DFlatStacked;
 
   // Unstack and reshape
   const auto cart3DXRot = std::make_shared<ArrayXXTCoord>(Eigen::Map<const ArrayXXTCoord>(cart3DRotFlatStacked.row(0).eval().data(), rows, cols));
@@ -89,7 +191,7 @@ ArrayXXTCoordPtrPair GeodesicMotionModel::fromRotatedSphere(const ArrayXXTCoordP
   Eigen::Matrix<TCoord, 3, Eigen::Dynamic> cart3DRotMovedFlatStacked(Eigen::Index(3), N);
   cart3DRotMovedFlatStacked << cart3DXRotMovedFlat, cart3DYRotMovedFlat, cart3DZRotMovedFlat;
 
-  const auto cart3DMovedFlatStacked = m_rotationMatrix.transpose() * cart3DRotMovedFlatStacked;
+  const auto cart3DMovedFlatStacked = m_epipole.inverseRotation * cart3DRotMovedFlatStacked;
 
   const auto cart3DXMoved = std::make_shared<ArrayXXTCoord>(Eigen::Map<const ArrayXXTCoord>(cart3DMovedFlatStacked.row(0).eval().data(), rows, cols));
   const auto cart3DYMoved = std::make_shared<ArrayXXTCoord>(Eigen::Map<const ArrayXXTCoord>(cart3DMovedFlatStacked.row(1).eval().data(), rows, cols));
@@ -98,55 +200,115 @@ ArrayXXTCoordPtrPair GeodesicMotionModel::fromRotatedSphere(const ArrayXXTCoordP
   return m_projection->fromSphere({cart3DXMoved, cart3DYMoved, cart3DZMoved});
 }
 
+void GeodesicMotionModel::toRotatedSphere(const ArrayXXTCoordMap &cart2DX, const ArrayXXTCoordMap &cart2DY,
+                                          ArrayXXTCoordMap &sphericalR, ArrayXXTCoordMap &sphericalTheta, ArrayXXTCoordMap &sphericalPhi, CoordinateArena &arena) const
+{
+  CoordinateArena::Scope scope(arena);
+  ArrayXXTCoordMap cart3DX = arena.acquire(cart2DX.rows(), cart2DX.cols());
+  ArrayXXTCoordMap cart3DY = arena.acquire(cart2DX.rows(), cart2DX.cols());
+  ArrayXXTCoordMap cart3DZ = arena.acquire(cart2DX.rows(), cart2DX.cols());
+
+  // To sphere, rotation to obtain desired epipole and to spherical coordinates with desired epipole
+  m_projection->toSphere(cart2DX, cart2DY, cart3DX, cart3DY, cart3DZ, arena);
+  CoordinateConversion::rotate(m_epipole.rotation, cart3DX, cart3DY, cart3DZ, arena);
+  CoordinateConversion::cartesianToSpherical(cart3DX, cart3DY, cart3DZ, sphericalR, sphericalTheta, sphericalPhi);
+}
+
+void GeodesicMotionModel::fromRotatedSphere(const ArrayXXTCoordMap &sphericalR, const ArrayXXTCoordMap &sphericalTheta, const ArrayXXTCoordMap &sphericalPhi,
+                                            ArrayXXTCoordMap &cart2DX, ArrayXXTCoordMap &cart2DY, CoordinateArena &arena) const
+{
+  CoordinateArena::Scope scope(arena);
+  ArrayXXTCoordMap cart3DX = arena.acquire(sphericalR.rows(), sphericalR.cols());
+  ArrayXXTCoordMap cart3DY = arena.acquire(sphericalR.rows(), sphericalR.cols());
+  ArrayXXTCoordMap cart3DZ = arena.acquire(sphericalR.rows(), sphericalR.cols());
+
+  // Back to cartesian, undo rotation to desired epipole and project back to 2D image plane
+  CoordinateConversion::sphericalToCartesian(sphericalR, sphericalTheta, sphericalPhi, cart3DX, cart3DY, cart3DZ);
+  CoordinateConversion::rotate(m_epipole.inverseRotation, cart3DX, cart3DY, cart3DZ, arena);
+  m_projection->fromSphere(cart3DX, cart3DY, cart3DZ, cart2DX, cart2DY, arena);
+}
+
 ArrayXXTCoordPtr GeodesicMotionModel::modelGeodesicMotion(const ArrayXXTCoordPtr &theta, const TCoord motionVectorX, const Array2TCoord &blockCenter) const
 {
-  ArrayXXTCoordPtr thetaMoved;
+  ArrayXXTCoordPtr thetaMoved = std::make_shared<ArrayXXTCoord>(*theta);
+  ArrayXXTCoordMap thetaMovedMap(thetaMoved->data(), thetaMoved->rows(), thetaMoved->cols());
+  modelGeodesicMotion(thetaMovedMap, motionVectorX, blockCenter);
+  return thetaMoved;
+}
+
+void GeodesicMotionModel::modelGeodesicMotion(ArrayXXTCoordMap &theta, const TCoord motionVectorX, const Array2TCoord &blockCenter) const
+{
   switch (m_flavor)
   {
   case VISHWANATH_ORIGINAL:
   {
-    thetaMoved = std::make_shared<ArrayXXTCoord>(*theta + m_angleResolution * motionVectorX);
+    theta = theta + m_angleResolution * motionVectorX;
     break;
   }
   case VISHWANATH_MODULATED:
   {
-    // Block center to rotated sphere to calculate parameter 'k' for geodesic motion modulation
-    const auto cart3DCenter = m_projection->toSphere(blockCenter);
-    const Array3TCoord cart3DCenterRot =
-      m_rotationMatrix * Eigen::Matrix<TCoord, 3, 1>(cart3DCenter.x(), cart3DCenter.y(), cart3DCenter.z());
-    const auto sphericalCenter = CoordinateConversion::cartesianToSpherical(cart3DCenterRot);
-    const TCoord k = std::sin(sphericalCenter.coeff(1) + m_angleResolution * motionVectorX)
-                     / std::sin(m_angleResolution * motionVectorX);
-    const auto deltaTheta = (theta->sin() / (k - theta->cos())).atan().eval();
-    thetaMoved = std::make_shared<ArrayXXTCoord>(*theta + deltaTheta);
+    const TCoord k = modulationFactor(motionVectorX, blockCenter);
+    theta = theta + (theta.sin() / (k - theta.cos())).atan();
     break;
   }
   case REGENSKY_GEO_GLOBAL:
   {
     // Global zylinder radius = 1
-    TCoord deltaZ = 1 / std::tan(TCoord(M_PI_2) + m_angleResolution);
-    const ArrayXXTCoord cylindricalZ = 1 / theta->tan();
-    const ArrayXXTCoord cylindricalZMoved = cylindricalZ + deltaZ * motionVectorX;
-    thetaMoved = std::make_shared<ArrayXXTCoord>(cylindricalZMoved.unaryExpr([](TCoord z) { return TCoord(std::atan2(1, z)); }));
+    const TCoord deltaZ = cylindricalDeltaZ();
+    theta = (1 / theta.tan() + deltaZ * motionVectorX).unaryExpr([](TCoord z) { return TCoord(std::atan2(1, z)); });
     break;
   }
   case REGENSKY_GEO_BLOCK:
   {
     // Adapting the cylinder radius to block center on sphere
-    const auto cart3DCenter = m_projection->toSphere(blockCenter);
-    const Array3TCoord cart3DCenterRot =
-      m_rotationMatrix * Eigen::Matrix<TCoord, 3, 1>(cart3DCenter.x(), cart3DCenter.y(), cart3DCenter.z());
-    const auto sphericalCenter = CoordinateConversion::cartesianToSpherical(cart3DCenterRot);
-
-    const auto cylindricalRadius = std::sin(sphericalCenter.coeff(1));
-    TCoord deltaZ = 1 / std::tan(TCoord(M_PI_2) + m_angleResolution);
-    const ArrayXXTCoord cylindricalZ = cylindricalRadius / theta->tan();
-    const ArrayXXTCoord cylindricalZMoved = cylindricalZ + deltaZ * motionVectorX;
-    thetaMoved = std::make_shared<ArrayXXTCoord>(cylindricalZMoved.unaryExpr([cylindricalRadius](TCoord z) { return TCoord(std::atan2(cylindricalRadius, z)); }));
+    const TCoord radius = cylindricalRadius(blockCenter);
+    const TCoord deltaZ = cylindricalDeltaZ();
+    theta = (radius / theta.tan() + deltaZ * motionVectorX).unaryExpr([radius](TCoord z) { return TCoord(std::atan2(radius, z)); });
     break;
   }
   }
-  return thetaMoved;
+}
+
+TCoord GeodesicMotionModel::modelGeodesicMotion(TCoord theta, const TCoord motionVectorX, const Array2TCoord &blockCenter) const
+{
+  switch (m_flavor)
+  {
+  case VISHWANATH_ORIGINAL:
+    return theta + m_angleResolution * motionVectorX;
+  case VISHWANATH_MODULATED:
+  {
+    const TCoord k = modulationFactor(motionVectorX, blockCenter);
+    return theta + std::atan(std::sin(theta) / (k - std::cos(theta)));
+  }
+  case REGENSKY_GEO_GLOBAL:
+    return TCoord(std::atan2(1, 1 / std::tan(theta) + cylindricalDeltaZ() * motionVectorX));
+  case REGENSKY_GEO_BLOCK:
+  {
+    const TCoord radius = cylindricalRadius(blockCenter);
+    return TCoord(std::atan2(radius, radius / std::tan(theta) + cylindricalDeltaZ() * motionVectorX));
+  }
+  }
+  return theta;
+}
+
+TCoord GeodesicMotionModel::modulationFactor(const TCoord motionVectorX, const Array2TCoord &blockCenter) const
+{
+  // Block center to rotated sphere to calculate parameter 'k' for geodesic motion modulation
+  const auto cart3DCenter = m_projection->toSphere(blockCenter);
+  const Array3TCoord cart3DCenterRot =
+    m_epipole.rotation * Eigen::Matrix<TCoord, 3, 1>(cart3DCenter.x(), cart3DCenter.y(), cart3DCenter.z());
+  const auto sphericalCenter = CoordinateConversion::cartesianToSpherical(cart3DCenterRot);
+  return std::sin(sphericalCenter.coeff(1) + m_angleResolution * motionVectorX)
+         / std::sin(m_angleResolution * motionVectorX);
+}
+
+TCoord GeodesicMotionModel::cylindricalRadius(const Array2TCoord &blockCenter) const
+{
+  const auto cart3DCenter = m_projection->toSphere(blockCenter);
+  const Array3TCoord cart3DCenterRot =
+    m_epipole.rotation * Eigen::Matrix<TCoord, 3, 1>(cart3DCenter.x(), cart3DCenter.y(), cart3DCenter.z());
+  const auto sphericalCenter = CoordinateConversion::cartesianToSpherical(cart3DCenterRot);
+  return std::sin(sphericalCenter.coeff(1));
 }
 
 ArrayXXTCoordPtrPair GeodesicMotionModel::modelMotion(ArrayXXTCoordPtrPair cart2D, const Array2TCoord &motionVector, const Array2TCoord &blockCenter) const
@@ -166,49 +328,117 @@ ArrayXXTCoordPtrPair GeodesicMotionModel::modelMotion(ArrayXXTCoordPtrPair cart2
   return fromRotatedSphere(spherical);
 }
 
-ArrayXXTCoordPtrPair GeodesicMotionModel::modelMotionCached(const Position &position, const Size &size, const Array2TCoord &motionVector, const Array2TCoord &blockCenter)
+void GeodesicMotionModel::modelMotion(const ArrayXXTCoordMap &cart2DX, const ArrayXXTCoordMap &cart2DY, ArrayXXTCoordMap &cart2DXMoved, ArrayXXTCoordMap &cart2DYMoved,
+                                      const Array2TCoord &motionVector, const Array2TCoord &blockCenter, CoordinateArena &arena) const
 {
-  // To motion plane
-  ArrayXXTCoordPtr sphericalR;
-  ArrayXXTCoordPtr sphericalTheta;
-  ArrayXXTCoordPtr sphericalPhi;
-  if (position == m_cachedPosition && size == m_cachedSize && (m_epipole == m_cachedEpipole).all()) {
-    sphericalR = m_cachedSpherical[0];
-    sphericalTheta = m_cachedSpherical[1];
-    sphericalPhi = m_cachedSpherical[2];
-  } else {
-    const auto cart2DProjX = std::make_shared<ArrayXXTCoord>(std::get<0>(m_cachedCart2DProj)->block(position.y, position.x, size.height, size.width));
-    const auto cart2DProjY = std::make_shared<ArrayXXTCoord>(std::get<1>(m_cachedCart2DProj)->block(position.y, position.x, size.height, size.width));
-    const auto spherical = toRotatedSphere({ cart2DProjX, cart2DProjY });
-    sphericalR = std::get<0>(spherical);
-    sphericalTheta = std::get<1>(spherical);
-    sphericalPhi = std::get<2>(spherical);
-    m_cachedPosition = position;
-    m_cachedSize = size;
-    m_cachedEpipole = m_epipole;
-    m_cachedSpherical[0] = sphericalR;
-    m_cachedSpherical[1] = sphericalTheta;
-    m_cachedSpherical[2] = sphericalPhi;
+  if (motionVector.x() == 0 && motionVector.y() == 0) {
+    cart2DXMoved = cart2DX;
+    cart2DYMoved = cart2DY;
+    return;
   }
 
+  CoordinateArena::Scope scope(arena);
+  ArrayXXTCoordMap sphericalR = arena.acquire(cart2DX.rows(), cart2DX.cols());
+  ArrayXXTCoordMap sphericalTheta = arena.acquire(cart2DX.rows(), cart2DX.cols());
+  ArrayXXTCoordMap sphericalPhi = arena.acquire(cart2DX.rows(), cart2DX.cols());
+
+  // Block to rotated sphere
+  toRotatedSphere(cart2DX, cart2DY, sphericalR, sphericalTheta, sphericalPhi, arena);
+
+  // Model motion
+  modelGeodesicMotion(sphericalTheta, motionVector.x(), blockCenter);
+  sphericalPhi = sphericalPhi + m_angleResolution * motionVector.y();
+
+  // Back to cartesian, undo rotation to desired epipole and project back to 2D image plane
+  fromRotatedSphere(sphericalR, sphericalTheta, sphericalPhi, cart2DXMoved, cart2DYMoved, arena);
+}
+
+void GeodesicMotionModel::toRotatedSphereCached(const Position &position, const Size &size,
+                                                ArrayXXTCoordMap &sphericalR, ArrayXXTCoordMap &sphericalTheta, ArrayXXTCoordMap &sphericalPhi)
+{
+  updateRotatedSphereCache();
+  const RotatedSphereTables::Planes &planes = *m_rotatedSpherePlanes;
+
+  sphericalR = planes.spherical[0]->block(position.y, position.x, size.height, size.width);
+  sphericalTheta = planes.spherical[1]->block(position.y, position.x, size.height, size.width);
+  sphericalPhi = planes.spherical[2]->block(position.y, position.x, size.height, size.width);
+}
+
+void GeodesicMotionModel::modelMotionCached(const Position &position, const Size &size, ArrayXXTCoordMap &cart2DXMoved, ArrayXXTCoordMap &cart2DYMoved,
+                                            const Array2TCoord &motionVector, const Array2TCoord &blockCenter, CoordinateArena &arena)
+{
+  // To motion plane
+  CoordinateArena::Scope scope(arena);
+  ArrayXXTCoordMap sphericalR = arena.acquire(size.height, size.width);
+  ArrayXXTCoordMap sphericalTheta = arena.acquire(size.height, size.width);
+  ArrayXXTCoordMap sphericalPhi = arena.acquire(size.height, size.width);
+  toRotatedSphereCached(position, size, sphericalR, sphericalTheta, sphericalPhi);
+
   // Model Motion
-  const ArrayXXTCoordPtr sphericalThetaMoved = modelGeodesicMotion(sphericalTheta, motionVector.x(), blockCenter);
-  const ArrayXXTCoordPtr sphericalPhiMoved = std::make_shared<ArrayXXTCoord>(*sphericalPhi + m_angleResolution * motionVector.y());
+  modelGeodesicMotion(sphericalTheta, motionVector.x(), blockCenter);
+  sphericalPhi = sphericalPhi + m_angleResolution * motionVector.y();
+
+  // Back to cartesian, undo rotation to desired epipole and project back to 2D image plane
+  fromRotatedSphere(sphericalR, sphericalTheta, sphericalPhi, cart2DXMoved, cart2DYMoved, arena);
+}
+
+bool GeodesicMotionModel::isFusedReprojectionSupported() const
+{
+  return m_equirectangularProjection != nullptr && (m_flavor == REGENSKY_GEO_GLOBAL || m_flavor == REGENSKY_GEO_BLOCK);
+}
+
+void GeodesicMotionModel::fillReprojectionParam(GeodesicReprojectionParam &param, const Array2TCoord &motionVector, const Array2TCoord &blockCenter) const
+{
+  CHECKD(!isFusedReprojectionSupported(), "Fused reprojection is not supported for this projection or flavor.");
+
+  param.globalCylinder = m_flavor == REGENSKY_GEO_GLOBAL;
+  param.cylindricalRadius = param.globalCylinder ? TCoord(1) : cylindricalRadius(blockCenter);
+  param.cylindricalShift = cylindricalDeltaZ() * motionVector.x();
+  param.phiShift = m_angleResolution * motionVector.y();
+  for (int row = 0; row < 3; row++) {
+    for (int col = 0; col < 3; col++) {
+      param.inverseRotation[row][col] = m_epipole.inverseRotation(row, col);
+    }
+  }
+
+  param.width = TCoord(m_equirectangularProjection->resolution().width);
+  param.height = TCoord(m_equirectangularProjection->resolution().height);
+  param.pixelOffset = m_equirectangularProjection->pixelOffset();
+}
+
+Array2TCoord GeodesicMotionModel::modelMotionAt(const Array2TCoord &cart2D, const Array2TCoord &motionVector, const Array2TCoord &blockCenter) const
+{
+  if (motionVector.x() == 0 && motionVector.y() == 0) {
+    return cart2D;
+  }
+
+  // Point to rotated sphere
+  const auto cart3D = m_projection->toSphere(cart2D);
+  const Array3TCoord cart3DRot = m_epipole.rotation * Eigen::Matrix<TCoord, 3, 1>(cart3D.x(), cart3D.y(), cart3D.z());
+  const TCoord sphericalR = std::sqrt(cart3DRot.x() * cart3DRot.x() + cart3DRot.y() * cart3DRot.y() + cart3DRot.z() * cart3DRot.z());
+  TCoord sphericalTheta = std::acos(std::max(std::min(cart3DRot.z() / sphericalR, TCoord(1)), TCoord(-1)));
+  TCoord sphericalPhi = TCoord(std::atan2(cart3DRot.y(), cart3DRot.x()));
+
+  // Model motion
+  sphericalTheta = modelGeodesicMotion(sphericalTheta, motionVector.x(), blockCenter);
+  sphericalPhi = sphericalPhi + m_angleResolution * motionVector.y();
 
   // Back to cartesian, undo rotation to desired epipole and project back to 2D image plane
-  return fromRotatedSphere({ sphericalR, sphericalThetaMoved, sphericalPhiMoved });
+  const auto cart3DRotMoved = CoordinateConversion::sphericalToCartesian({sphericalR, sphericalTheta, sphericalPhi});
+  const Array3TCoord cart3DMoved = m_epipole.inverseRotation * Eigen::Matrix<TCoord, 3, 1>(cart3DRotMoved.x(), cart3DRotMoved.y(), cart3DRotMoved.z());
+  return m_projection->fromSphere(cart3DMoved);
 }
 
 Array2TCoord GeodesicMotionModel::motionVectorForEquivalentPixelShiftAt(const Position &position, const Array2TCoord &shiftedPosition, const Array2TCoord &blockCenter) const
 {
   // Original position to unit sphere with desired epipole
   const auto cart3D = m_projection->toSphere(Array2TCoord(position.x, position.y));
-  const Array3TCoord cart3DRot = m_rotationMatrix * Eigen::Matrix<TCoord, 3, 1>(cart3D.x(), cart3D.y(), cart3D.z());
+  const Array3TCoord cart3DRot = m_epipole.rotation * Eigen::Matrix<TCoord, 3, 1>(cart3D.x(), cart3D.y(), cart3D.z());
   const auto spherical = CoordinateConversion::cartesianToSpherical(cart3DRot);
 
   // Shifted position to unit sphere with desired epipole
   const auto cart3DMoved = m_projection->toSphere(shiftedPosition);
-  const Array3TCoord cart3DMovedRot = m_rotationMatrix * Eigen::Matrix<TCoord, 3, 1>(cart3DMoved.x(), cart3DMoved.y(), cart3DMoved.z());
+  const Array3TCoord cart3DMovedRot = m_epipole.rotation * Eigen::Matrix<TCoord, 3, 1>(cart3DMoved.x(), cart3DMoved.y(), cart3DMoved.z());
   const auto sphericalMoved = CoordinateConversion::cartesianToSpherical(cart3DMovedRot);
 
   switch (m_flavor)
@@ -225,7 +455,7 @@ Array2TCoord GeodesicMotionModel::motionVectorForEquivalentPixelShiftAt(const Po
   {
     // Current block center to unit sphere with desired epipole
     const auto cart3DCenter = m_projection->toSphere(blockCenter);
-    const Array3TCoord cart3DCenterRot = m_rotationMatrix * Eigen::Matrix<TCoord, 3, 1>(cart3DCenter.x(), cart3DCenter.y(), cart3DCenter.z());
+    const Array3TCoord cart3DCenterRot = m_epipole.rotation * Eigen::Matrix<TCoord, 3, 1>(cart3DCenter.x(), cart3DCenter.y(), cart3DCenter.z());
     const auto sphericalCenter = CoordinateConversion::cartesianToSpherical(cart3DCenterRot);
 
     // Calculate k and the resulting required delta theta of the block center for geodesic motion modulation
@@ -256,7 +486,7 @@ Array2TCoord GeodesicMotionModel::motionVectorForEquivalentPixelShiftAt(const Po
   {
     // Current block center to unit sphere with desired epipole
     const auto cart3DCenter = m_projection->toSphere(blockCenter);
-    const Array3TCoord cart3DCenterRot = m_rotationMatrix * Eigen::Matrix<TCoord, 3, 1>(cart3DCenter.x(), cart3DCenter.y(), cart3DCenter.z());
+    const Array3TCoord cart3DCenterRot = m_epipole.rotation * Eigen::Matrix<TCoord, 3, 1>(cart3DCenter.x(), cart3DCenter.y(), cart3DCenter.z());
     const auto sphericalCenter = CoordinateConversion::cartesianToSpherical(cart3DCenterRot);
 
     // Original and shifted position to cylinder
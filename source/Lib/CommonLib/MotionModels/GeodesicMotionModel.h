@@ -8,8 +8,46 @@
 #include "Projection.h"
 #include "Unit.h"
 #include "MotionModel.h"
+#include "GeodesicReprojection.h"
+#include "ThreadPool.h"
 
+#include <deque>
+#include <memory>
+#include <mutex>
 #include <utility>
+#include <vector>
+
+
+/** Frame-wide rotated spherical coordinates (r, theta, phi) of all 4x4 subblocks per epipole.
+ *  Shared by all GeodesicMotionModel instances of a sequence, all methods are thread-safe. */
+class RotatedSphereTables {
+public:
+  struct Planes {
+    Array3TCoord epipole;
+    ArrayXXTCoordPtr spherical[3];
+  };
+  typedef std::shared_ptr<const Planes> PlanesPtr;
+
+  RotatedSphereTables(const Projection *projection, const ArrayXXTCoordPtrPair &cart2DProj);
+
+  /** @brief Limit the memory of the planes in bytes (0: GED_ROTATED_SPHERE_CACHE_SIZE epipoles). */
+  void setBudget(size_t budgetBytes);
+  /** @brief Planes of the epipole, computed on first use. Evicted planes stay valid as long as they are referenced. */
+  PlanesPtr get(const Epipole &epipole);
+  /** @brief Compute the planes of the given epipoles ahead of use, as many as the budget allows. */
+  void prepare(const std::vector<const Epipole*> &epipoles, ThreadPool *threadPool);
+
+protected:
+  std::shared_ptr<Planes> allocatePlanes(const Epipole &epipole) const;
+  /** Rotate the columns [startCol, startCol + numCols) of the 4x4 subblock grid, thread-safe for disjoint columns */
+  void computePlanes(const Epipole &epipole, Planes &planes, int startCol, int numCols) const;
+
+  const Projection *m_projection;
+  const ArrayXXTCoordPtrPair m_cart2DProj;
+  std::mutex m_mutex;
+  std::deque<std::shared_ptr<Planes>> m_planes;  /**< Most recently used epipole first, at most m_capacity entries */
+  size_t m_capacity;
+};
 
 
 /**
@@ -26,34 +64,65 @@ public:
   };
 
 public:
-  GeodesicMotionModel(): m_projection(nullptr), m_angleResolution(0), m_flavor(), m_epipole(), m_rotationMatrix() {}
+  GeodesicMotionModel(): m_projection(nullptr), m_equirectangularProjection(nullptr), m_angleResolution(0), m_flavor(), m_epipole() {}
   GeodesicMotionModel(const Projection* projection, TCoord angleResolution, Flavor flavor):
-    m_projection(projection),m_angleResolution(angleResolution), m_flavor(flavor), m_epipole(), m_rotationMatrix() {}
+    m_projection(projection), m_equirectangularProjection(dynamic_cast<const EquirectangularProjection*>(projection)),
+    m_angleResolution(angleResolution), m_flavor(flavor), m_epipole() {}
 
   ArrayXXTCoordPtrPair modelMotion(ArrayXXTCoordPtrPair cart2D, const Array2TCoord &motionVector, const Array2TCoord &blockCenter) const override;
-  ArrayXXTCoordPtrPair modelMotionCached(const Position &position, const Size &size, const Array2TCoord &motionVector, const Array2TCoord &blockCenter);
+  void modelMotion(const ArrayXXTCoordMap &cart2DX, const ArrayXXTCoordMap &cart2DY, ArrayXXTCoordMap &cart2DXMoved, ArrayXXTCoordMap &cart2DYMoved,
+                   const Array2TCoord &motionVector, const Array2TCoord &blockCenter, CoordinateArena &arena) const override;
+  /** @brief Model motion of the 4x4 subblocks with position and size (in subblock units) using the frame-wide rotated spherical coordinate planes. */
+  void modelMotionCached(const Position &position, const Size &size, ArrayXXTCoordMap &cart2DXMoved, ArrayXXTCoordMap &cart2DYMoved,
+                         const Array2TCoord &motionVector, const Array2TCoord &blockCenter, CoordinateArena &arena);
+  Array2TCoord modelMotionAt(const Array2TCoord &cart2D, const Array2TCoord &motionVector, const Array2TCoord &blockCenter) const override;
   Array2TCoord motionVectorForEquivalentPixelShiftAt(const Position &position, const Array2TCoord &pixelShift, const Array2TCoord &blockCenter) const override;
 
-  void fillCache(const ArrayXXTCoordPtrPair &cart2DProj);
+  /** @brief Use the shared frame-wide rotated spherical coordinate planes for modelMotionCached and toRotatedSphereCached. */
+  void setRotatedSphereTables(const std::shared_ptr<RotatedSphereTables> &rotatedSphereTables) { m_rotatedSphereTables = rotatedSphereTables; m_rotatedSpherePlanes.reset(); }
   void setEpipole(const Array3TCoord &epipole);
+  /** @brief Switch to an epipole with precomputed rotation, e.g., from EpipoleList::findEpipoleHandle. */
+  void setEpipole(const Epipole &epipole);
+
+  /** @brief Make the frame-wide rotated spherical coordinate planes for the current epipole available for modelMotionCached. */
+  void updateRotatedSphereCache();
+  /** @brief Copy the rotated spherical coordinates of the 4x4 subblocks with position and size (in subblock units) from the frame-wide planes. */
+  void toRotatedSphereCached(const Position &position, const Size &size,
+                             ArrayXXTCoordMap &sphericalR, ArrayXXTCoordMap &sphericalTheta, ArrayXXTCoordMap &sphericalPhi);
+
+  /** @brief Whether the motion can be evaluated with the fused GeodesicReprojection kernel (equirectangular projection, REGENSKY_GEO_GLOBAL/BLOCK). */
+  bool isFusedReprojectionSupported() const;
+  /** @brief Set the motion and projection parameters of the fused GeodesicReprojection kernel for the current epipole. */
+  void fillReprojectionParam(GeodesicReprojectionParam &param, const Array2TCoord &motionVector, const Array2TCoord &blockCenter) const;
+
+  void toRotatedSphere(const ArrayXXTCoordMap &cart2DX, const ArrayXXTCoordMap &cart2DY,
+                       ArrayXXTCoordMap &sphericalR, ArrayXXTCoordMap &sphericalTheta, ArrayXXTCoordMap &sphericalPhi, CoordinateArena &arena) const;
+  static ArrayXXTCoordPtrTriple toRotatedSphere(const Projection *projection, const ArrayXXTCoordPtrPair &cart2D, const Epipole &epipole);
 
 protected:
   ArrayXXTCoordPtrTriple toRotatedSphere(const ArrayXXTCoordPtrPair &cart2D) const;
   ArrayXXTCoordPtrPair fromRotatedSphere(const ArrayXXTCoordPtrTriple &spherical) const;
   ArrayXXTCoordPtr modelGeodesicMotion(const ArrayXXTCoordPtr &theta, const TCoord motionVectorX, const Array2TCoord &blockCenter) const;
 
+  void fromRotatedSphere(const ArrayXXTCoordMap &sphericalR, const ArrayXXTCoordMap &sphericalTheta, const ArrayXXTCoordMap &sphericalPhi,
+                         ArrayXXTCoordMap &cart2DX, ArrayXXTCoordMap &cart2DY, CoordinateArena &arena) const;
+  void modelGeodesicMotion(ArrayXXTCoordMap &theta, const TCoord motionVectorX, const Array2TCoord &blockCenter) const;
+  TCoord modelGeodesicMotion(TCoord theta, const TCoord motionVectorX, const Array2TCoord &blockCenter) const;
+  TCoord modulationFactor(const TCoord motionVectorX, const Array2TCoord &blockCenter) const;
+  /** Radius of the cylinder through the block center on the rotated sphere (REGENSKY_GEO_BLOCK) */
+  TCoord cylindricalRadius(const Array2TCoord &blockCenter) const;
+  /** Shift along the cylinder axis per unit of horizontal motion (REGENSKY_GEO_GLOBAL/BLOCK) */
+  TCoord cylindricalDeltaZ() const { return 1 / std::tan(TCoord(M_PI_2) + m_angleResolution); }
+
 protected:
   const Projection* m_projection;
+  const EquirectangularProjection* m_equirectangularProjection;  /**< m_projection if equirectangular, nullptr otherwise */
   const TCoord m_angleResolution;
   const Flavor m_flavor;
 
-  Array3TCoord m_epipole;
-  Eigen::Matrix<TCoord, 3, 3> m_rotationMatrix;
+  Epipole m_epipole;  /**< Current epipole with rotation to the epipole-aligned sphere */
 
-  /** Encoder luma caching */
-  ArrayXXTCoordPtrPair m_cachedCart2DProj;
-  Position m_cachedPosition;  /**< Cached block position */
-  Size m_cachedSize;  /**< Cached block size */
-  Array3TCoord m_cachedEpipole;  /**< Cached epipole */
-  ArrayXXTCoordPtr m_cachedSpherical[3];  /**< Rotated spherical coordinates of last block with position, size and epipole */
+  /** Luma caching */
+  std::shared_ptr<RotatedSphereTables> m_rotatedSphereTables;
+  RotatedSphereTables::PlanesPtr m_rotatedSpherePlanes;  /**< Planes of the current epipole */
 };
@@ -10,6 +10,13 @@
 class MotionModel
 {
 public:
+  virtual ~MotionModel() = default;
+
   virtual ArrayXXTCoordPtrPair modelMotion(ArrayXXTCoordPtrPair cart2D, const Array2TCoord &motionVector, const Array2TCoord &blockCenter) const = 0;
+  /// In-place variant writing the moved coordinates to preallocated planes. Output planes must not alias input planes.
+  virtual void modelMotion(const ArrayXXTCoordMap &cart2DX, const ArrayXXTCoordMap &cart2DY, ArrayXXTCoordMap &cart2DXMoved, ArrayXXTCoordMap &cart2DYMoved,
+                           const Array2TCoord &motionVector, const Array2TCoord &blockCenter, CoordinateArena &arena) const = 0;
+  /// Point variant without allocations, e.g., for the derivation of motion vector candidates.
+  virtual Array2TCoord modelMotionAt(const Array2TCoord &cart2D, const Array2TCoord &motionVector, const Array2TCoord &blockCenter) const = 0;
   virtual Array2TCoord motionVectorForEquivalentPixelShiftAt(const Position &position, const Array2TCoord &shiftedPosition, const Array2TCoord &blockCenter) const = 0;
 };
@@ -11,6 +11,18 @@ ArrayXXTCoordPtrPair TranslationalMotionModel::modelMotion(ArrayXXTCoordPtrPair
   return {cart2DXMoved, cart2DYMoved};
 }
 
+void TranslationalMotionModel::modelMotion(const ArrayXXTCoordMap &cart2DX, const ArrayXXTCoordMap &cart2DY, ArrayXXTCoordMap &cart2DXMoved, ArrayXXTCoordMap &cart2DYMoved,
+                                           const Array2TCoord &motionVector, const Array2TCoord &blockCenter, CoordinateArena &arena) const
+{
+  cart2DXMoved = cart2DX + motionVector.x();
+  cart2DYMoved = cart2DY + motionVector.y();
+}
+
+Array2TCoord TranslationalMotionModel::modelMotionAt(const Array2TCoord &cart2D, const Array2TCoord &motionVector, const Array2TCoord &blockCenter) const
+{
+  return {cart2D.x() + motionVector.x(), cart2D.y() + motionVector.y()};
+}
+
 Array2TCoord TranslationalMotionModel::motionVectorForEquivalentPixelShiftAt(const Position &position, const Array2TCoord &shiftedPosition, const Array2TCoord &blockCenter) const
 {
   return {shiftedPosition.x() - TCoord(position.x), shiftedPosition.y() - TCoord(position.y)};
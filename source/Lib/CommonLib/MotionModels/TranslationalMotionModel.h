@@ -11,5 +11,8 @@
 class TranslationalMotionModel: public MotionModel {
 public:
   ArrayXXTCoordPtrPair modelMotion(ArrayXXTCoordPtrPair cart2D, const Array2TCoord &motionVector, const Array2TCoord &blockCenter) const override;
+  void modelMotion(const ArrayXXTCoordMap &cart2DX, const ArrayXXTCoordMap &cart2DY, ArrayXXTCoordMap &cart2DXMoved, ArrayXXTCoordMap &cart2DYMoved,
+                   const Array2TCoord &motionVector, const Array2TCoord &blockCenter, CoordinateArena &arena) const override;
+  Array2TCoord modelMotionAt(const Array2TCoord &cart2D, const Array2TCoord &motionVector, const Array2TCoord &blockCenter) const override;
   Array2TCoord motionVectorForEquivalentPixelShiftAt(const Position &position, const Array2TCoord &shiftedPosition, const Array2TCoord &blockCenter) const override;
 };
@@ -76,6 +76,7 @@ Picture::Picture()
   numSlices = 1;
   unscaledPic = nullptr;
   m_isMctfFiltered      = false;
+  m_ctuRowTempBuffers   = false;
   m_grainCharacteristic = nullptr;
   m_grainBuf            = nullptr;
 }
@@ -126,6 +127,7 @@ void Picture::destroy()
     M_BUFS(jId, t).destroy();
   }
   m_hashMap.clearAll();
+  m_colMotionField.clear();
   if (cs)
   {
 #if GDR_ENABLED
@@ -161,13 +163,18 @@ void Picture::destroy()
   m_grainBuf           = nullptr;
 }
 
-void Picture::createTempBuffers( const unsigned _maxCUSize )
+void Picture::createTempBuffers( const unsigned _maxCUSize, const bool ctuRowTempBuffers )
 {
 #if KEEP_PRED_AND_RESI_SIGNALS
   const Area a( Position{ 0, 0 }, lumaSize() );
 #else
-  const Area a = m_ctuArea.Y();
+  Area a = m_ctuArea.Y();
+  if( ctuRowTempBuffers )
+  {
+    a.height = ( ( lumaSize().height + _maxCUSize - 1 ) / _maxCUSize ) * _maxCUSize;
+  }
 #endif
+  m_ctuRowTempBuffers = ctuRowTempBuffers;
 
   M_BUFS( jId, PIC_PREDICTION                   ).create( chromaFormat, a,   _maxCUSize );
   M_BUFS( jId, PIC_RESIDUAL                     ).create( chromaFormat, a,   _maxCUSize );
@@ -180,6 +187,7 @@ void Picture::createTempBuffers( const unsigned _maxCUSize )
 
 void Picture::destroyTempBuffers()
 {
+  m_ctuRowTempBuffers = false;
   for (uint32_t t = 0; t < NUM_PIC_TYPES; t++)
   {
     if (t == PIC_RESIDUAL || t == PIC_PREDICTION)
@@ -252,6 +260,8 @@ void Picture::finalInit( const VPS* vps, const SPS& sps, const PPS& pps, PicHead
   const int          width           = pps.getPicWidthInLumaSamples();
   const int          height          = pps.getPicHeightInLumaSamples();
 
+  m_colMotionField.clear();
+
   if( cs )
   {
     cs->initStructData();
@@ -355,6 +365,41 @@ void Picture::clearSliceBuffer()
   slices.clear();
 }
 
+static_assert( ( 1 << COL_MOTION_LOG2_SIZE ) == 4 * AMVP_DECIMATION_FACTOR, "The compressed motion field has to match the granularity of the colocated fetches" );
+
+void Picture::compressMotion()
+{
+  const Area &lumaArea = cs->area.Y();
+  const int   width    = ( lumaArea.width  + ( 1 << COL_MOTION_LOG2_SIZE ) - 1 ) >> COL_MOTION_LOG2_SIZE;
+  const int   height   = ( lumaArea.height + ( 1 << COL_MOTION_LOG2_SIZE ) - 1 ) >> COL_MOTION_LOG2_SIZE;
+
+  m_colMotionField.resize( width * height );
+
+  for( int y = 0; y < height; y++ )
+  {
+    for( int x = 0; x < width; x++ )
+    {
+      m_colMotionField[y * width + x] = cs->getMotionInfo( lumaArea.offset( x << COL_MOTION_LOG2_SIZE, y << COL_MOTION_LOG2_SIZE ) );
+    }
+  }
+}
+
+const MotionInfo& Picture::getColMotionInfo( const Position& pos ) const
+{
+  // pictures that have not been compressed (e.g. generated reference pictures) keep the full motion buffer only
+  if( m_colMotionField.empty() )
+  {
+    return cs->getMotionInfo( pos );
+  }
+
+  CHECKD( !cs->area.Y().contains( pos ), "Trying to access motion information outside of the picture" );
+
+  const Position colPos = pos - cs->area.lumaPos();
+  const int      stride = ( cs->area.lumaSize().width + ( 1 << COL_MOTION_LOG2_SIZE ) - 1 ) >> COL_MOTION_LOG2_SIZE;
+
+  return m_colMotionField[( colPos.y >> COL_MOTION_LOG2_SIZE ) * stride + ( colPos.x >> COL_MOTION_LOG2_SIZE )];
+}
+
 const TFilterCoeff DownsamplingFilterSRC[8][16][12] =
 {
     { // D = 1
@@ -1113,7 +1158,10 @@ PelBuf Picture::getBuf( const CompArea &blk, const PictureType &type )
   {
     CompArea localBlk = blk;
     localBlk.x &= ( cs->pcv->maxCUWidthMask  >> getComponentScaleX( blk.compID, blk.chromaFormat ) );
-    localBlk.y &= ( cs->pcv->maxCUHeightMask >> getComponentScaleY( blk.compID, blk.chromaFormat ) );
+    if( !m_ctuRowTempBuffers )
+    {
+      localBlk.y &= ( cs->pcv->maxCUHeightMask >> getComponentScaleY( blk.compID, blk.chromaFormat ) );
+    }
 
     return M_BUFS( jId, type ).getBuf( localBlk );
   }
@@ -1134,7 +1182,10 @@ const CPelBuf Picture::getBuf( const CompArea &blk, const PictureType &type ) co
   {
     CompArea localBlk = blk;
     localBlk.x &= ( cs->pcv->maxCUWidthMask  >> getComponentScaleX( blk.compID, blk.chromaFormat ) );
-    localBlk.y &= ( cs->pcv->maxCUHeightMask >> getComponentScaleY( blk.compID, blk.chromaFormat ) );
+    if( !m_ctuRowTempBuffers )
+    {
+      localBlk.y &= ( cs->pcv->maxCUHeightMask >> getComponentScaleY( blk.compID, blk.chromaFormat ) );
+    }
 
     return M_BUFS( jId, type ).getBuf( localBlk );
   }
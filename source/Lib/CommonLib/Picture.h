@@ -71,11 +71,14 @@ struct Picture : public UnitArea
 #endif
   void destroy();
 
-  void createTempBuffers( const unsigned _maxCUSize );
+  /// prediction and residual buffers of one CTU, or of one CTU per CTU row for rows reconstructed concurrently
+  void createTempBuffers( const unsigned _maxCUSize, const bool ctuRowTempBuffers = false );
   void destroyTempBuffers();
+  bool getCtuRowTempBuffers() const { return m_ctuRowTempBuffers; }
 
   int                       m_padValue;
   bool                      m_isMctfFiltered;
+  bool                      m_ctuRowTempBuffers;  ///< the prediction and residual buffers hold one CTU per CTU row
   SEIFilmGrainSynthesizer*  m_grainCharacteristic;
   PelStorage*               m_grainBuf;
   void              createGrainSynthesizer(bool firstPictureInSequence, SEIFilmGrainSynthesizer* grainCharacteristics, PelStorage* grainBuf, int width, int height, ChromaFormat fmt, int bitDepth);
@@ -247,6 +250,12 @@ public:
 
   CodingStructure*   cs;
   std::deque<Slice*> slices;
+
+  /** @brief Store the motion of the reconstructed picture at the TMVP granularity, used by the colocated fetches of later pictures. */
+  void               compressMotion();
+  const MotionInfo&  getColMotionInfo( const Position& pos ) const;
+  std::vector<MotionInfo> m_colMotionField;  ///< one entry per (1 << COL_MOTION_LOG2_SIZE) square block, empty until compressMotion()
+
   SEIMessages        SEIs;
 
   uint32_t           getPicWidthInLumaSamples() const                                { return  getRecoBuf( COMPONENT_Y ).width; }
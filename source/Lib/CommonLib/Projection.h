@@ -29,6 +29,12 @@ public:
   virtual ArrayXXTCoordPtrPair fromSphere(ArrayXXTCoordPtrTriple cart3D) const = 0;
   virtual Array2TCoord fromSphere(const Array3TCoord &cart3D) const = 0;
 
+  /// In-place variants writing to preallocated planes. The default implementation falls back to the allocating variants.
+  virtual void toSphere(const ArrayXXTCoordMap &cart2DX, const ArrayXXTCoordMap &cart2DY,
+                        ArrayXXTCoordMap &cart3DX, ArrayXXTCoordMap &cart3DY, ArrayXXTCoordMap &cart3DZ, CoordinateArena &arena) const;
+  virtual void fromSphere(const ArrayXXTCoordMap &cart3DX, const ArrayXXTCoordMap &cart3DY, const ArrayXXTCoordMap &cart3DZ,
+                          ArrayXXTCoordMap &cart2DX, ArrayXXTCoordMap &cart2DY, CoordinateArena &arena) const;
+
   TCoord focalLength() const { return m_focalLength; }
 
 protected:
@@ -42,6 +48,9 @@ public:
 
   RadialProjection(TCoord focalLength, const Array2TCoord &opticalCenter) : Projection(focalLength), m_opticalCenter(opticalCenter) {}
 
+  using Projection::toSphere;
+  using Projection::fromSphere;
+
   ArrayXXTCoordPtrTriple toSphere(ArrayXXTCoordPtrPair cart2D) const override;
   Array3TCoord toSphere(const Array2TCoord &cart2D) const override;
 
@@ -133,6 +142,14 @@ public:
   ArrayXXTCoordPtrPair fromSphere(ArrayXXTCoordPtrTriple cart3D) const override;
   Array2TCoord fromSphere(const Array3TCoord &cart3D) const override;
 
+  void toSphere(const ArrayXXTCoordMap &cart2DX, const ArrayXXTCoordMap &cart2DY,
+                ArrayXXTCoordMap &cart3DX, ArrayXXTCoordMap &cart3DY, ArrayXXTCoordMap &cart3DZ, CoordinateArena &arena) const override;
+  void fromSphere(const ArrayXXTCoordMap &cart3DX, const ArrayXXTCoordMap &cart3DY, const ArrayXXTCoordMap &cart3DZ,
+                  ArrayXXTCoordMap &cart2DX, ArrayXXTCoordMap &cart2DY, CoordinateArena &arena) const override;
+
+  const Size& resolution() const { return m_resolution; }
+  TCoord pixelOffset() const { return m_pixelOffset; }
+
 protected:
   Size m_resolution;
   TCoord m_pixelOffset;
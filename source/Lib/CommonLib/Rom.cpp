@@ -418,8 +418,6 @@ void initROM()
 
   initGeoTemplate();
 
-  ::memset(g_isReusedUniMVsFilled, 0, sizeof(g_isReusedUniMVsFilled));
-
   for (int qp = 0; qp < 57; qp++)
   {
     int qpRem = (qp + 12) % 6;
@@ -686,9 +684,6 @@ const uint32_t g_scalingListId[SCALING_LIST_SIZE_NUM][SCALING_LIST_NUM] =
 };
 
 
-Mv   g_reusedUniMVs[32][32][8][8][2][33];
-bool g_isReusedUniMVsFilled[32][32][8][8];
-
 uint16_t g_paletteQuant[57];
 uint8_t g_paletteRunTopLut [5] = { 0, 1, 1, 2, 2 };
 uint8_t g_paletteRunLeftLut[5] = { 0, 1, 2, 3, 4 };
@@ -780,5 +775,272 @@ int16_t   g_weightOffset       [GEO_NUM_PARTITION_MODE][GEO_NUM_CU_SIZE][GEO_NUM
 int8_t    g_angle2mask[GEO_NUM_ANGLES] = { 0, -1, 1, 2, 3, 4, -1, -1, 5, -1, -1, 4, 3, 2, 1, -1, 0, -1, 1, 2, 3, 4, -1, -1, 5, -1, -1, 4, 3, 2, 1, -1 };
 int8_t    g_Dis[GEO_NUM_ANGLES] = { 8, 8, 8, 8, 4, 4, 2, 1, 0, -1, -2, -4, -4, -8, -8, -8, -8, -8, -8, -8, -4, -4, -2, -1, 0, 1, 2, 4, 4, 8, 8, 8 };
 int8_t    g_angle2mirror[GEO_NUM_ANGLES] = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 2, 2, 2, 2 };
+// Geodesic motion model in fixed point (GeodesicFixedPoint)
+const int32_t g_gedSinTable[GED_TRIG_TABLE_SIZE + 1] =
+{
+  0, 1647099, 3294193, 4941281, 6588356, 8235416, 9882456, 11529474,
+  13176464, 14823423, 16470347, 18117233, 19764076, 21410872, 23057618, 24704310,
+  26350943, 27997515, 29644021, 31290457, 32936819, 34583104, 36229307, 37875426,
+  39521455, 41167391, 42813230, 44458968, 46104602, 47750128, 49395541, 51040837,
+  52686014, 54331067, 55975992, 57620785, 59265442, 60909960, 62554335, 64198563,
+  65842639, 67486561, 69130324, 70773924, 72417357, 74060620, 75703709, 77346620,
+  78989349, 80631892, 82274245, 83916404, 85558366, 87200127, 88841683, 90483029,
+  92124163, 93765079, 95405776, 97046247, 98686491, 100326502, 101966277, 103605812,
+  105245103, 106884147, 108522939, 110161476, 111799753, 113437768, 115075515, 116712992,
+  118350194, 119987118, 121623759, 123260114, 124896179, 126531950, 128167423, 129802595,
+  131437462, 133072019, 134706263, 136340190, 137973796, 139607077, 141240030, 142872651,
+  144504935, 146136880, 147768480, 149399733, 151030634, 152661180, 154291367, 155921191,
+  157550647, 159179733, 160808445, 162436778, 164064728, 165692293, 167319468, 168946249,
+  170572633, 172198615, 173824192, 175449360, 177074115, 178698453, 180322371, 181945865,
+  183568930, 185191564, 186813762, 188435520, 190056834, 191677702, 193298119, 194918080,
+  196537583, 198156624, 199775198, 201393302, 203010932, 204628085, 206244756, 207860942,
+  209476638, 211091842, 212706549, 214320755, 215934457, 217547651, 219160334, 220772500,
+  222384147, 223995270, 225605867, 227215933, 228825464, 230434456, 232042906, 233650811,
+  235258165, 236864966, 238471210, 240076892, 241682010, 243286558, 244890535, 246493935,
+  248096755, 249698991, 251300640, 252901697, 254502159, 256102022, 257701283, 259299937,
+  260897982, 262495412, 264092224, 265688415, 267283981, 268878918, 270473223, 272066891,
+  273659918, 275252302, 276844038, 278435122, 280025552, 281615322, 283204430, 284792871,
+  286380643, 287967740, 289554160, 291139898, 292724951, 294309316, 295892988, 297475964,
+  299058239, 300639811, 302220676, 303800829, 305380268, 306958988, 308536985, 310114257,
+  311690799, 313266607, 314841679, 316416009, 317989595, 319562433, 321134518, 322705848,
+  324276419, 325846226, 327415267, 328983538, 330551034, 332117752, 333683689, 335248841,
+  336813204, 338376774, 339939549, 341501523, 343062693, 344623057, 346182609, 347741347,
+  349299266, 350856364, 352412636, 353968079, 355522689, 357076462, 358629395, 360181484,
+  361732726, 363283116, 364832652, 366381329, 367929144, 369476093, 371022173, 372567379,
+  374111709, 375655159, 377197725, 378739403, 380280190, 381820082, 383359076, 384897167,
+  386434353, 387970630, 389505993, 391040440, 392573967, 394106570, 395638246, 397168991,
+  398698801, 400227673, 401755603, 403282588, 404808624, 406333708, 407857835, 409381002,
+  410903207, 412424444, 413944711, 415464004, 416982319, 418499653, 420016002, 421531363,
+  423045732, 424559105, 426071480, 427582852, 429093217, 430602573, 432110916, 433618242,
+  435124548, 436629829, 438134084, 439637307, 441139496, 442640647, 444140756, 445639820,
+  447137835, 448634799, 450130706, 451625555, 453119340, 454612060, 456103710, 457594286,
+  459083786, 460572205, 462059541, 463545789, 465030947, 466515010, 467997976, 469479840,
+  470960600, 472440251, 473918791, 475396216, 476872522, 478347705, 479821764, 481294693,
+  482766489, 484237150, 485706671, 487175049, 488642281, 490108363, 491573292, 493037064,
+  494499676, 495961124, 497421405, 498880516, 500338453, 501795212, 503250791, 504705185,
+  506158392, 507610408, 509061229, 510510853, 511959275, 513406493, 514852502, 516297300,
+  517740883, 519183248, 520624391, 522064309, 523502998, 524940456, 526376678, 527811662,
+  529245404, 530677900, 532109148, 533539144, 534967884, 536395365, 537821584, 539246538,
+  540670223, 542092635, 543513772, 544933630, 546352205, 547769495, 549185496, 550600205,
+  552013618, 553425732, 554836544, 556246051, 557654248, 559061133, 560466703, 561870954,
+  563273883, 564675486, 566075761, 567474703, 568872310, 570268579, 571663506, 573057087,
+  574449320, 575840202, 577229728, 578617896, 580004702, 581390144, 582774218, 584156920,
+  585538248, 586918198, 588296766, 589673951, 591049748, 592424154, 593797166, 595168781,
+  596538995, 597907806, 599275210, 600641203, 602005783, 603368947, 604730691, 606091012,
+  607449906, 608807372, 610163404, 611518001, 612871159, 614222875, 615573145, 616921967,
+  618269338, 619615253, 620959711, 622302707, 623644239, 624984303, 626322897, 627660017,
+  628995660, 630329823, 631662503, 632993696, 634323400, 635651611, 636978327, 638303543,
+  639627258, 640949467, 642270169, 643589359, 644907034, 646223192, 647537830, 648850943,
+  650162530, 651472587, 652781111, 654088099, 655393548, 656697454, 657999816, 659300629,
+  660599890, 661897597, 663193747, 664488336, 665781362, 667072820, 668362709, 669651026,
+  670937767, 672222928, 673506508, 674788504, 676068911, 677347728, 678624950, 679900576,
+  681174602, 682447025, 683717842, 684987051, 686254647, 687520629, 688784993, 690047736,
+  691308855, 692568348, 693826211, 695082441, 696337036, 697589992, 698841307, 700090977,
+  701339000, 702585372, 703830092, 705073155, 706314559, 707554301, 708792378, 710028787,
+  711263525, 712496590, 713727978, 714957687, 716185713, 717412054, 718636707, 719859669,
+  721080937, 722300508, 723518380, 724734549, 725949013, 727161768, 728372813, 729582143,
+  730789757, 731995651, 733199822, 734402269, 735602987, 736801974, 737999228, 739194745,
+  740388522, 741580558, 742770848, 743959390, 745146182, 746331221, 747514503, 748696026,
+  749875788, 751053785, 752230015, 753404474, 754577161, 755748072, 756917205, 758084557,
+  759250125, 760413906, 761575898, 762736098, 763894504, 765051111, 766205919, 767358923,
+  768510122, 769659512, 770807092, 771952857, 773096806, 774238936, 775379244, 776517728,
+  777654384, 778789210, 779922204, 781053363, 782182683, 783310163, 784435800, 785559591,
+  786681534, 787801625, 788919863, 790036244, 791150767, 792263427, 793374223, 794483153,
+  795590213, 796695401, 797798714, 798900150, 799999706, 801097379, 802193167, 803287068,
+  804379079, 805469196, 806557419, 807643743, 808728167, 809810688, 810891304, 811970011,
+  813046808, 814121692, 815194659, 816265709, 817334838, 818402043, 819467323, 820530675,
+  821592095, 822651583, 823709135, 824764748, 825818421, 826870150, 827919934, 828967769,
+  830013654, 831057586, 832099562, 833139580, 834177638, 835213733, 836247863, 837280024,
+  838310216, 839338435, 840364679, 841388945, 842411232, 843431536, 844449856, 845466188,
+  846480531, 847492882, 848503239, 849511600, 850517961, 851522321, 852524677, 853525028,
+  854523370, 855519701, 856514019, 857506321, 858496606, 859484870, 860471112, 861455330,
+  862437520, 863417681, 864395810, 865371905, 866345964, 867317984, 868287963, 869255900,
+  870221790, 871185633, 872147426, 873107167, 874064853, 875020483, 875974054, 876925563,
+  877875009, 878822389, 879767701, 880710943, 881652112, 882591207, 883528225, 884463164,
+  885396022, 886326796, 887255485, 888182086, 889106597, 890029016, 890949341, 891867569,
+  892783698, 893697727, 894609652, 895519473, 896427186, 897332790, 898236282, 899137661,
+  900036924, 900934069, 901829095, 902721998, 903612776, 904501429, 905387953, 906272347,
+  907154608, 908034735, 908912725, 909788576, 910662286, 911533853, 912403276, 913270551,
+  914135678, 914998653, 915859476, 916718143, 917574653, 918429004, 919281194, 920131221,
+  920979082, 921824777, 922668302, 923509656, 924348837, 925185843, 926020672, 926853322,
+  927683790, 928512076, 929338177, 930162092, 930983817, 931803352, 932620694, 933435842,
+  934248793, 935059546, 935868098, 936674448, 937478595, 938280535, 939080267, 939877790,
+  940673101, 941466198, 942257081, 943045745, 943832191, 944616416, 945398418, 946178196,
+  946955747, 947731070, 948504163, 949275023, 950043650, 950810042, 951574196, 952336111,
+  953095785, 953853216, 954608403, 955361344, 956112036, 956860479, 957606670, 958350608,
+  959092290, 959831716, 960568883, 961303790, 962036435, 962766816, 963494932, 964220780,
+  964944360, 965665669, 966384706, 967101468, 967815955, 968528165, 969238095, 969945745,
+  970651112, 971354196, 972054994, 972753504, 973449725, 974143656, 974835295, 975524639,
+  976211688, 976896441, 977578894, 978259047, 978936898, 979612445, 980285688, 980956623,
+  981625251, 982291568, 982955574, 983617267, 984276646, 984933708, 985588453, 986240879,
+  986890984, 987538766, 988184225, 988827359, 989468165, 990106644, 990742793, 991376610,
+  992008094, 992637245, 993264059, 993888536, 994510675, 995130473, 995747930, 996363043,
+  996975812, 997586236, 998194311, 998800038, 999403415, 1000004439, 1000603111, 1001199428,
+  1001793390, 1002384994, 1002974239, 1003561124, 1004145648, 1004727809, 1005307605, 1005885036,
+  1006460100, 1007032796, 1007603122, 1008171077, 1008736660, 1009299870, 1009860704, 1010419162,
+  1010975242, 1011528943, 1012080264, 1012629204, 1013175761, 1013719934, 1014261721, 1014801122,
+  1015338134, 1015872758, 1016404991, 1016934832, 1017462281, 1017987335, 1018509994, 1019030256,
+  1019548121, 1020063586, 1020576651, 1021087314, 1021595575, 1022101432, 1022604883, 1023105929,
+  1023604567, 1024100796, 1024594615, 1025086024, 1025575020, 1026061603, 1026545772, 1027027525,
+  1027506862, 1027983780, 1028458280, 1028930359, 1029400018, 1029867254, 1030332067, 1030794455,
+  1031254418, 1031711954, 1032167062, 1032619742, 1033069992, 1033517810, 1033963197, 1034406151,
+  1034846671, 1035284755, 1035720404, 1036153615, 1036584389, 1037012723, 1037438617, 1037862069,
+  1038283080, 1038701647, 1039117770, 1039531448, 1039942680, 1040351465, 1040757802, 1041161689,
+  1041563127, 1041962114, 1042358649, 1042752731, 1043144360, 1043533534, 1043920252, 1044304514,
+  1044686319, 1045065665, 1045442553, 1045816980, 1046188946, 1046558451, 1046925492, 1047290071,
+  1047652185, 1048011834, 1048369016, 1048723732, 1049075980, 1049425759, 1049773069, 1050117909,
+  1050460278, 1050800175, 1051137599, 1051472550, 1051805027, 1052135029, 1052462555, 1052787604,
+  1053110176, 1053430270, 1053747885, 1054063021, 1054375676, 1054685850, 1054993543, 1055298753,
+  1055601479, 1055901722, 1056199480, 1056494753, 1056787540, 1057077840, 1057365653, 1057650977,
+  1057933813, 1058214159, 1058492016, 1058767381, 1059040255, 1059310638, 1059578527, 1059843923,
+  1060106826, 1060367233, 1060625146, 1060880563, 1061133483, 1061383907, 1061631833, 1061877261,
+  1062120190, 1062360620, 1062598550, 1062833980, 1063066909, 1063297336, 1063525261, 1063750684,
+  1063973603, 1064194019, 1064411931, 1064627338, 1064840240, 1065050636, 1065258526, 1065463909,
+  1065666786, 1065867154, 1066065015, 1066260367, 1066453210, 1066643544, 1066831367, 1067016680,
+  1067199483, 1067379774, 1067557554, 1067732821, 1067905576, 1068075818, 1068243547, 1068408763,
+  1068571464, 1068731650, 1068889322, 1069044479, 1069197120, 1069347245, 1069494854, 1069639946,
+  1069782521, 1069922579, 1070060120, 1070195142, 1070327646, 1070457632, 1070585099, 1070710046,
+  1070832474, 1070952382, 1071069770, 1071184638, 1071296985, 1071406812, 1071514117, 1071618901,
+  1071721163, 1071820903, 1071918122, 1072012818, 1072104991, 1072194642, 1072281769, 1072366374,
+  1072448455, 1072528012, 1072605046, 1072679556, 1072751542, 1072821003, 1072887940, 1072952352,
+  1073014240, 1073073603, 1073130440, 1073184753, 1073236540, 1073285802, 1073332538, 1073376748,
+  1073418433, 1073457592, 1073494225, 1073528332, 1073559913, 1073588967, 1073615496, 1073639498,
+  1073660973, 1073679922, 1073696345, 1073710241, 1073721611, 1073730454, 1073736771, 1073740561,
+  1073741824
+};
+
+const int32_t g_gedAtanTable[GED_TRIG_TABLE_SIZE + 1] =
+{
+  0, 667544, 1335087, 2002627, 2670163, 3337695, 4005219, 4672737,
+  5340245, 6007743, 6675230, 7342704, 8010164, 8677609, 9345037, 10012447,
+  10679838, 11347209, 12014559, 12681885, 13349187, 14016464, 14683714, 15350936,
+  16018129, 16685291, 17352421, 18019519, 18686582, 19353609, 20020600, 20687552,
+  21354465, 22021338, 22688168, 23354956, 24021698, 24688395, 25355046, 26021647,
+  26688200, 27354701, 28021151, 28687547, 29353889, 30020175, 30686403, 31352574,
+  32018685, 32684735, 33350723, 34016647, 34682507, 35348301, 36014028, 36679687,
+  37345276, 38010794, 38676240, 39341612, 40006910, 40672133, 41337277, 42002344,
+  42667331, 43332237, 43997061, 44661802, 45326458, 45991028, 46655512, 47319906,
+  47984212, 48648426, 49312549, 49976578, 50640513, 51304353, 51968095, 52631739,
+  53295284, 53958728, 54622070, 55285309, 55948444, 56611473, 57274396, 57937210,
+  58599915, 59262510, 59924994, 60587364, 61249621, 61911762, 62573787, 63235694,
+  63897482, 64559150, 65220696, 65882120, 66543421, 67204596, 67865646, 68526568,
+  69187361, 69848025, 70508558, 71168959, 71829226, 72489359, 73149356, 73809217,
+  74468939, 75128522, 75787964, 76447265, 77106424, 77765438, 78424307, 79083030,
+  79741605, 80400031, 81058308, 81716434, 82374407, 83032227, 83689893, 84347403,
+  85004756, 85661951, 86318987, 86975863, 87632577, 88289129, 88945516, 89601739,
+  90257796, 90913686, 91569407, 92224959, 92880340, 93535549, 94190586, 94845448,
+  95500135, 96154646, 96808980, 97463134, 98117110, 98770904, 99424517, 100077946,
+  100731191, 101384251, 102037125, 102689811, 103342309, 103994617, 104646734, 105298659,
+  105950391, 106601929, 107253271, 107904418, 108555367, 109206117, 109856668, 110507018,
+  111157167, 111807112, 112456854, 113106391, 113755721, 114404845, 115053760, 115702466,
+  116350962, 116999246, 117647318, 118295176, 118942819, 119590247, 120237459, 120884452,
+  121531227, 122177782, 122824116, 123470228, 124116117, 124761782, 125407222, 126052436,
+  126697423, 127342181, 127986711, 128631010, 129275078, 129918914, 130562517, 131205885,
+  131849018, 132491915, 133134574, 133776996, 134419178, 135061119, 135702820, 136344278,
+  136985493, 137626463, 138267189, 138907668, 139547900, 140187883, 140827618, 141467102,
+  142106335, 142745317, 143384045, 144022519, 144660738, 145298701, 145936407, 146573856,
+  147211045, 147847975, 148484644, 149121052, 149757197, 150393078, 151028695, 151664047,
+  152299132, 152933950, 153568500, 154202781, 154836791, 155470531, 156103999, 156737194,
+  157370116, 158002763, 158635134, 159267229, 159899047, 160530586, 161161847, 161792827,
+  162423527, 163053945, 163684080, 164313932, 164943499, 165572781, 166201777, 166830486,
+  167458907, 168087040, 168714883, 169342435, 169969696, 170596665, 171223341, 171849723,
+  172475810, 173101602, 173727097, 174352296, 174977196, 175601797, 176226098, 176850100,
+  177473799, 178097197, 178720291, 179343082, 179965568, 180587749, 181209623, 181831190,
+  182452450, 183073401, 183694042, 184314374, 184934394, 185554102, 186173498, 186792581,
+  187411349, 188029803, 188647941, 189265762, 189883266, 190500453, 191117320, 191733868,
+  192350096, 192966003, 193581588, 194196850, 194811789, 195426405, 196040695, 196654661,
+  197268300, 197881612, 198494596, 199107252, 199719579, 200331577, 200943243, 201554579,
+  202165583, 202776254, 203386591, 203996595, 204606264, 205215597, 205824595, 206433255,
+  207041579, 207649563, 208257210, 208864516, 209471483, 210078108, 210684392, 211290334,
+  211895933, 212501188, 213106100, 213710666, 214314887, 214918762, 215522290, 216125471,
+  216728303, 217330787, 217932922, 218534707, 219136141, 219737224, 220337955, 220938333,
+  221538359, 222138031, 222737348, 223336311, 223934919, 224533170, 225131064, 225728602,
+  226325781, 226922602, 227519064, 228115166, 228710908, 229306289, 229901309, 230495967,
+  231090262, 231684195, 232277764, 232870968, 233463808, 234056282, 234648391, 235240133,
+  235831508, 236422516, 237013156, 237603427, 238193329, 238782861, 239372024, 239960815,
+  240549235, 241137284, 241724960, 242312264, 242899194, 243485751, 244071933, 244657740,
+  245243172, 245828228, 246412908, 246997212, 247581137, 248164686, 248747855, 249330647,
+  249913059, 250495091, 251076743, 251658015, 252238905, 252819414, 253399541, 253979285,
+  254558647, 255137625, 255716219, 256294429, 256872255, 257449695, 258026749, 258603418,
+  259179700, 259755595, 260331103, 260906223, 261480955, 262055299, 262629253, 263202818,
+  263775993, 264348778, 264921172, 265493176, 266064788, 266636008, 267206835, 267777270,
+  268347313, 268916961, 269486216, 270055077, 270623543, 271191615, 271759291, 272326571,
+  272893455, 273459943, 274026035, 274591729, 275157025, 275721924, 276286425, 276850527,
+  277414230, 277977534, 278540439, 279102944, 279665048, 280226752, 280788055, 281348957,
+  281909457, 282469556, 283029252, 283588546, 284147437, 284705924, 285264009, 285821690,
+  286378966, 286935838, 287492306, 288048369, 288604026, 289159278, 289714125, 290268565,
+  290822599, 291376226, 291929446, 292482259, 293034664, 293586662, 294138252, 294689433,
+  295240206, 295790570, 296340525, 296890071, 297439207, 297987934, 298536250, 299084156,
+  299631651, 300178736, 300725410, 301271672, 301817523, 302362962, 302907989, 303452604,
+  303996806, 304540596, 305083973, 305626937, 306169488, 306711625, 307253349, 307794658,
+  308335554, 308876035, 309416102, 309955754, 310494991, 311033813, 311572219, 312110210,
+  312647786, 313184946, 313721690, 314258017, 314793928, 315329423, 315864501, 316399162,
+  316933406, 317467232, 318000642, 318533634, 319066208, 319598364, 320130102, 320661422,
+  321192324, 321722808, 322252872, 322782518, 323311746, 323840554, 324368943, 324896913,
+  325424463, 325951594, 326478305, 327004596, 327530468, 328055919, 328580951, 329105562,
+  329629752, 330153523, 330676872, 331199801, 331722309, 332244397, 332766063, 333287308,
+  333808132, 334328534, 334848516, 335368076, 335887214, 336405930, 336924225, 337442098,
+  337959550, 338476579, 338993186, 339509371, 340025134, 340540475, 341055393, 341569889,
+  342083962, 342597613, 343110842, 343623648, 344136031, 344647991, 345159529, 345670644,
+  346181336, 346691605, 347201451, 347710874, 348219874, 348728451, 349236604, 349744335,
+  350251643, 350758527, 351264988, 351771026, 352276640, 352781832, 353286599, 353790944,
+  354294865, 354798363, 355301437, 355804088, 356306316, 356808120, 357309501, 357810458,
+  358310992, 358811103, 359310790, 359810054, 360308894, 360807311, 361305304, 361802875,
+  362300021, 362796745, 363293045, 363788922, 364284375, 364779405, 365274012, 365768196,
+  366261957, 366755294, 367248208, 367740699, 368232767, 368724412, 369215634, 369706433,
+  370196809, 370686763, 371176293, 371665401, 372154086, 372642348, 373130187, 373617604,
+  374104599, 374591171, 375077320, 375563047, 376048352, 376533235, 377017695, 377501734,
+  377985350, 378468544, 378951317, 379433667, 379915596, 380397103, 380878188, 381358852,
+  381839095, 382318916, 382798316, 383277294, 383755852, 384233988, 384711704, 385188999,
+  385665872, 386142326, 386618358, 387093970, 387569162, 388043934, 388518285, 388992216,
+  389465727, 389938818, 390411490, 390883742, 391355574, 391826987, 392297980, 392768555,
+  393238710, 393708446, 394177763, 394646662, 395115141, 395583203, 396050846, 396518070,
+  396984877, 397451265, 397917236, 398382789, 398847924, 399312642, 399776942, 400240825,
+  400704291, 401167340, 401629972, 402092187, 402553986, 403015369, 403476335, 403936885,
+  404397019, 404856737, 405316040, 405774927, 406233399, 406691455, 407149097, 407606323,
+  408063135, 408519532, 408975514, 409431083, 409886237, 410340977, 410795304, 411249216,
+  411702716, 412155802, 412608475, 413060734, 413512582, 413964016, 414415038, 414865648,
+  415315845, 415765631, 416215005, 416663967, 417112518, 417560657, 418008386, 418455703,
+  418902610, 419349107, 419795193, 420240869, 420686135, 421130991, 421575438, 422019476,
+  422463104, 422906323, 423349133, 423791535, 424233528, 424675114, 425116291, 425557060,
+  425997422, 426437376, 426876923, 427316063, 427754796, 428193123, 428631043, 429068557,
+  429505665, 429942367, 430378664, 430814555, 431250041, 431685122, 432119799, 432554071,
+  432987938, 433421402, 433854461, 434287117, 434719370, 435151219, 435582666, 436013709,
+  436444350, 436874589, 437304425, 437733860, 438162893, 438591524, 439019755, 439447584,
+  439875013, 440302041, 440728669, 441154896, 441580724, 442006152, 442431181, 442855811,
+  443280042, 443703874, 444127308, 444550344, 444972981, 445395221, 445817064, 446238509,
+  446659557, 447080208, 447500463, 447920322, 448339785, 448758852, 449177523, 449595799,
+  450013680, 450431166, 450848258, 451264955, 451681259, 452097168, 452512684, 452927807,
+  453342536, 453756873, 454170818, 454584370, 454997530, 455410298, 455822675, 456234660,
+  456646255, 457057458, 457468272, 457878695, 458288728, 458698371, 459107625, 459516490,
+  459924966, 460333053, 460740752, 461148063, 461554985, 461961521, 462367669, 462773429,
+  463178803, 463583791, 463988392, 464392608, 464796437, 465199881, 465602940, 466005614,
+  466407904, 466809809, 467211330, 467612467, 468013221, 468413591, 468813579, 469213183,
+  469612406, 470011246, 470409704, 470807781, 471205476, 471602790, 471999724, 472396277,
+  472792449, 473188242, 473583655, 473978689, 474373344, 474767620, 475161517, 475555037,
+  475948178, 476340942, 476733328, 477125337, 477516969, 477908225, 478299105, 478689608,
+  479079736, 479469489, 479858867, 480247869, 480636498, 481024752, 481412632, 481800138,
+  482187271, 482574031, 482960419, 483346434, 483732076, 484117347, 484502246, 484886774,
+  485270931, 485654717, 486038133, 486421179, 486803855, 487186161, 487568098, 487949666,
+  488330866, 488711697, 489092160, 489472255, 489851983, 490231344, 490610338, 490988966,
+  491367227, 491745122, 492122652, 492499816, 492876615, 493253049, 493629119, 494004825,
+  494380167, 494755146, 495129761, 495504013, 495877903, 496251430, 496624595, 496997399,
+  497369841, 497741922, 498113642, 498485002, 498856002, 499226641, 499596921, 499966842,
+  500336404, 500705607, 501074452, 501442939, 501811068, 502178839, 502546254, 502913311,
+  503280012, 503646357, 504012346, 504377980, 504743258, 505108181, 505472749, 505836964,
+  506200824, 506564330, 506927483, 507290283, 507652730, 508014824, 508376567, 508737957,
+  509098996, 509459684, 509820021, 510180007, 510539643, 510898929, 511257865, 511616452,
+  511974689, 512332578, 512690119, 513047311, 513404156, 513760653, 514116803, 514472606,
+  514828063, 515183173, 515537938, 515892356, 516246430, 516600159, 516953542, 517306582,
+  517659277, 518011629, 518363638, 518715303, 519066625, 519417606, 519768243, 520118540,
+  520468494, 520818108, 521167380, 521516312, 521864904, 522213156, 522561068, 522908641,
+  523255875, 523602770, 523949327, 524295546, 524641427, 524986971, 525332177, 525677047,
+  526021581, 526365778, 526709640, 527053166, 527396357, 527739213, 528081734, 528423921,
+  528765775, 529107295, 529448481, 529789335, 530129856, 530470044, 530809901, 531149426,
+  531488619, 531827482, 532166014, 532504215, 532842087, 533179628, 533516840, 533853723,
+  534190278, 534526503, 534862401, 535197970, 535533213, 535868127, 536202715, 536536977,
+  536870912
+};
+
 //! \}
 
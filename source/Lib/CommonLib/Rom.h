@@ -211,10 +211,6 @@ constexpr uint8_t g_tbMax[257] = { 0, 0, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3,
 
 extern bool g_mctsDecCheckEnabled;
 
-class  Mv;
-extern Mv   g_reusedUniMVs[32][32][8][8][2][33];
-extern bool g_isReusedUniMVsFilled[32][32][8][8];
-
 extern uint16_t g_paletteQuant[57];
 extern uint8_t g_paletteRunTopLut[5];
 extern uint8_t g_paletteRunLeftLut[5];
@@ -229,5 +225,9 @@ extern int16_t   g_weightOffset       [GEO_NUM_PARTITION_MODE][GEO_NUM_CU_SIZE][
 extern int8_t    g_angle2mask         [GEO_NUM_ANGLES];
 extern int8_t    g_Dis[GEO_NUM_ANGLES];
 extern int8_t    g_angle2mirror[GEO_NUM_ANGLES];
+
+extern const int32_t g_gedSinTable [GED_TRIG_TABLE_SIZE + 1];  ///< sin(i / GED_TRIG_TABLE_SIZE * pi / 2) with GED_FIXED_POINT_BITS fractional bits
+extern const int32_t g_gedAtanTable[GED_TRIG_TABLE_SIZE + 1];  ///< atan(i / GED_TRIG_TABLE_SIZE) as binary angle (2^32 per turn)
+
 #endif  //__TCOMROM__
 
@@ -658,6 +658,43 @@ void SampleAdaptiveOffset::SAOProcess( CodingStructure& cs, SAOBlkParam* saoBlkP
   DTRACE_CRC( g_trace_ctx, D_CRC, cs, cs.getRecoBuf() );
 }
 
+/** SAO of one CTU row, for the loop filters that run on the CTU rows of the picture behind the reconstruction.
+    The deblocked samples of a row are kept in m_tempBuf until the row below has been filtered, so each call only
+    copies the row below ctuRow (and row 0 at the start of the picture).
+ */
+void SampleAdaptiveOffset::SAOProcessCtuRow( CodingStructure& cs, SAOBlkParam* saoBlkParams, const int ctuRow )
+{
+  CHECK(!saoBlkParams, "No parameters present");
+
+  const PreCalcValues& pcv = *cs.pcv;
+  const int copyBegin = ctuRow == 0 ? 0 : ctuRow + 1;
+  const int copyEnd   = std::min<int>( ctuRow + 2, pcv.heightInCtus );
+  if( copyBegin < copyEnd )
+  {
+    const int      yBegin = copyBegin * pcv.maxCUHeight;
+    const int      yEnd   = std::min<int>( copyEnd * pcv.maxCUHeight, pcv.lumaHeight );
+    const UnitArea rows( cs.area.chromaFormat, Area( 0, yBegin, pcv.lumaWidth, yEnd - yBegin ) );
+    m_tempBuf.getBuf( rows ).copyFrom( cs.getRecoBuf( rows ) );
+  }
+
+  PelUnitBuf rec = cs.getRecoBuf();
+  const uint32_t yPos = ctuRow * pcv.maxCUHeight;
+  int ctuRsAddr = ctuRow * pcv.widthInCtus;
+  for( uint32_t xPos = 0; xPos < pcv.lumaWidth; xPos += pcv.maxCUWidth )
+  {
+    const uint32_t width  = (xPos + pcv.maxCUWidth  > pcv.lumaWidth)  ? (pcv.lumaWidth - xPos)  : pcv.maxCUWidth;
+    const uint32_t height = (yPos + pcv.maxCUHeight > pcv.lumaHeight) ? (pcv.lumaHeight - yPos) : pcv.maxCUHeight;
+    const UnitArea area( cs.area.chromaFormat, Area(xPos , yPos, width, height) );
+
+    SAOBlkParam *mergeList[NUM_SAO_MERGE_TYPES] = { nullptr };
+    getMergeList(cs, ctuRsAddr, saoBlkParams, mergeList);
+    reconstructBlkSAOParam(saoBlkParams[ctuRsAddr], mergeList);
+
+    offsetCTU( area, m_tempBuf, rec, saoBlkParams[ctuRsAddr], cs);
+    ctuRsAddr++;
+  }
+}
+
 void SampleAdaptiveOffset::deriveLoopFilterBoundaryAvailibility(CodingStructure& cs, const Position &pos,
   bool& isLeftAvail,
   bool& isRightAvail,
@@ -67,6 +67,8 @@ public:
   virtual ~SampleAdaptiveOffset();
   void SAOProcess( CodingStructure& cs, SAOBlkParam* saoBlkParams
                    );
+  /// SAO of CTU row ctuRow, the rows must be filtered in order and deblocked up to row ctuRow + 2
+  void SAOProcessCtuRow( CodingStructure& cs, SAOBlkParam* saoBlkParams, const int ctuRow );
   void create( int picWidth, int picHeight, ChromaFormat format, uint32_t maxCUWidth, uint32_t maxCUHeight, uint32_t maxCUDepth, uint32_t lumaBitShift, uint32_t chromaBitShift );
   void destroy();
   static int getMaxOffsetQVal(const int channelBitDepth) { return (1<<(std::min<int>(channelBitDepth,MAX_SAO_TRUNCATED_BITDEPTH)-5))-1; } //Table 9-32, inclusive
@@ -1928,6 +1928,10 @@ void                    setCCALFEnabledFlag( bool b )
   bool      getUseGED() const { return m_mmConfig->GED; }
   void      setGEDFlavor(GeodesicMotionModel::Flavor flavor) { m_mmConfig->GEDFlavor = flavor; }
   GeodesicMotionModel::Flavor getGEDFlavor() const { return m_mmConfig->GEDFlavor; }
+  void      setUseGEDFixedPoint(bool b) { m_mmConfig->GEDFixedPoint = b; }
+  bool      getUseGEDFixedPoint() const { return m_mmConfig->GEDFixedPoint; }
+  void      setUseGEDDMVRWindow(bool b) { m_mmConfig->GEDDMVRWindow = b; }
+  bool      getUseGEDDMVRWindow() const { return m_mmConfig->GEDDMVRWindow; }
   void      setUseMMMVP(bool b) { m_mmConfig->MMMVP = b; }
   bool      getUseMMMVP() const { return m_mmConfig->MMMVP; }
   void      setMMOffset4x4(int value) { m_mmConfig->MMOffset4x4 = value; }
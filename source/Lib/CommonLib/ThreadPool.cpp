@@ -0,0 +1,109 @@
+//
+// Fixed-size worker thread pool for independent tasks.
+//
+
+#include "ThreadPool.h"
+
+
+ThreadPool::ThreadPool(int numThreads): m_numPending(0), m_stop(false)
+{
+  if (numThreads <= 0)
+  {
+    numThreads = std::max(1, int(std::thread::hardware_concurrency()));
+  }
+  m_workers.reserve(numThreads);
+  for (int i = 0; i < numThreads; i++)
+  {
+    m_workers.emplace_back(&ThreadPool::xWorker, this);
+  }
+}
+
+ThreadPool::~ThreadPool()
+{
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_stop = true;
+  }
+  m_taskAvailable.notify_all();
+  for (auto &worker : m_workers)
+  {
+    worker.join();
+  }
+}
+
+void ThreadPool::addTask(std::function<void()> task)
+{
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_tasks.push_back(std::move(task));
+    m_numPending++;
+  }
+  m_taskAvailable.notify_one();
+}
+
+void ThreadPool::waitForAll()
+{
+  std::unique_lock<std::mutex> lock(m_mutex);
+  m_tasksDone.wait(lock, [this] { return m_numPending == 0; });
+  if (m_exception)
+  {
+    std::exception_ptr exception = m_exception;
+    m_exception = nullptr;
+    std::rethrow_exception(exception);
+  }
+}
+
+void ThreadPool::parallelFor(ThreadPool *threadPool, int begin, int end, const std::function<void(int)> &function)
+{
+  if (threadPool == nullptr || end - begin < 2)
+  {
+    for (int i = begin; i < end; i++)
+    {
+      function(i);
+    }
+    return;
+  }
+  for (int i = begin; i < end; i++)
+  {
+    threadPool->addTask([&function, i] { function(i); });
+  }
+  threadPool->waitForAll();
+}
+
+void ThreadPool::xWorker()
+{
+  while (true)
+  {
+    std::function<void()> task;
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      m_taskAvailable.wait(lock, [this] { return m_stop || !m_tasks.empty(); });
+      if (m_tasks.empty())
+      {
+        return;
+      }
+      task = std::move(m_tasks.front());
+      m_tasks.pop_front();
+    }
+
+    std::exception_ptr exception;
+    try
+    {
+      task();
+    }
+    catch (...)
+    {
+      exception = std::current_exception();
+    }
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    if (exception && !m_exception)
+    {
+      m_exception = exception;
+    }
+    if (--m_numPending == 0)
+    {
+      m_tasksDone.notify_all();
+    }
+  }
+}
@@ -0,0 +1,52 @@
+//
+// Fixed-size worker thread pool for independent tasks.
+//
+
+#pragma once
+
+#include "CommonDef.h"
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+/**
+ * Runs queued tasks on a fixed number of worker threads. Tasks start in the order they are added, so a task may wait for
+ * tasks added before it, but never for tasks added after it.
+ * An exception thrown by a task is rethrown by the next call to waitForAll().
+ */
+class ThreadPool {
+public:
+  /** @param numThreads Number of worker threads, 0 for the number of hardware threads */
+  explicit ThreadPool(int numThreads);
+  ~ThreadPool();
+
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+
+  int numThreads() const { return int(m_workers.size()); }
+
+  void addTask(std::function<void()> task);
+  /** @brief Block until all queued tasks are finished. */
+  void waitForAll();
+
+  /** @brief Call function(i) for begin <= i < end on the workers and wait for completion. Runs serially without pool. */
+  static void parallelFor(ThreadPool *threadPool, int begin, int end, const std::function<void(int)> &function);
+
+protected:
+  void xWorker();
+
+  std::vector<std::thread>          m_workers;
+  std::deque<std::function<void()>> m_tasks;
+  std::mutex                        m_mutex;
+  std::condition_variable           m_taskAvailable;
+  std::condition_variable           m_tasksDone;
+  int                               m_numPending;  ///< Queued and running tasks
+  bool                              m_stop;
+  std::exception_ptr                m_exception;   ///< First exception thrown by a task
+};
@@ -200,6 +200,7 @@ typedef std::pair<int, int>  TrCost;
 #define ENABLE_SIMD_OPT_DIST                            ( 1 && ENABLE_SIMD_OPT )                            ///< SIMD optimization for the distortion calculations(SAD,SSE,HADAMARD), no impact on RD performance
 #define ENABLE_SIMD_OPT_AFFINE_ME                       ( 1 && ENABLE_SIMD_OPT )                            ///< SIMD optimization for affine ME, no impact on RD performance
 #define ENABLE_SIMD_OPT_ALF                             ( 1 && ENABLE_SIMD_OPT )                            ///< SIMD optimization for ALF
+#define ENABLE_SIMD_OPT_GED                             ( 1 && ENABLE_SIMD_OPT )                            ///< SIMD optimization for the geodesic reprojection, no impact on RD performance
 #if ENABLE_SIMD_OPT_BUFFER
 #define ENABLE_SIMD_OPT_BCW                               1                                                 ///< SIMD optimization for Bcw
 #endif
@@ -862,7 +863,7 @@ enum ImvMode
 // 360 motion models
 //////////////////////////////////////////////////////////////////////////
 
-enum MotionModelID
+enum MotionModelID : int8_t
 {
   CLASSIC,
   GEODESIC,
@@ -377,7 +377,7 @@ struct IntraPredictionData
 };
 
 /// Forward declare enum MotionModelID
-enum MotionModelID;
+enum MotionModelID : int8_t;
 
 struct InterPredictionData
 {
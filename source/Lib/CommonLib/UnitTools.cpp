@@ -376,7 +376,8 @@ void CU::saveMotionInHMVP( const CodingUnit& cu, const bool isToBeDone )
     const bool enableInsertion = CU::isIBC(cu) || enableHmvp;
     if (enableInsertion)
     {
-      cu.cs->addMiToLut(CU::isIBC(cu) ? cu.cs->motionLut.lutIbc : cu.cs->motionLut.lut, mi);
+      LutMotionCand &motionLut = cu.cs->getMotionLut( cu.lumaPos() );
+      cu.cs->addMiToLut(CU::isIBC(cu) ? motionLut.lutIbc : motionLut.lut, mi);
     }
   }
 }
@@ -828,8 +829,8 @@ bool PU::addMergeHMVPCand(const CodingStructure &cs, MergeCtx &mrgCtx, const int
                           const uint32_t maxNumMergeCandMin1, int &cnt, const bool isAvailableA1,
                           const MotionInfo miLeft, const bool isAvailableB1, const MotionInfo miAbove,
                           const bool ibcFlag, const bool isGt4x4
-#if GDR_ENABLED
                          ,const PredictionUnit &pu
+#if GDR_ENABLED
                          ,bool &allCandSolidInAbove
 #endif
 )
@@ -837,7 +838,8 @@ bool PU::addMergeHMVPCand(const CodingStructure &cs, MergeCtx &mrgCtx, const int
   const Slice& slice = *cs.slice;
   MotionInfo miNeighbor;
 
-  auto &lut = ibcFlag ? cs.motionLut.lutIbc : cs.motionLut.lut;
+  const LutMotionCand &motionLut = cs.getMotionLut( pu.lumaPos() );
+  auto &lut = ibcFlag ? motionLut.lutIbc : motionLut.lut;
 
   const int numAvailCandInLut = (int) lut.size();
 
@@ -1025,7 +1027,7 @@ void PU::getIBCMergeCandidates(const PredictionUnit &pu, MergeCtx& mrgCtx, const
                                   miAbove, true, isGt4x4, pu, allCandSolidInAbove);
 #else
     bool found = addMergeHMVPCand(cs, mrgCtx, mrgCandIdx, maxNumMergeCand, cnt, isAvailableA1, miLeft, isAvailableB1,
-                                  miAbove, true, isGt4x4);
+                                  miAbove, true, isGt4x4, pu);
 #endif
 
     if (found)
@@ -1510,7 +1512,7 @@ void PU::getInterMergeCandidates(const PredictionUnit &pu, MergeCtx &mrgCtx, int
                                   isAvailableB1, miAbove, CU::isIBC(*pu.cu), isGt4x4, pu, allCandSolidInAbove);
 #else
     bool found = addMergeHMVPCand(cs, mrgCtx, mrgCandIdx, maxNumMergeCandMin1, cnt, isAvailableA1, miLeft,
-                                  isAvailableB1, miAbove, CU::isIBC(*pu.cu), isGt4x4);
+                                  isAvailableB1, miAbove, CU::isIBC(*pu.cu), isGt4x4, pu);
 #endif
 
     if (found)
@@ -1888,7 +1890,7 @@ bool PU::getColocatedMVP(const PredictionUnit &pu, const RefPicList &eRefPicList
   }
   RefPicList eColRefPicList = slice.getCheckLDC() ? eRefPicList : RefPicList(slice.getColFromL0Flag());
 
-  const MotionInfo& mi = pColPic->cs->getMotionInfo( pos );
+  const MotionInfo& mi = pColPic->getColMotionInfo( pos );
 
   if( !mi.isInter )
   {
@@ -2072,10 +2074,11 @@ void PU::getIbcMVPsEncOnly(PredictionUnit &pu, Mv* mvPred, int& nbPred)
     }
   }
 
-  size_t numAvaiCandInLUT = pu.cs->motionLut.lutIbc.size();
+  const auto &lutIbc           = pu.cs->getMotionLut( pu.lumaPos() ).lutIbc;
+  size_t      numAvaiCandInLUT = lutIbc.size();
   for (uint32_t cand = 0; cand < numAvaiCandInLUT && nbPred < IBC_NUM_CANDIDATES; cand++)
   {
-    MotionInfo neibMi = pu.cs->motionLut.lutIbc[cand];
+    MotionInfo neibMi = lutIbc[cand];
     if (isAddNeighborMv(neibMi.bv, mvPred, nbPred))
     {
       mvPred[nbPred++] = neibMi.bv;
@@ -3180,7 +3183,8 @@ void PU::addAMVPHMVPCand(const PredictionUnit &pu, const RefPicList eRefPicList,
   const Slice &slice = *(*pu.cs).slice;
 
   MotionInfo neibMi;
-  auto &lut = CU::isIBC(*pu.cu) ? pu.cs->motionLut.lutIbc : pu.cs->motionLut.lut;
+  const LutMotionCand &motionLut = pu.cs->getMotionLut( pu.lumaPos() );
+  auto &lut = CU::isIBC(*pu.cu) ? motionLut.lutIbc : motionLut.lut;
   int              numAvailCandInLut = (int) lut.size();
   int              numAllowedCand    = std::min(MAX_NUM_HMVP_AVMPCANDS, numAvailCandInLut);
   const RefPicList eRefPicList2nd = (eRefPicList == REF_PIC_LIST_0) ? REF_PIC_LIST_1 : REF_PIC_LIST_0;
@@ -3467,7 +3471,7 @@ const int getAvailableAffineNeighboursForAbovePredictor( const PredictionUnit &p
   return num;
 }
 
-void PU::getAffineMergeCand( const PredictionUnit &pu, AffineMergeCtx& affMrgCtx, const MVReprojection* mvReprojection, const int mrgCandIdx )
+void PU::getAffineMergeCand( const PredictionUnit &pu, AffineMergeCtx& affMrgCtx, MVReprojection* mvReprojection, const int mrgCandIdx )
 {
   const CodingStructure &cs = *pu.cs;
   const Slice &slice = *pu.cs->slice;
@@ -4193,7 +4197,7 @@ bool PU::getInterMergeSubPuMvpCand(const PredictionUnit &pu, MergeCtx &mrgCtx, c
   centerPos = Position{ PosType(centerPos.x & mask), PosType(centerPos.y & mask) };
 
   // derivation of center motion parameters from the collocated CU
-  const MotionInfo &mi = pColPic->cs->getMotionInfo(centerPos);
+  const MotionInfo &mi = pColPic->getColMotionInfo(centerPos);
 
   if (mi.isInter && mi.isIBCmot == false)
   {
@@ -4248,7 +4252,7 @@ bool PU::getInterMergeSubPuMvpCand(const PredictionUnit &pu, MergeCtx &mrgCtx, c
 
         colPos = Position{ PosType(colPos.x & mask), PosType(colPos.y & mask) };
 
-        const MotionInfo &colMi = pColPic->cs->getMotionInfo(colPos);
+        const MotionInfo &colMi = pColPic->getColMotionInfo(colPos);
 
         MotionInfo mi;
 
@@ -169,8 +169,8 @@ namespace PU
     , const bool isAvailableA1, const MotionInfo miLeft, const bool isAvailableB1, const MotionInfo miAbove
     , const bool ibcFlag
     , const bool isGt4x4
-#if GDR_ENABLED
     , const PredictionUnit &pu
+#if GDR_ENABLED
     , bool &allCandSolidInAbove
 #endif
   );
@@ -184,7 +184,7 @@ namespace PU
 #else
   void getAffineControlPointCand(const PredictionUnit &pu, MotionInfo mi[4], bool isAvailable[4], int verIdx[4], int8_t bcwIdx, int modelIdx, int verNum, AffineMergeCtx& affMrgCtx);
 #endif
-  void getAffineMergeCand( const PredictionUnit &pu, AffineMergeCtx& affMrgCtx, const MVReprojection* mvReprojection, const int mrgCandIdx = -1 );
+  void getAffineMergeCand( const PredictionUnit &pu, AffineMergeCtx& affMrgCtx, MVReprojection* mvReprojection, const int mrgCandIdx = -1 );
   void setAllAffineMvField            (      PredictionUnit &pu, MvField *mvField, RefPicList eRefList );
   void setAllAffineMv                 (      PredictionUnit &pu, Mv affLT, Mv affRT, Mv affLB, RefPicList eRefList, bool clipCPMVs = false );
   bool getInterMergeSubPuMvpCand(const PredictionUnit &pu, MergeCtx &mrgCtx, const int count, int mmvdList);
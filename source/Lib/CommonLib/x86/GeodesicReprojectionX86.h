@@ -0,0 +1,313 @@
+//
+// SIMD kernels for the fused equirectangular geodesic reprojection of 4x4 subblock grids.
+//
+
+#include "CommonDefX86.h"
+#include "../GeodesicReprojection.h"
+
+//! \ingroup CommonLib
+//! \{
+
+#ifdef TARGET_SIMD_X86
+#if defined _MSC_VER
+#include <tmmintrin.h>
+#else
+#include <x86intrin.h>
+#endif
+
+#if ENABLE_SIMD_OPT_GED
+
+/**
+ * Packet sin/cos and round bit-exact to Eigen 3.4 (psincos_float and pround for Packet4f/Packet8f without FMA).
+ * The generic Eigen path evaluates these with Packet4f, so all lanes of a 8-wide packet match as well.
+ * Arguments must be below 18838 in magnitude, which holds for all spherical coordinates and motion vectors.
+ */
+template<bool computeSine>
+static inline __m128 simdSinCos4(const __m128 &x0)
+{
+  const __m128  signMask = _mm_castsi128_ps(_mm_set1_epi32(0x80000000));
+  const __m128i one      = _mm_set1_epi32(1);
+
+  __m128 x = _mm_and_ps(x0, _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff)));
+
+  // Scale by 2/pi and round to the nearest octant
+  __m128 y = _mm_mul_ps(x, _mm_set1_ps(0.636619746685028076171875f));
+  const __m128 yRound = _mm_add_ps(y, _mm_set1_ps(12582912.f));
+  const __m128i yInt  = _mm_castps_si128(yRound);
+  y = _mm_sub_ps(yRound, _mm_set1_ps(12582912.f));
+
+  // Extended precision modular arithmetic
+  x = _mm_add_ps(_mm_mul_ps(y, _mm_set1_ps(-1.5703125f)), x);
+  x = _mm_add_ps(_mm_mul_ps(y, _mm_set1_ps(-0.000483989715576171875f)), x);
+  x = _mm_add_ps(_mm_mul_ps(y, _mm_set1_ps(1.62865035235881805419921875e-07f)), x);
+  x = _mm_add_ps(_mm_mul_ps(y, _mm_set1_ps(5.5644315544167710640977020375430583953857421875e-11f)), x);
+
+  __m128 signBit = computeSine ? _mm_xor_ps(x0, _mm_castsi128_ps(_mm_slli_epi32(yInt, 30)))
+                               : _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(yInt, one), 30));
+  signBit = _mm_and_ps(signBit, signMask);
+  const __m128 polyMask = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(yInt, one), _mm_setzero_si128()));
+
+  const __m128 x2 = _mm_mul_ps(x, x);
+
+  // cos polynomial
+  __m128 y1 = _mm_set1_ps(2.4372266125283204019069671630859375e-05f);
+  y1 = _mm_add_ps(_mm_mul_ps(y1, x2), _mm_set1_ps(-0.00138865201734006404876708984375f));
+  y1 = _mm_add_ps(_mm_mul_ps(y1, x2), _mm_set1_ps(0.041666619479656219482421875f));
+  y1 = _mm_add_ps(_mm_mul_ps(y1, x2), _mm_set1_ps(-0.5f));
+  y1 = _mm_add_ps(_mm_mul_ps(y1, x2), _mm_set1_ps(1.f));
+
+  // sin polynomial
+  __m128 y2 = _mm_set1_ps(-0.0001959234114083702898469196984621021329076029360294342041015625f);
+  y2 = _mm_add_ps(_mm_mul_ps(y2, x2), _mm_set1_ps(0.0083326873655616851693794799871284340042620897293090820312500000f));
+  y2 = _mm_add_ps(_mm_mul_ps(y2, x2), _mm_set1_ps(-0.1666666203982298255503735617821803316473960876464843750000000000f));
+  y2 = _mm_mul_ps(y2, x2);
+  y2 = _mm_add_ps(_mm_mul_ps(y2, x), x);
+
+  y = computeSine ? _mm_blendv_ps(y1, y2, polyMask) : _mm_blendv_ps(y2, y1, polyMask);
+  return _mm_xor_ps(y, signBit);
+}
+
+static inline __m128i simdRoundToInt4(const __m128 &x)
+{
+  const __m128 signMask  = _mm_castsi128_ps(_mm_set1_epi32(0x80000000));
+  const __m128 prev0dot5 = _mm_castsi128_ps(_mm_set1_epi32(0x3EFFFFFF));
+  return _mm_cvttps_epi32(_mm_round_ps(_mm_add_ps(_mm_or_ps(_mm_and_ps(x, signMask), prev0dot5), x), _MM_FROUND_TO_ZERO));
+}
+
+#ifdef USE_AVX2
+template<bool computeSine>
+static inline __m256 simdSinCos8(const __m256 &x0)
+{
+  const __m256  signMask = _mm256_castsi256_ps(_mm256_set1_epi32(0x80000000));
+  const __m256i one      = _mm256_set1_epi32(1);
+
+  __m256 x = _mm256_and_ps(x0, _mm256_castsi256_ps(_mm256_set1_epi32(0x7fffffff)));
+
+  __m256 y = _mm256_mul_ps(x, _mm256_set1_ps(0.636619746685028076171875f));
+  const __m256 yRound = _mm256_add_ps(y, _mm256_set1_ps(12582912.f));
+  const __m256i yInt  = _mm256_castps_si256(yRound);
+  y = _mm256_sub_ps(yRound, _mm256_set1_ps(12582912.f));
+
+  x = _mm256_add_ps(_mm256_mul_ps(y, _mm256_set1_ps(-1.5703125f)), x);
+  x = _mm256_add_ps(_mm256_mul_ps(y, _mm256_set1_ps(-0.000483989715576171875f)), x);
+  x = _mm256_add_ps(_mm256_mul_ps(y, _mm256_set1_ps(1.62865035235881805419921875e-07f)), x);
+  x = _mm256_add_ps(_mm256_mul_ps(y, _mm256_set1_ps(5.5644315544167710640977020375430583953857421875e-11f)), x);
+
+  __m256 signBit = computeSine ? _mm256_xor_ps(x0, _mm256_castsi256_ps(_mm256_slli_epi32(yInt, 30)))
+                               : _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_add_epi32(yInt, one), 30));
+  signBit = _mm256_and_ps(signBit, signMask);
+  const __m256 polyMask = _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(yInt, one), _mm256_setzero_si256()));
+
+  const __m256 x2 = _mm256_mul_ps(x, x);
+
+  __m256 y1 = _mm256_set1_ps(2.4372266125283204019069671630859375e-05f);
+  y1 = _mm256_add_ps(_mm256_mul_ps(y1, x2), _mm256_set1_ps(-0.00138865201734006404876708984375f));
+  y1 = _mm256_add_ps(_mm256_mul_ps(y1, x2), _mm256_set1_ps(0.041666619479656219482421875f));
+  y1 = _mm256_add_ps(_mm256_mul_ps(y1, x2), _mm256_set1_ps(-0.5f));
+  y1 = _mm256_add_ps(_mm256_mul_ps(y1, x2), _mm256_set1_ps(1.f));
+
+  __m256 y2 = _mm256_set1_ps(-0.0001959234114083702898469196984621021329076029360294342041015625f);
+  y2 = _mm256_add_ps(_mm256_mul_ps(y2, x2), _mm256_set1_ps(0.0083326873655616851693794799871284340042620897293090820312500000f));
+  y2 = _mm256_add_ps(_mm256_mul_ps(y2, x2), _mm256_set1_ps(-0.1666666203982298255503735617821803316473960876464843750000000000f));
+  y2 = _mm256_mul_ps(y2, x2);
+  y2 = _mm256_add_ps(_mm256_mul_ps(y2, x), x);
+
+  y = computeSine ? _mm256_blendv_ps(y1, y2, polyMask) : _mm256_blendv_ps(y2, y1, polyMask);
+  return _mm256_xor_ps(y, signBit);
+}
+
+static inline __m256i simdRoundToInt8(const __m256 &x)
+{
+  const __m256 signMask  = _mm256_castsi256_ps(_mm256_set1_epi32(0x80000000));
+  const __m256 prev0dot5 = _mm256_castsi256_ps(_mm256_set1_epi32(0x3EFFFFFF));
+  return _mm256_cvttps_epi32(_mm256_round_ps(_mm256_add_ps(_mm256_or_ps(_mm256_and_ps(x, signMask), prev0dot5), x), _MM_FROUND_TO_ZERO));
+}
+#endif
+
+/** Inverse rotation of the cartesian coordinates, summation order as in the Eigen 3x3 lazy product. */
+template<typename T, T( *add )( T, T ), T( *mul )( T, T ), T( *set1 )( float )>
+static inline void simdInverseRotation(const GeodesicReprojectionParam &param, const T &x, const T &y, const T &z, T &xRot, T &yRot, T &zRot)
+{
+  const TCoord (*m)[3] = param.inverseRotation;
+  xRot = add(mul(set1(m[0][0]), x), add(mul(set1(m[0][1]), y), mul(set1(m[0][2]), z)));
+  yRot = add(mul(set1(m[1][0]), x), add(mul(set1(m[1][1]), y), mul(set1(m[1][2]), z)));
+  zRot = add(mul(set1(m[2][0]), x), add(mul(set1(m[2][1]), y), mul(set1(m[2][2]), z)));
+}
+
+template<X86_VEXT vext>
+static void simdReprojectSubblocks4(const TCoord *sphericalR, const TCoord *sphericalTheta, const TCoord *sphericalPhi,
+                                    const TCoord *cart2DX, const TCoord *cart2DY,
+                                    const GeodesicReprojectionParam &param, int *fixedX, int *fixedY)
+{
+  // Scalar geodesic motion on the cylinder
+  ALIGN_DATA( 16, TCoord thetaMoved[4] );
+  for (int k = 0; k < 4; ++k)
+  {
+    thetaMoved[k] = GeodesicReprojection::moveTheta(param, sphericalTheta[k]);
+  }
+  const __m128 theta = _mm_load_ps(thetaMoved);
+  const __m128 phi   = _mm_add_ps(_mm_loadu_ps(sphericalPhi), _mm_set1_ps(param.phiShift));
+  const __m128 r     = _mm_loadu_ps(sphericalR);
+
+  // Back to cartesian and undo rotation to desired epipole
+  const __m128 rSinTheta = _mm_mul_ps(r, simdSinCos4<true>(theta));
+  const __m128 cart3DRotX = _mm_mul_ps(rSinTheta, simdSinCos4<false>(phi));
+  const __m128 cart3DRotY = _mm_mul_ps(rSinTheta, simdSinCos4<true>(phi));
+  const __m128 cart3DRotZ = _mm_mul_ps(r, simdSinCos4<false>(theta));
+  __m128 cart3DX, cart3DY, cart3DZ;
+  simdInverseRotation<__m128, _mm_add_ps, _mm_mul_ps, _mm_set1_ps>(param, cart3DRotX, cart3DRotY, cart3DRotZ, cart3DX, cart3DY, cart3DZ);
+
+  // Scalar inclination and azimuth
+  const __m128 radius = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(cart3DX, cart3DX), _mm_mul_ps(cart3DY, cart3DY)), _mm_mul_ps(cart3DZ, cart3DZ)));
+  ALIGN_DATA( 16, TCoord x[4] );
+  ALIGN_DATA( 16, TCoord y[4] );
+  ALIGN_DATA( 16, TCoord z[4] );
+  ALIGN_DATA( 16, TCoord rad[4] );
+  _mm_store_ps(x, cart3DX);
+  _mm_store_ps(y, cart3DY);
+  _mm_store_ps(z, cart3DZ);
+  _mm_store_ps(rad, radius);
+  for (int k = 0; k < 4; ++k)
+  {
+    rad[k] = GeodesicReprojection::inclination(z[k], rad[k]);
+    z[k] = GeodesicReprojection::azimuth(x[k], y[k]);
+  }
+  const __m128 sphTheta = _mm_load_ps(rad);
+  __m128 sphPhi = _mm_load_ps(z);
+
+  // Equirectangular projection
+  const __m128 twoPi = _mm_set1_ps(TCoord(2) * TCoord(M_PI));
+  sphPhi = _mm_blendv_ps(sphPhi, _mm_sub_ps(sphPhi, twoPi), _mm_cmpgt_ps(sphPhi, _mm_setzero_ps()));
+  const __m128 pixelOffset = _mm_set1_ps(param.pixelOffset);
+  __m128 posX = _mm_sub_ps(_mm_mul_ps(_mm_xor_ps(_mm_div_ps(sphPhi, twoPi), _mm_set1_ps(-0.f)), _mm_set1_ps(param.width)), pixelOffset);
+  __m128 posY = _mm_sub_ps(_mm_mul_ps(_mm_div_ps(sphTheta, _mm_set1_ps(TCoord(M_PI))), _mm_set1_ps(param.height)), pixelOffset);
+
+  // Perform no motion in case of NaN
+  const __m128 isNaN = _mm_or_ps(_mm_cmpunord_ps(posX, posX), _mm_cmpunord_ps(posY, posY));
+  posX = _mm_blendv_ps(posX, _mm_loadu_ps(cart2DX), isNaN);
+  posY = _mm_blendv_ps(posY, _mm_loadu_ps(cart2DY), isNaN);
+  posX = _mm_sub_ps(posX, _mm_set1_ps(param.offset4x4));
+  posY = _mm_sub_ps(posY, _mm_set1_ps(param.offset4x4));
+  if (param.rescale)
+  {
+    posX = _mm_div_ps(posX, _mm_set1_ps(param.scaleX));
+    posY = _mm_div_ps(posY, _mm_set1_ps(param.scaleY));
+  }
+
+  // Fixed precision
+  _mm_storeu_si128((__m128i *) fixedX, simdRoundToInt4(_mm_mul_ps(posX, _mm_set1_ps(param.fixedScaleHor))));
+  _mm_storeu_si128((__m128i *) fixedY, simdRoundToInt4(_mm_mul_ps(posY, _mm_set1_ps(param.fixedScaleVer))));
+}
+
+#ifdef USE_AVX2
+static inline __m256 simdSet1Ps8(float value) { return _mm256_set1_ps(value); }
+static inline __m256 simdAddPs8(__m256 a, __m256 b) { return _mm256_add_ps(a, b); }
+static inline __m256 simdMulPs8(__m256 a, __m256 b) { return _mm256_mul_ps(a, b); }
+
+static void simdReprojectSubblocks8(const TCoord *sphericalR, const TCoord *sphericalTheta, const TCoord *sphericalPhi,
+                                    const TCoord *cart2DX, const TCoord *cart2DY,
+                                    const GeodesicReprojectionParam &param, int *fixedX, int *fixedY)
+{
+  // Scalar geodesic motion on the cylinder
+  ALIGN_DATA( 32, TCoord thetaMoved[8] );
+  for (int k = 0; k < 8; ++k)
+  {
+    thetaMoved[k] = GeodesicReprojection::moveTheta(param, sphericalTheta[k]);
+  }
+  const __m256 theta = _mm256_load_ps(thetaMoved);
+  const __m256 phi   = _mm256_add_ps(_mm256_loadu_ps(sphericalPhi), _mm256_set1_ps(param.phiShift));
+  const __m256 r     = _mm256_loadu_ps(sphericalR);
+
+  // Back to cartesian and undo rotation to desired epipole
+  const __m256 rSinTheta = _mm256_mul_ps(r, simdSinCos8<true>(theta));
+  const __m256 cart3DRotX = _mm256_mul_ps(rSinTheta, simdSinCos8<false>(phi));
+  const __m256 cart3DRotY = _mm256_mul_ps(rSinTheta, simdSinCos8<true>(phi));
+  const __m256 cart3DRotZ = _mm256_mul_ps(r, simdSinCos8<false>(theta));
+  __m256 cart3DX, cart3DY, cart3DZ;
+  simdInverseRotation<__m256, simdAddPs8, simdMulPs8, simdSet1Ps8>(param, cart3DRotX, cart3DRotY, cart3DRotZ, cart3DX, cart3DY, cart3DZ);
+
+  // Scalar inclination and azimuth
+  const __m256 radius = _mm256_sqrt_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(cart3DX, cart3DX), _mm256_mul_ps(cart3DY, cart3DY)), _mm256_mul_ps(cart3DZ, cart3DZ)));
+  ALIGN_DATA( 32, TCoord x[8] );
+  ALIGN_DATA( 32, TCoord y[8] );
+  ALIGN_DATA( 32, TCoord z[8] );
+  ALIGN_DATA( 32, TCoord rad[8] );
+  _mm256_store_ps(x, cart3DX);
+  _mm256_store_ps(y, cart3DY);
+  _mm256_store_ps(z, cart3DZ);
+  _mm256_store_ps(rad, radius);
+  for (int k = 0; k < 8; ++k)
+  {
+    rad[k] = GeodesicReprojection::inclination(z[k], rad[k]);
+    z[k] = GeodesicReprojection::azimuth(x[k], y[k]);
+  }
+  const __m256 sphTheta = _mm256_load_ps(rad);
+  __m256 sphPhi = _mm256_load_ps(z);
+
+  // Equirectangular projection
+  const __m256 twoPi = _mm256_set1_ps(TCoord(2) * TCoord(M_PI));
+  sphPhi = _mm256_blendv_ps(sphPhi, _mm256_sub_ps(sphPhi, twoPi), _mm256_cmp_ps(sphPhi, _mm256_setzero_ps(), _CMP_GT_OQ));
+  const __m256 pixelOffset = _mm256_set1_ps(param.pixelOffset);
+  __m256 posX = _mm256_sub_ps(_mm256_mul_ps(_mm256_xor_ps(_mm256_div_ps(sphPhi, twoPi), _mm256_set1_ps(-0.f)), _mm256_set1_ps(param.width)), pixelOffset);
+  __m256 posY = _mm256_sub_ps(_mm256_mul_ps(_mm256_div_ps(sphTheta, _mm256_set1_ps(TCoord(M_PI))), _mm256_set1_ps(param.height)), pixelOffset);
+
+  // Perform no motion in case of NaN
+  const __m256 isNaN = _mm256_or_ps(_mm256_cmp_ps(posX, posX, _CMP_UNORD_Q), _mm256_cmp_ps(posY, posY, _CMP_UNORD_Q));
+  posX = _mm256_blendv_ps(posX, _mm256_loadu_ps(cart2DX), isNaN);
+  posY = _mm256_blendv_ps(posY, _mm256_loadu_ps(cart2DY), isNaN);
+  posX = _mm256_sub_ps(posX, _mm256_set1_ps(param.offset4x4));
+  posY = _mm256_sub_ps(posY, _mm256_set1_ps(param.offset4x4));
+  if (param.rescale)
+  {
+    posX = _mm256_div_ps(posX, _mm256_set1_ps(param.scaleX));
+    posY = _mm256_div_ps(posY, _mm256_set1_ps(param.scaleY));
+  }
+
+  // Fixed precision
+  _mm256_storeu_si256((__m256i *) fixedX, simdRoundToInt8(_mm256_mul_ps(posX, _mm256_set1_ps(param.fixedScaleHor))));
+  _mm256_storeu_si256((__m256i *) fixedY, simdRoundToInt8(_mm256_mul_ps(posY, _mm256_set1_ps(param.fixedScaleVer))));
+}
+#endif
+
+template<X86_VEXT vext>
+static void simdReprojectSubblocks(const TCoord *sphericalR, const TCoord *sphericalTheta, const TCoord *sphericalPhi,
+                                   const TCoord *cart2DX, const TCoord *cart2DY, int numElements, int numPacketElements,
+                                   const GeodesicReprojectionParam &param, int *fixedX, int *fixedY)
+{
+  int i = 0;
+#ifdef USE_AVX2
+  for (; i + 8 <= numPacketElements; i += 8)
+  {
+    simdReprojectSubblocks8(sphericalR + i, sphericalTheta + i, sphericalPhi + i, cart2DX + i, cart2DY + i, param, fixedX + i, fixedY + i);
+  }
+#endif
+  for (; i + 4 <= numPacketElements; i += 4)
+  {
+    simdReprojectSubblocks4<vext>(sphericalR + i, sphericalTheta + i, sphericalPhi + i, cart2DX + i, cart2DY + i, param, fixedX + i, fixedY + i);
+  }
+
+  // Scalar tail
+  TCoord fixedFloatX, fixedFloatY;
+  for (; i < numElements; ++i)
+  {
+    const TCoord thetaMoved = GeodesicReprojection::moveTheta(param, sphericalTheta[i]);
+    const TCoord phiMoved = sphericalPhi[i] + param.phiShift;
+    GeodesicReprojection::movedPosition(param, sphericalR[i], std::sin(thetaMoved), std::cos(thetaMoved), std::sin(phiMoved), std::cos(phiMoved),
+                                        cart2DX[i], cart2DY[i], fixedFloatX, fixedFloatY);
+    fixedX[i] = int(std::round(fixedFloatX));
+    fixedY[i] = int(std::round(fixedFloatY));
+  }
+}
+
+template <X86_VEXT vext>
+void GeodesicReprojection::_initGeodesicReprojectionX86()
+{
+  m_reprojectSubblocks = simdReprojectSubblocks<vext>;
+}
+
+template void GeodesicReprojection::_initGeodesicReprojectionX86<SIMDX86>();
+
+#endif //#if ENABLE_SIMD_OPT_GED
+
+#endif //#ifdef TARGET_SIMD_X86
+//! \}
@@ -50,6 +50,8 @@
 
 #include "CommonLib/IbcHashMap.h"
 
+#include "CommonLib/GeodesicReprojection.h"
+
 #ifdef TARGET_SIMD_X86
 
 
@@ -186,5 +188,27 @@ void IbcHashMap::initIbcHashMapX86()
 }
 #endif
 
+#if ENABLE_SIMD_OPT_GED
+void GeodesicReprojection::initGeodesicReprojectionX86()
+{
+  auto vext = read_x86_extension_flags();
+  switch (vext)
+  {
+  case AVX512:
+  case AVX2:
+    _initGeodesicReprojectionX86<AVX2>();
+    break;
+  case AVX:
+    _initGeodesicReprojectionX86<AVX>();
+    break;
+  case SSE42:
+  case SSE41:
+    _initGeodesicReprojectionX86<SSE41>();
+    break;
+  default:
+    break;
+  }
+}
 #endif
 
+#endif
@@ -2466,6 +2466,182 @@ void xWeightedGeoBlk_SSE(const PredictionUnit &pu, const uint32_t width, const u
   }
 }
 
+#if !RExt__HIGH_BIT_DEPTH_SUPPORT
+// SIMD separable 8-tap interpolation of a 4x4 luma subblock, the intermediate rows stay in registers
+template<X86_VEXT vext, bool isLast>
+static void simdFilterSubblock4x4(const ClpRng &clpRng, const int16_t *src, const ptrdiff_t srcStride, int16_t *dst,
+                                  const ptrdiff_t dstStride, const int16_t *coeffHor, const int16_t *coeffVer)
+{
+  static constexpr int TMP_HEIGHT = 4 + NTAPS_LUMA - 1;
+
+  const int headRoom  = IF_INTERNAL_FRAC_BITS(clpRng.bd);
+  const int shiftHor  = IF_FILTER_PREC - headRoom;
+  const int offsetHor = -(IF_INTERNAL_OFFS << shiftHor);
+  const int shiftVer  = isLast ? IF_FILTER_PREC + headRoom : IF_FILTER_PREC;
+  const int offsetVer = isLast ? (1 << (shiftVer - 1)) + (IF_INTERNAL_OFFS << IF_FILTER_PREC) : 0;
+
+  const __m128i minVal = _mm_set1_epi16(clpRng.min);
+  const __m128i maxVal = _mm_set1_epi16(clpRng.max);
+
+  const __m128i shuffle0 = _mm_setr_epi8(0, 1, 2, 3, 2, 3, 4, 5, 4, 5, 6, 7, 6, 7, 8, 9);
+  const __m128i shuffle1 = _mm_setr_epi8(4, 5, 6, 7, 6, 7, 8, 9, 8, 9, 10, 11, 10, 11, 12, 13);
+
+  __m128i cHor[4], cVer[4];
+  const __m128i cH = _mm_loadu_si128((__m128i const *) coeffHor);
+  const __m128i cV = _mm_loadu_si128((__m128i const *) coeffVer);
+  cHor[0] = _mm_shuffle_epi32(cH, 0x00);
+  cHor[1] = _mm_shuffle_epi32(cH, 0x55);
+  cHor[2] = _mm_shuffle_epi32(cH, 0xaa);
+  cHor[3] = _mm_shuffle_epi32(cH, 0xff);
+  cVer[0] = _mm_shuffle_epi32(cV, 0x00);
+  cVer[1] = _mm_shuffle_epi32(cV, 0x55);
+  cVer[2] = _mm_shuffle_epi32(cV, 0xaa);
+  cVer[3] = _mm_shuffle_epi32(cV, 0xff);
+
+  src -= (NTAPS_LUMA / 2 - 1) * (srcStride + 1);
+
+  __m128i tmp[TMP_HEIGHT];
+  for (int row = 0; row < TMP_HEIGHT; row++)
+  {
+    const __m128i val0 = _mm_loadu_si128((const __m128i *) (src + row * srcStride));
+    const __m128i val1 = _mm_loadu_si128((const __m128i *) (src + row * srcStride + 4));
+
+    __m128i vsum = _mm_set1_epi32(offsetHor);
+    vsum = _mm_add_epi32(vsum, _mm_madd_epi16(_mm_shuffle_epi8(val0, shuffle0), cHor[0]));
+    vsum = _mm_add_epi32(vsum, _mm_madd_epi16(_mm_shuffle_epi8(val0, shuffle1), cHor[1]));
+    vsum = _mm_add_epi32(vsum, _mm_madd_epi16(_mm_shuffle_epi8(val1, shuffle0), cHor[2]));
+    vsum = _mm_add_epi32(vsum, _mm_madd_epi16(_mm_shuffle_epi8(val1, shuffle1), cHor[3]));
+    vsum = _mm_sra_epi32(vsum, _mm_cvtsi32_si128(shiftHor));
+    tmp[row] = _mm_packs_epi32(vsum, vsum);
+  }
+
+  for (int row = 0; row < 4; row++)
+  {
+    __m128i vsum = _mm_set1_epi32(offsetVer);
+    for (int i = 0; i < NTAPS_LUMA / 2; i++)
+    {
+      vsum = _mm_add_epi32(vsum, _mm_madd_epi16(_mm_unpacklo_epi16(tmp[row + 2 * i], tmp[row + 2 * i + 1]), cVer[i]));
+    }
+    vsum = _mm_sra_epi32(vsum, _mm_cvtsi32_si128(shiftVer));
+    vsum = _mm_packs_epi32(vsum, vsum);
+
+    if (isLast)
+    {
+      vsum = _mm_min_epi16(vsum, maxVal);
+      vsum = _mm_max_epi16(vsum, minVal);
+    }
+
+    _mm_storel_epi64((__m128i *) (dst + row * dstStride), vsum);
+  }
+}
+
+#ifdef USE_AVX2
+// AVX2 variant of simdFilterSubblock4x4 interpolating two subblocks with individual phases, one per 128-bit lane
+template<bool isLast>
+static void simdFilterSubblockPair4x4_AVX2(const ClpRng &clpRng, const int16_t *srcA, const int16_t *srcB,
+                                           const ptrdiff_t srcStride, int16_t *dstA, int16_t *dstB,
+                                           const ptrdiff_t dstStride, const int16_t *coeffHorA,
+                                           const int16_t *coeffHorB, const int16_t *coeffVerA,
+                                           const int16_t *coeffVerB)
+{
+  static constexpr int TMP_HEIGHT = 4 + NTAPS_LUMA - 1;
+
+  const int headRoom  = IF_INTERNAL_FRAC_BITS(clpRng.bd);
+  const int shiftHor  = IF_FILTER_PREC - headRoom;
+  const int offsetHor = -(IF_INTERNAL_OFFS << shiftHor);
+  const int shiftVer  = isLast ? IF_FILTER_PREC + headRoom : IF_FILTER_PREC;
+  const int offsetVer = isLast ? (1 << (shiftVer - 1)) + (IF_INTERNAL_OFFS << IF_FILTER_PREC) : 0;
+
+  const __m256i minVal = _mm256_set1_epi16(clpRng.min);
+  const __m256i maxVal = _mm256_set1_epi16(clpRng.max);
+
+  const __m256i shuffle0 = _mm256_setr_epi8(0, 1, 2, 3, 2, 3, 4, 5, 4, 5, 6, 7, 6, 7, 8, 9,
+                                            0, 1, 2, 3, 2, 3, 4, 5, 4, 5, 6, 7, 6, 7, 8, 9);
+  const __m256i shuffle1 = _mm256_setr_epi8(4, 5, 6, 7, 6, 7, 8, 9, 8, 9, 10, 11, 10, 11, 12, 13,
+                                            4, 5, 6, 7, 6, 7, 8, 9, 8, 9, 10, 11, 10, 11, 12, 13);
+
+  __m256i cHor[4], cVer[4];
+  const __m256i cH = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((__m128i const *) coeffHorA)),
+                                             _mm_loadu_si128((__m128i const *) coeffHorB), 1);
+  const __m256i cV = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((__m128i const *) coeffVerA)),
+                                             _mm_loadu_si128((__m128i const *) coeffVerB), 1);
+  cHor[0] = _mm256_shuffle_epi32(cH, 0x00);
+  cHor[1] = _mm256_shuffle_epi32(cH, 0x55);
+  cHor[2] = _mm256_shuffle_epi32(cH, 0xaa);
+  cHor[3] = _mm256_shuffle_epi32(cH, 0xff);
+  cVer[0] = _mm256_shuffle_epi32(cV, 0x00);
+  cVer[1] = _mm256_shuffle_epi32(cV, 0x55);
+  cVer[2] = _mm256_shuffle_epi32(cV, 0xaa);
+  cVer[3] = _mm256_shuffle_epi32(cV, 0xff);
+
+  srcA -= (NTAPS_LUMA / 2 - 1) * (srcStride + 1);
+  srcB -= (NTAPS_LUMA / 2 - 1) * (srcStride + 1);
+
+  __m256i tmp[TMP_HEIGHT];
+  for (int row = 0; row < TMP_HEIGHT; row++)
+  {
+    const __m256i val0 =
+      _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((const __m128i *) (srcA + row * srcStride))),
+                              _mm_loadu_si128((const __m128i *) (srcB + row * srcStride)), 1);
+    const __m256i val1 =
+      _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((const __m128i *) (srcA + row * srcStride + 4))),
+                              _mm_loadu_si128((const __m128i *) (srcB + row * srcStride + 4)), 1);
+
+    __m256i vsum = _mm256_set1_epi32(offsetHor);
+    vsum = _mm256_add_epi32(vsum, _mm256_madd_epi16(_mm256_shuffle_epi8(val0, shuffle0), cHor[0]));
+    vsum = _mm256_add_epi32(vsum, _mm256_madd_epi16(_mm256_shuffle_epi8(val0, shuffle1), cHor[1]));
+    vsum = _mm256_add_epi32(vsum, _mm256_madd_epi16(_mm256_shuffle_epi8(val1, shuffle0), cHor[2]));
+    vsum = _mm256_add_epi32(vsum, _mm256_madd_epi16(_mm256_shuffle_epi8(val1, shuffle1), cHor[3]));
+    vsum = _mm256_sra_epi32(vsum, _mm_cvtsi32_si128(shiftHor));
+    tmp[row] = _mm256_packs_epi32(vsum, vsum);
+  }
+
+  for (int row = 0; row < 4; row++)
+  {
+    __m256i vsum = _mm256_set1_epi32(offsetVer);
+    for (int i = 0; i < NTAPS_LUMA / 2; i++)
+    {
+      vsum = _mm256_add_epi32(vsum,
+                              _mm256_madd_epi16(_mm256_unpacklo_epi16(tmp[row + 2 * i], tmp[row + 2 * i + 1]), cVer[i]));
+    }
+    vsum = _mm256_sra_epi32(vsum, _mm_cvtsi32_si128(shiftVer));
+    vsum = _mm256_packs_epi32(vsum, vsum);
+
+    if (isLast)
+    {
+      vsum = _mm256_min_epi16(vsum, maxVal);
+      vsum = _mm256_max_epi16(vsum, minVal);
+    }
+
+    _mm_storel_epi64((__m128i *) (dstA + row * dstStride), _mm256_castsi256_si128(vsum));
+    _mm_storel_epi64((__m128i *) (dstB + row * dstStride), _mm256_extracti128_si256(vsum, 1));
+  }
+}
+#endif
+
+template<X86_VEXT vext, bool isLast>
+static void simdFilterSubblocks4x4(const ClpRng &clpRng, Pel const *const *src, const ptrdiff_t srcStride,
+                                   Pel *const *dst, const ptrdiff_t dstStride, TFilterCoeff const *const *coeffHor,
+                                   TFilterCoeff const *const *coeffVer, int numSubblocks)
+{
+  int i = 0;
+#ifdef USE_AVX2
+  if (vext >= AVX2)
+  {
+    for (; i + 1 < numSubblocks; i += 2)
+    {
+      simdFilterSubblockPair4x4_AVX2<isLast>(clpRng, src[i], src[i + 1], srcStride, dst[i], dst[i + 1], dstStride,
+                                             coeffHor[i], coeffHor[i + 1], coeffVer[i], coeffVer[i + 1]);
+    }
+  }
+#endif
+  for (; i < numSubblocks; i++)
+  {
+    simdFilterSubblock4x4<vext, isLast>(clpRng, src[i], srcStride, dst[i], dstStride, coeffHor[i], coeffVer[i]);
+  }
+}
+#endif
+
 template <X86_VEXT vext>
 void InterpolationFilter::_initInterpolationFilterX86()
 {
@@ -2559,6 +2735,9 @@ void InterpolationFilter::_initInterpolationFilterX86()
   m_filterCopy[1][0]   = simdFilterCopy<vext, true, false>;
   m_filterCopy[1][1]   = simdFilterCopy<vext, true, true>;
 
+  m_filterSubblocks4x4[0] = simdFilterSubblocks4x4<vext, false>;
+  m_filterSubblocks4x4[1] = simdFilterSubblocks4x4<vext, true>;
+
   m_weightedGeoBlk = xWeightedGeoBlk_SSE<vext>;
 #endif
 }
@@ -0,0 +1 @@
+#include "../GeodesicReprojectionX86.h"
@@ -419,6 +419,9 @@ DecLib::DecLib()
   , m_sdiSEIInFirstAU(nullptr)
   , m_maiSEIInFirstAU(nullptr)
   , m_mvpSEIInFirstAU(nullptr)
+  , m_gedTableThreads(0)
+  , m_gedTableMemoryBudget(0)
+  , m_reconThreads(0)
   , m_cIntraPred()
   , m_cInterPred()
   , m_cTrQuant()
@@ -547,6 +550,7 @@ void DecLib::init(
 )
 {
   m_cSliceDecoder.init( &m_CABACDecoder, &m_cCuDecoder );
+  m_cSliceDecoder.setLoopFilters( &m_deblockingFilter, &m_cSAO, &m_cALF );
 #if JVET_J0090_MEMORY_BANDWITH_MEASURE
   m_cacheModel.create( cacheCfgFileName );
   m_cacheModel.clear( );
@@ -571,6 +575,13 @@ void DecLib::deletePicBuffer ( )
   m_cALF.destroy();
   m_cSAO.destroy();
   m_deblockingFilter.destroy();
+  m_cSliceDecoder.setReconThreads(nullptr, nullptr);
+  m_reconThreadPool.reset();
+  for (auto &worker: m_reconWorkers)
+  {
+    worker->destroy();
+  }
+  m_reconWorkers.clear();
 #if JVET_J0090_MEMORY_BANDWITH_MEASURE
   m_cacheModel.reportSequence( );
   m_cacheModel.destroy( );
@@ -677,10 +688,17 @@ void DecLib::executeLoopFilters()
 
   CodingStructure& cs = *m_pcPic->cs;
 
+  // with ReconThreads, the loop filters ran on the CTU rows of the picture behind the reconstruction
+  const bool filterCtuRows = m_cSliceDecoder.getFilterCtuRows();
+  if (filterCtuRows)
+  {
+    m_cSliceDecoder.finishCtuRows(cs);
+  }
+
   if (cs.sps->getUseLmcs() && cs.picHeader->getLmcsEnabledFlag())
   {
     const PreCalcValues &pcv = *cs.pcv;
-    for (uint32_t yPos = 0; yPos < pcv.lumaHeight; yPos += pcv.maxCUHeight)
+    for (uint32_t yPos = 0; yPos < pcv.lumaHeight && !filterCtuRows; yPos += pcv.maxCUHeight)
     {
       for (uint32_t xPos = 0; xPos < pcv.lumaWidth; xPos += pcv.maxCUWidth)
       {
@@ -698,9 +716,18 @@ void DecLib::executeLoopFilters()
     m_cSAO.setReshaper(&m_cReshaper);
   }
   // deblocking filter
-  m_deblockingFilter.deblockingFilterPic( cs );
+  if (filterCtuRows)
+  {
+    // the slice that deblockingFilterPic() leaves in cs, that of the last CTU
+    const PreCalcValues &pcv = *cs.pcv;
+    cs.slice = cs.getCU(Position((pcv.widthInCtus - 1) << pcv.maxCUWidthLog2, (pcv.heightInCtus - 1) << pcv.maxCUHeightLog2), CH_L)->slice;
+  }
+  else
+  {
+    m_deblockingFilter.deblockingFilterPic(cs);
+  }
   CS::setRefinedMotionField(cs);
-  if( cs.sps->getSAOEnabledFlag() )
+  if( cs.sps->getSAOEnabledFlag() && !filterCtuRows )
   {
     m_cSAO.SAOProcess( cs, cs.picture->getSAO() );
   }
@@ -708,10 +735,29 @@ void DecLib::executeLoopFilters()
   if( cs.sps->getALFEnabledFlag() )
   {
     m_cALF.getCcAlfFilterParam() = cs.slice->m_ccAlfFilterParam;
-    // ALF decodes the differentially coded coefficients and stores them in the parameters structure.
-    // Code could be restructured to do directly after parsing. So far we just pass a fresh non-const
-    // copy in case the APS gets used more than once.
-    m_cALF.ALFProcess(cs);
+    if (filterCtuRows)
+    {
+      // the slice and CC-ALF parameters that ALFProcess() leaves, those of the last CTU filtered by ALF
+      const PreCalcValues &pcv = *cs.pcv;
+      for (int ctuRsAddr = int(pcv.sizeInCtus) - 1; ctuRsAddr >= 0; ctuRsAddr--)
+      {
+        const Position pos((ctuRsAddr % pcv.widthInCtus) << pcv.maxCUWidthLog2, (ctuRsAddr / pcv.widthInCtus) << pcv.maxCUHeightLog2);
+        Slice *ctuSlice = cs.getCU(pos, CH_L)->slice;
+        if (ctuSlice->getAlfEnabledFlag(COMPONENT_Y) || ctuSlice->getAlfEnabledFlag(COMPONENT_Cb) || ctuSlice->getAlfEnabledFlag(COMPONENT_Cr))
+        {
+          cs.slice = ctuSlice;
+          m_cALF.getCcAlfFilterParam() = ctuSlice->m_ccAlfFilterParam;
+          break;
+        }
+      }
+    }
+    else
+    {
+      // ALF decodes the differentially coded coefficients and stores them in the parameters structure.
+      // Code could be restructured to do directly after parsing. So far we just pass a fresh non-const
+      // copy in case the APS gets used more than once.
+      m_cALF.ALFProcess(cs);
+    }
   }
 
   for (int i = 0; i < cs.pps->getNumSubPics() && m_targetSubPicIdx; i++)
@@ -774,6 +820,7 @@ void DecLib::finishPictureLight(int& poc, PicList*& rpcListPic )
       }
     }
   }
+  m_pcPic->compressMotion();
   m_pcPic->reconstructed = true;
 
   Slice::sortPicList( m_cListPic ); // sorting for application output
@@ -945,6 +992,7 @@ void DecLib::finishPicture(int &poc, PicList *&rpcListPic, MsgLevel msgl, bool a
       }
     }
   }
+  m_pcPic->compressMotion();
   m_pcPic->reconstructed = true;
 
   // process buffered suffix APS NALUs
@@ -1983,7 +2031,8 @@ void DecLib::xActivateParameterSets( const InputNALUnit nalu )
     m_pcPic->createGrainSynthesizer(m_firstPictureInSequence, &m_grainCharacteristic, &m_grainBuf, pps->getPicWidthInLumaSamples(), pps->getPicHeightInLumaSamples(), sps->getChromaFormatIdc(), sps->getBitDepth(CHANNEL_TYPE_LUMA));
     m_pcPic->createColourTransfProcessor(m_firstPictureInSequence, &m_colourTranfParams, &m_invColourTransfBuf, pps->getPicWidthInLumaSamples(), pps->getPicHeightInLumaSamples(), sps->getChromaFormatIdc(), sps->getBitDepth(CHANNEL_TYPE_LUMA));
     m_firstPictureInSequence = false;
-    m_pcPic->createTempBuffers( m_pcPic->cs->pps->pcv->maxCUWidth );
+    // the CTU rows reconstructed concurrently each need their own prediction and residual buffers
+    m_pcPic->createTempBuffers( m_pcPic->cs->pps->pcv->maxCUWidth, m_reconThreads > 0 );
     m_pcPic->cs->createCoeffs((bool)m_pcPic->cs->sps->getPLTMode());
 
     m_pcPic->allocateNewSlice();
@@ -2026,6 +2075,11 @@ void DecLib::xActivateParameterSets( const InputNALUnit nalu )
 
       if (sps->getUseGED()) {
         m_epipoleList.addEpipole(FloatingFixedConversion::fixedToFloating(sps->getGlobalEpipole(), EPIPOLE_PRECISION_FIXED), -1, -1, true);
+        m_mvReprojection.setTableBudget(size_t(m_gedTableMemoryBudget) << 20);
+        if (m_gedTableThreads > 0)
+        {
+          m_gedTableThreadPool.reset(new ThreadPool(m_gedTableThreads));
+        }
       }
     }
 
@@ -2088,6 +2142,24 @@ void DecLib::xActivateParameterSets( const InputNALUnit nalu )
     }
     m_cTrQuant.init(m_cTrQuantScalingList.getQuant(), sps->getMaxTbSize(), false, false, false, false);
 
+    // Tools of the CTU row reconstruction workers, set up like the ones above
+    if (m_reconThreads > 0)
+    {
+      if (!m_reconThreadPool)
+      {
+        m_reconThreadPool.reset(new ThreadPool(m_reconThreads));
+        for (int i = 0; i < m_reconThreadPool->numThreads(); i++)
+        {
+          m_reconWorkers.emplace_back(new DecWppWorker);
+        }
+        m_cSliceDecoder.setReconThreads(m_reconThreadPool.get(), &m_reconWorkers);
+      }
+      for (auto &worker: m_reconWorkers)
+      {
+        worker->init(*sps, m_cTrQuantScalingList.getQuant(), m_mvReprojection);
+      }
+    }
+
     // RdCost
     m_cRdCost.setCostMode ( COST_STANDARD_LOSSY ); // not used in decoder side RdCost stuff -> set to default
 
@@ -3115,6 +3187,10 @@ bool DecLib::xDecodeSlice(InputNALUnit &nalu, int &iSkipFrame, int iPOCLastDispl
     // Multi-model
     if(m_picHeader.getPicInterSliceAllowedFlag() && sps->getUseGED())
     {
+      // Drop the epipoles of pictures no longer used for reference.
+      m_epipoleList.retireUnreferenced(m_cListPic);
+      m_epipoleList.eraseRetired();
+
       const auto epipolePredictor = FloatingFixedConversion::floatingToFixed(m_epipoleList.derivePredictor(pcSlice->getPOC()), EPIPOLE_PRECISION_FIXED);
       const auto epipoleDelta = m_picHeader.getEpipoleDelta();
       const auto epipoleSpherical = FloatingFixedConversion::fixedToFloating(Array2Fixed(epipolePredictor + epipoleDelta), EPIPOLE_PRECISION_FIXED);
@@ -3436,6 +3512,13 @@ bool DecLib::xDecodeSlice(InputNALUnit &nalu, int &iSkipFrame, int iPOCLastDispl
     }
   }
 #endif // GDR_LEAK_TEST
+
+  // Multi-model: build the coordinate tables of all reference epipoles before the CTU loop
+  if (m_gedTableThreadPool && pcSlice->getSPS()->getUseGED())
+  {
+    m_mvReprojection.prepareTables(*pcSlice, m_gedTableThreadPool.get());
+  }
+
   //  Decode a picture
   m_cSliceDecoder.decompressSlice( pcSlice, &( nalu.getBitstream() ), ( m_pcPic->poc == getDebugPOC() ? getDebugCTU() : -1 ) );
 
@@ -45,6 +45,7 @@
 #include "CacheModel.h"
 
 #include "CommonLib/CommonDef.h"
+#include "CommonLib/ThreadPool.h"
 #include "CommonLib/Picture.h"
 #include "CommonLib/TrQuant.h"
 #include "CommonLib/InterPrediction.h"
@@ -103,6 +104,13 @@ private:
   Projection*               m_projection;                        ///< 360/fisheye projection
   EpipoleList               m_epipoleList;                       ///< Epipole list
   MVReprojection            m_mvReprojection;                    ///< Motion vector reprojection handler
+  int                       m_gedTableThreads;                   ///< Worker threads for the GED coordinate tables at slice start (0: build in the CTU loop)
+  int                       m_gedTableMemoryBudget;              ///< Memory budget for the GED coordinate tables in MiB (0: default)
+  std::unique_ptr<ThreadPool> m_gedTableThreadPool;              ///< Workers for the GED coordinate tables
+
+  int                       m_reconThreads;                      ///< Worker threads reconstructing and loop filtering the CTU rows (0: decode serially)
+  std::unique_ptr<ThreadPool> m_reconThreadPool;                 ///< Workers for the CTU row reconstruction and loop filters
+  std::vector<std::unique_ptr<DecWppWorker>> m_reconWorkers;     ///< Tools of the reconstruction workers
 
   // functional classes
   IntraPrediction         m_cIntraPred;
@@ -332,6 +340,9 @@ public:
 #endif
 
   void setEpipolePredictionMode(EpipoleList::PredictionMode predictionMode) { m_epipoleList.setPredictionMode(predictionMode); }
+  void setGEDTableThreads(int numThreads) { m_gedTableThreads = numThreads; }
+  void setReconThreads(int numThreads) { m_reconThreads = numThreads; }
+  void setGEDTableMemoryBudget(int budget) { m_gedTableMemoryBudget = budget; }
 
 protected:
   void  xUpdateRasInit(Slice* slice);
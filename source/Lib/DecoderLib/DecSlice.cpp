@@ -40,6 +40,8 @@
 #include "CommonLib/dtrace_next.h"
 #include "CommonLib/debug_tools.h"
 
+#include <condition_variable>
+#include <mutex>
 #include <vector>
 
 //! \ingroup DecoderLib
@@ -50,7 +52,16 @@
 //////////////////////////////////////////////////////////////////////
 
 DecSlice::DecSlice()
+  : m_reconThreadPool( nullptr )
+  , m_reconWorkers( nullptr )
+  , m_deblockingFilter( nullptr )
+  , m_sao( nullptr )
+  , m_alf( nullptr )
+  , m_filterCtuRows( false )
+  , m_ctuRowsAbort( false )
 {
+  std::fill_n( m_ctuRowsQueued, int( NUM_CTU_ROW_STAGES ), 0 );
+  std::fill_n( m_ctuRowsDone, int( NUM_CTU_ROW_STAGES ), 0 );
 }
 
 DecSlice::~DecSlice()
@@ -71,6 +82,19 @@ void DecSlice::init( CABACDecoder* cabacDecoder, DecCu* pcCuDecoder )
   m_pcCuDecoder     = pcCuDecoder;
 }
 
+void DecSlice::setReconThreads( ThreadPool* reconThreadPool, std::vector<std::unique_ptr<DecWppWorker>>* reconWorkers )
+{
+  m_reconThreadPool = reconThreadPool;
+  m_reconWorkers    = reconWorkers;
+}
+
+void DecSlice::setLoopFilters( DeblockingFilter* deblockingFilter, SampleAdaptiveOffset* sao, AdaptiveLoopFilter* alf )
+{
+  m_deblockingFilter = deblockingFilter;
+  m_sao              = sao;
+  m_alf              = alf;
+}
+
 void DecSlice::decompressSlice( Slice* slice, InputBitstream* bitstream, int debugCTU )
 {
   //-- For time output for each slice
@@ -118,6 +142,29 @@ void DecSlice::decompressSlice( Slice* slice, InputBitstream* bitstream, int deb
   const bool     wavefrontsEnabled           = cs.sps->getEntropyCodingSyncEnabledFlag();
   const bool     entryPointPresent           = cs.sps->getEntryPointsPresentFlag();
 
+  // parse the whole slice first and reconstruct its CTU rows concurrently afterwards, with the loop filters following
+  // the reconstruction row by row; parsing does not depend on the reconstruction except for IBC, which restricts the
+  // reference area per CTU row
+#if !ENABLE_TRACING && !RExt__DECODER_DEBUG_TOOL_STATISTICS
+  const bool     reconstructRows             = m_reconThreadPool && slice->getPPS()->getNumTiles() == 1
+                                               && slice->getPPS()->getNumSubPics() < 2 && !sps->getIBCFlag() && debugCTU < 0;
+#else
+  const bool     reconstructRows             = false;
+#endif
+  if( slice->getFirstCtuRsAddrInSlice() == 0 )
+  {
+    m_filterCtuRows = reconstructRows;
+    if( m_filterCtuRows )
+    {
+      m_ctuRowCtusQueued.assign( cs.pcv->heightInCtus, 0 );
+      m_ctuRowCtusDone  .assign( cs.pcv->heightInCtus, 0 );
+      std::fill_n( m_ctuRowsQueued, int( NUM_CTU_ROW_STAGES ), 0 );
+      std::fill_n( m_ctuRowsDone, int( NUM_CTU_ROW_STAGES ), 0 );
+      m_ctuRowsAbort = false;
+    }
+  }
+  CHECK( reconstructRows != m_filterCtuRows, "The slices of a picture must all be reconstructed serially or all on the CTU rows" );
+
   cabacReader.initBitstream( ppcSubstreams[0] );
   cabacReader.initCtxModels( *slice );
 
@@ -234,7 +281,10 @@ void DecSlice::decompressSlice( Slice* slice, InputBitstream* bitstream, int deb
     }
     cabacReader.coding_tree_unit( cs, ctuArea, pic->m_prevQP, ctuRsAddr );
 
-    m_pcCuDecoder->decompressCtu( cs, ctuArea );
+    if( !reconstructRows )
+    {
+      m_pcCuDecoder->decompressCtu( cs, ctuArea );
+    }
 
     if( ctuXPosInCtus == tileXPosInCtus && wavefrontsEnabled )
     {
@@ -289,6 +339,15 @@ void DecSlice::decompressSlice( Slice* slice, InputBitstream* bitstream, int deb
     }
   }
 
+  if( reconstructRows )
+  {
+    xQueueCtuRows( cs, slice );
+    m_reconThreadPool->waitForAll();
+
+    cs.motionLut = cs.ctuRowMotionLuts[slice->getCtuAddrInSlice( slice->getNumCtuInSlice() - 1 ) / widthInCtus];
+    cs.ctuRowMotionLuts.clear();
+  }
+
 //  // Requires KEEP_PRED_AND_RESI_SIGNALS = 1 in TypeDef.h
 //  auto predBuf = cs.getPredBuf();
 //  debug_tools::showYUV(predBuf, 10, "predbuf", -1, ("MM-VTM - PredBuf (POC: " + std::to_string(cs.slice->getPOC()) + ")").c_str() );
@@ -301,4 +360,207 @@ void DecSlice::decompressSlice( Slice* slice, InputBitstream* bitstream, int deb
   slice->stopProcessingTimer();
 }
 
+void DecSlice::finishCtuRows( CodingStructure& cs )
+{
+  // the stages in order, a stage reads the rows of the previous one up to a few rows below its own row
+  for( int stage = CTU_ROW_DEBLOCK; stage < NUM_CTU_ROW_STAGES; stage++ )
+  {
+    for( ; m_ctuRowsDone[stage] < int( cs.pcv->heightInCtus ); m_ctuRowsDone[stage]++ )
+    {
+      xFilterCtuRow( cs, CtuRowStage( stage ), m_ctuRowsDone[stage] );
+    }
+  }
+  m_filterCtuRows = false;
+}
+
+void DecSlice::xQueueCtuRows( CodingStructure& cs, Slice* slice )
+{
+  const PreCalcValues& pcv         = *cs.pcv;
+  const int            widthInCtus = int( pcv.widthInCtus );
+  const int            numCtus     = int( slice->getNumCtuInSlice() );
+
+  m_freeReconWorkers.clear();
+  for( auto &worker : *m_reconWorkers )
+  {
+    worker->initSlice( *slice, m_pcCuDecoder->getReshape() );
+    m_freeReconWorkers.push_back( worker.get() );
+  }
+
+  // each row continues the HMVP table of the CTU before it in the slice
+  cs.ctuRowMotionLuts.assign( pcv.heightInCtus, cs.motionLut );
+  cs.resetIBCBuffer = false;
+
+  // one task per CTU row of the slice, in row order, so a task only waits for tasks that are already running
+  for( int ctuIdx = 0; ctuIdx < numCtus; )
+  {
+    const int ctuRsAddr   = int( slice->getCtuAddrInSlice( ctuIdx ) );
+    const int y           = ctuRsAddr / widthInCtus;
+    const int xBegin      = ctuRsAddr % widthInCtus;
+    int       xEnd        = xBegin + 1;
+    for( ctuIdx++; ctuIdx < numCtus && int( slice->getCtuAddrInSlice( ctuIdx ) ) / widthInCtus == y; ctuIdx++, xEnd++ )
+    {
+      CHECK( int( slice->getCtuAddrInSlice( ctuIdx ) ) % widthInCtus != xEnd, "The CTUs of a slice in a CTU row must be consecutive" );
+    }
+
+    m_reconThreadPool->addTask( [this, &cs, slice, y, xBegin, xEnd, widthInCtus]
+    {
+      const PreCalcValues& pcv    = *cs.pcv;
+      DecWppWorker        *worker = nullptr;
+      {
+        std::unique_lock<std::mutex> lock( m_ctuRowMutex );
+        CHECK( m_freeReconWorkers.empty(), "No free recon worker" );
+        worker = m_freeReconWorkers.back();
+        m_freeReconWorkers.pop_back();
+      }
+
+      try
+      {
+        for( int x = xBegin; x < xEnd; x++ )
+        {
+          const Position pos( x * pcv.maxCUWidth, y * pcv.maxCUHeight );
+          const UnitArea ctuArea( cs.area.chromaFormat, Area( pos.x, pos.y, pcv.maxCUWidth, pcv.maxCUHeight ) );
+
+          // the CTU above right must be reconstructed
+          {
+            std::unique_lock<std::mutex> lock( m_ctuRowMutex );
+            m_ctuRowProgress.wait( lock, [&] { return m_ctuRowsAbort || y == 0 || m_ctuRowCtusDone[y - 1] >= std::min( x + 2, widthInCtus ); } );
+            if( m_ctuRowsAbort )
+            {
+              break;
+            }
+          }
+
+          if( x == 0 && slice->getSliceType() != I_SLICE )
+          {
+            cs.ctuRowMotionLuts[y].lut.resize( 0 );
+            cs.ctuRowMotionLuts[y].lutIbc.resize( 0 );
+          }
+
+          worker->getCuDecoder()->decompressCtu( cs, ctuArea );
+
+          {
+            std::lock_guard<std::mutex> lock( m_ctuRowMutex );
+            m_ctuRowCtusDone[y] = x + 1;
+            while( m_ctuRowsDone[CTU_ROW_RECON] < int( pcv.heightInCtus ) && m_ctuRowCtusDone[m_ctuRowsDone[CTU_ROW_RECON]] == widthInCtus )
+            {
+              m_ctuRowsDone[CTU_ROW_RECON]++;
+            }
+          }
+          m_ctuRowProgress.notify_all();
+        }
+      }
+      catch( ... )
+      {
+        {
+          std::lock_guard<std::mutex> lock( m_ctuRowMutex );
+          m_ctuRowsAbort = true;
+          m_freeReconWorkers.push_back( worker );
+        }
+        m_ctuRowProgress.notify_all();
+        throw;
+      }
+
+      std::lock_guard<std::mutex> lock( m_ctuRowMutex );
+      m_freeReconWorkers.push_back( worker );
+    } );
+
+    m_ctuRowCtusQueued[y] = xEnd;
+    while( m_ctuRowsQueued[CTU_ROW_RECON] < int( pcv.heightInCtus ) && m_ctuRowCtusQueued[m_ctuRowsQueued[CTU_ROW_RECON]] == widthInCtus )
+    {
+      m_ctuRowsQueued[CTU_ROW_RECON]++;
+    }
+    xQueueCtuRowFilters( cs );
+  }
+}
+
+void DecSlice::xQueueCtuRowFilters( CodingStructure& cs )
+{
+  // rows below its own that a stage reads from the previous stage: the deblocking follows the intra prediction of
+  // the row below, SAO reads the deblocked row below, whose bottom is deblocked with the row after it, and ALF reads
+  // the SAO output of the row below
+  static const int ctuRowStageLag[NUM_CTU_ROW_STAGES] = { 0, 1, 2, 1 };
+
+  const int lastRow = int( cs.pcv->heightInCtus ) - 1;
+  for( int stage = CTU_ROW_DEBLOCK; stage < NUM_CTU_ROW_STAGES; stage++ )
+  {
+    while( m_ctuRowsQueued[stage] <= lastRow && m_ctuRowsQueued[stage - 1] > std::min( m_ctuRowsQueued[stage] + ctuRowStageLag[stage], lastRow ) )
+    {
+      const int y = m_ctuRowsQueued[stage]++;
+      m_reconThreadPool->addTask( [this, &cs, stage, y, lastRow]
+      {
+        {
+          std::unique_lock<std::mutex> lock( m_ctuRowMutex );
+          m_ctuRowProgress.wait( lock, [&] { return m_ctuRowsAbort || ( m_ctuRowsDone[stage] == y
+                                                                        && m_ctuRowsDone[stage - 1] > std::min( y + ctuRowStageLag[stage], lastRow ) ); } );
+          if( m_ctuRowsAbort )
+          {
+            return;
+          }
+        }
+
+        try
+        {
+          xFilterCtuRow( cs, CtuRowStage( stage ), y );
+        }
+        catch( ... )
+        {
+          {
+            std::lock_guard<std::mutex> lock( m_ctuRowMutex );
+            m_ctuRowsAbort = true;
+          }
+          m_ctuRowProgress.notify_all();
+          throw;
+        }
+
+        {
+          std::lock_guard<std::mutex> lock( m_ctuRowMutex );
+          m_ctuRowsDone[stage] = y + 1;
+        }
+        m_ctuRowProgress.notify_all();
+      } );
+    }
+  }
+}
+
+void DecSlice::xFilterCtuRow( CodingStructure& cs, const CtuRowStage stage, const int y )
+{
+  const PreCalcValues& pcv = *cs.pcv;
+
+  switch( stage )
+  {
+  case CTU_ROW_DEBLOCK:
+    if( cs.sps->getUseLmcs() && cs.picHeader->getLmcsEnabledFlag() )
+    {
+      const uint32_t yPos = y * pcv.maxCUHeight;
+      for( uint32_t xPos = 0; xPos < pcv.lumaWidth; xPos += pcv.maxCUWidth )
+      {
+        const CodingUnit *cu = cs.getCU( Position( xPos, yPos ), CHANNEL_TYPE_LUMA );
+        if( cu->slice->getLmcsEnabledFlag() )
+        {
+          const uint32_t width  = ( xPos + pcv.maxCUWidth > pcv.lumaWidth ) ? ( pcv.lumaWidth - xPos ) : pcv.maxCUWidth;
+          const uint32_t height = ( yPos + pcv.maxCUHeight > pcv.lumaHeight ) ? ( pcv.lumaHeight - yPos ) : pcv.maxCUHeight;
+          const UnitArea area( cs.area.chromaFormat, Area( xPos, yPos, width, height ) );
+          cs.getRecoBuf( area ).get( COMPONENT_Y ).rspSignal( m_pcCuDecoder->getReshape()->getInvLUT() );
+        }
+      }
+    }
+    m_deblockingFilter->deblockingFilterCtuRow( cs, y );
+    break;
+  case CTU_ROW_SAO:
+    if( cs.sps->getSAOEnabledFlag() )
+    {
+      m_sao->SAOProcessCtuRow( cs, cs.picture->getSAO(), y );
+    }
+    break;
+  case CTU_ROW_ALF:
+    if( cs.sps->getALFEnabledFlag() )
+    {
+      m_alf->ALFProcessCtuRow( cs, y );
+    }
+    break;
+  default:
+    THROW( "Invalid CTU row stage" );
+  }
+}
+
 //! \}
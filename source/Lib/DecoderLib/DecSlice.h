@@ -46,6 +46,15 @@
 #include "CommonLib/BitStream.h"
 #include "DecCu.h"
 #include "CABACReader.h"
+#include "DecWppWorker.h"
+#include "CommonLib/ThreadPool.h"
+#include "CommonLib/DeblockingFilter.h"
+#include "CommonLib/SampleAdaptiveOffset.h"
+#include "CommonLib/AdaptiveLoopFilter.h"
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
 
 //! \ingroup DecoderLib
 //! \{
@@ -65,6 +74,32 @@ private:
   Ctx             m_entropyCodingSyncContextState;      ///< context storage for state of contexts at the wavefront/WPP/entropy-coding-sync second CTU of tile-row
   PLTBuf          m_palettePredictorSyncState;      /// palette predictor storage at wavefront/WPP
 
+  ThreadPool*     m_reconThreadPool;                                ///< threads reconstructing the CTU rows (ReconThreads)
+  std::vector<std::unique_ptr<DecWppWorker>>* m_reconWorkers;       ///< tools of the CTU row threads
+  std::vector<DecWppWorker*>                  m_freeReconWorkers;   ///< tools not used by a row of the current slice
+
+  DeblockingFilter*     m_deblockingFilter;                         ///< loop filters of DecLib, run on the CTU rows behind the reconstruction
+  SampleAdaptiveOffset* m_sao;
+  AdaptiveLoopFilter*   m_alf;
+
+  /// stages of the CTU rows of a picture decoded with ReconThreads, each row passes them in this order
+  enum CtuRowStage
+  {
+    CTU_ROW_RECON,                                                  ///< reconstruction, in wavefront order
+    CTU_ROW_DEBLOCK,                                                ///< LMCS inverse mapping and deblocking
+    CTU_ROW_SAO,
+    CTU_ROW_ALF,
+    NUM_CTU_ROW_STAGES
+  };
+  bool                    m_filterCtuRows;                          ///< the loop filters of the current picture run on its CTU rows
+  std::vector<int>        m_ctuRowCtusQueued;                       ///< CTUs of each row queued for reconstruction
+  std::vector<int>        m_ctuRowCtusDone;                         ///< CTUs of each row reconstructed
+  int                     m_ctuRowsQueued[NUM_CTU_ROW_STAGES];      ///< leading rows of the picture queued for each stage
+  int                     m_ctuRowsDone  [NUM_CTU_ROW_STAGES];      ///< leading rows of the picture through each stage
+  bool                    m_ctuRowsAbort;                           ///< a stage failed, the waiting rows give up
+  std::mutex              m_ctuRowMutex;
+  std::condition_variable m_ctuRowProgress;
+
 public:
   DecSlice();
   virtual ~DecSlice();
@@ -72,8 +107,26 @@ public:
   void  init              ( CABACDecoder* cabacDecoder, DecCu* pcMbDecoder );
   void  create            ();
   void  destroy           ();
+  /// reconstruct the CTU rows of the parsed slices on the given threads and tools (ReconThreads)
+  void  setReconThreads   ( ThreadPool* reconThreadPool, std::vector<std::unique_ptr<DecWppWorker>>* reconWorkers );
+  /// loop filters that run on the CTU rows with ReconThreads
+  void  setLoopFilters    ( DeblockingFilter* deblockingFilter, SampleAdaptiveOffset* sao, AdaptiveLoopFilter* alf );
 
   void  decompressSlice   ( Slice* slice, InputBitstream* bitstream, int debugCTU );
+
+  /// the loop filters of the current picture ran on its CTU rows behind the reconstruction (ReconThreads)
+  bool  getFilterCtuRows  () const { return m_filterCtuRows; }
+  /// filter the CTU rows of the current picture that are still missing after its last slice
+  void  finishCtuRows     ( CodingStructure& cs );
+
+private:
+  /// queue the reconstruction of the parsed CTU rows of the slice on the recon workers, each row trailing the row
+  /// above by two CTUs, and the loop filters of the rows as they become ready
+  void  xQueueCtuRows     ( CodingStructure& cs, Slice* slice );
+  /// queue the loop filter stages of the rows whose preceding stage covers the rows they read
+  void  xQueueCtuRowFilters( CodingStructure& cs );
+  /// run stage of CTU row y
+  void  xFilterCtuRow     ( CodingStructure& cs, CtuRowStage stage, int y );
 };
 
 //! \}
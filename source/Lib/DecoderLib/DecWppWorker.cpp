@@ -0,0 +1,48 @@
+//
+// Decoder tools of one worker thread of the wavefront-parallel CTU reconstruction (ReconThreads).
+//
+
+#include "DecWppWorker.h"
+
+
+void DecWppWorker::init(const SPS &sps, const Quant *quant, const MVReprojection &mvReprojection)
+{
+  // keep the caches while the reprojection data of DecLib stays the same
+  if (mvReprojection.isInitialized() && m_mvReprojection.getData() != mvReprojection.getData())
+  {
+    m_mvReprojection.init(mvReprojection.getData());
+  }
+
+  m_intraPred.init(sps.getChromaFormatIdc(), sps.getBitDepth(CHANNEL_TYPE_LUMA));
+  m_interPred.init(&m_rdCost, sps.getChromaFormatIdc(), sps.getMaxCUHeight(), &m_mvReprojection);
+  if (sps.getUseLmcs())
+  {
+    m_reshaper.createDec(sps.getBitDepth(CHANNEL_TYPE_LUMA));
+  }
+
+  m_cuDecoder.init(&m_trQuant, &m_intraPred, &m_interPred);
+  if (sps.getUseLmcs())
+  {
+    m_cuDecoder.initDecCuReshaper(&m_reshaper, sps.getChromaFormatIdc());
+  }
+  // shares the scaling lists of the decoder's quantizer
+  m_trQuant.init(quant, sps.getMaxTbSize(), false, false, false, false);
+
+  m_rdCost.setCostMode(COST_STANDARD_LOSSY);
+}
+
+void DecWppWorker::destroy()
+{
+  m_cuDecoder.destoryDecCuReshaprBuf();
+  m_reshaper.destroy();
+}
+
+void DecWppWorker::initSlice(Slice &slice, const Reshape *reshaper)
+{
+  m_trQuant.getQuant()->setUseScalingList(slice.getExplicitScalingListUsed());
+
+  if (slice.getSPS()->getUseLmcs())
+  {
+    m_reshaper = *reshaper;
+  }
+}
@@ -0,0 +1,45 @@
+//
+// Decoder tools of one worker thread of the wavefront-parallel CTU reconstruction (ReconThreads).
+//
+
+#pragma once
+
+#include "CommonLib/InterPrediction.h"
+#include "CommonLib/IntraPrediction.h"
+#include "CommonLib/MVReprojection.h"
+#include "CommonLib/RdCost.h"
+#include "CommonLib/Reshape.h"
+#include "CommonLib/TrQuant.h"
+
+#include "DecCu.h"
+
+
+/**
+ * Own instances of the CU decoder and of the prediction and transform tools it uses, set up like those of DecLib. One
+ * worker reconstructs one CTU row at a time; DecSlice hands the rows of a slice to the workers in wavefront order.
+ */
+class DecWppWorker {
+public:
+  DecWppWorker() = default;
+
+  DecWppWorker(const DecWppWorker&) = delete;
+  DecWppWorker& operator=(const DecWppWorker&) = delete;
+
+  /** @brief Create the tools for the sequence, sharing the scaling lists of quant and the reprojection data of mvReprojection. */
+  void init(const SPS &sps, const Quant *quant, const MVReprojection &mvReprojection);
+  void destroy();
+
+  /** @brief Take over the slice level state of the tools of DecLib (scaling list usage, reshaper if LMCS is used). */
+  void initSlice(Slice &slice, const Reshape *reshaper);
+
+  DecCu*            getCuDecoder()                    { return &m_cuDecoder; }
+
+protected:
+  DecCu            m_cuDecoder;
+  IntraPrediction  m_intraPred;
+  InterPrediction  m_interPred;
+  TrQuant          m_trQuant;
+  RdCost           m_rdCost;
+  Reshape          m_reshaper;
+  MVReprojection   m_mvReprojection;  ///< Context on the reprojection data of DecLib with the caches of this worker
+};
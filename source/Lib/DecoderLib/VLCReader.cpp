@@ -1968,6 +1968,10 @@ void HLSyntaxReader::parseSPS(SPS* pcSPS)
     if (pcSPS->getUseGED()) {
       READ_UVLC(uiCode, "sps_ged_flavor");
       pcSPS->setGEDFlavor(static_cast<GeodesicMotionModel::Flavor>(uiCode));
+      READ_FLAG(uiCode, "sps_ged_fixed_point_flag");
+      pcSPS->setUseGEDFixedPoint(uiCode != 0);
+      READ_FLAG(uiCode, "sps_ged_dmvr_window_flag");
+      pcSPS->setUseGEDDMVRWindow(uiCode != 0);
     }
 
     READ_FLAG(uiCode, "sps_mmmvp_enabled_flag");
@@ -50,6 +50,7 @@
 #include "CommonLib/MotionModels/GeodesicMotionModel.h"
 
 #include "EncCfgParam.h"
+#include "EncMotionSeeds.h"
 
 using namespace EncCfgParam;
 
@@ -374,11 +375,19 @@ protected:
 
   bool      m_GED;
   GeodesicMotionModel::Flavor m_GEDFlavor;
+  bool      m_GEDFixedPoint;
+  bool      m_GEDDMVRWindow;
   EpipoleList m_epipoleList;
   int       m_MMSizeConstraint;
   bool      m_MMMVP;
   int       m_MMOffset4x4;
   int       m_projectionFct;
+  int       m_GEDTableThreads;
+  int       m_GEDTableMemoryBudget;
+  bool      m_GEDFastSearch;
+  int       m_GEDFastDecision;
+  bool      m_GEDSeedSearch;
+  bool      m_epipoleEstimation;
 
   bool      m_allowDisFracMMVD;
   bool      m_AffineAmvr;
@@ -549,6 +558,8 @@ protected:
   bool      m_gopBasedTemporalFilterEnabled;
   bool      m_bimEnabled;
   std::map<int, int*> m_adaptQPmap;
+  bool      m_gopBasedTemporalFilterMotionSeeds;
+  EncMotionSeeds m_motionSeeds;
   bool      m_noPicPartitionFlag;                             ///< no picture partitioning flag (single tile, single slice)
   bool      m_mixedLossyLossless;                             ///< enable mixed lossy/lossless coding
 
@@ -566,6 +577,9 @@ protected:
   //====== Sub-picture and Slices ========
   bool      m_singleSlicePerSubPicFlag;
   bool      m_entropyCodingSyncEnabledFlag;
+  int       m_wppThreads;                                     ///< Worker threads encoding the CTU rows of a picture concurrently (0: serial)
+  bool      m_wppRowReset;                                    ///< Reset the encoder search state at each CTU row with WaveFrontSynchro
+  int       m_frameThreads;                                   ///< Pictures of a GOP compressed concurrently (0, 1: serial)
   bool      m_entryPointPresentFlag;                           ///< flag for the presence of entry points
 
   HashType  m_decodedPictureHashSEIType;
@@ -1352,6 +1366,10 @@ public:
   bool      getUseGED() const { return m_GED; }
   void      setGEDFlavor(GeodesicMotionModel::Flavor flavor) { m_GEDFlavor = flavor; }
   GeodesicMotionModel::Flavor getGEDFlavor() const { return m_GEDFlavor; }
+  void      setUseGEDFixedPoint(bool b) { m_GEDFixedPoint = b; }
+  bool      getUseGEDFixedPoint() const { return m_GEDFixedPoint; }
+  void      setUseGEDDMVRWindow(bool b) { m_GEDDMVRWindow = b; }
+  bool      getUseGEDDMVRWindow() const { return m_GEDDMVRWindow; }
   void      setEpipoleList(const EpipoleList &value) { m_epipoleList = value; }
   EpipoleList* getEpipoleList() { return &m_epipoleList; }
   void      setMMSizeConstraint(int value) { m_MMSizeConstraint = value; }
@@ -1362,6 +1380,18 @@ public:
   int       getMMOffset4x4() const { return m_MMOffset4x4; }
   void      setProjectionFct(int value) { m_projectionFct = value; }
   int       getProjectionFct() const { return m_projectionFct; }
+  void      setGEDTableThreads(int value) { m_GEDTableThreads = value; }
+  int       getGEDTableThreads() const { return m_GEDTableThreads; }
+  void      setGEDTableMemoryBudget(int value) { m_GEDTableMemoryBudget = value; }
+  int       getGEDTableMemoryBudget() const { return m_GEDTableMemoryBudget; }
+  void      setUseGEDFastSearch(bool b) { m_GEDFastSearch = b; }
+  bool      getUseGEDFastSearch() const { return m_GEDFastSearch; }
+  void      setGEDFastDecision(int value) { m_GEDFastDecision = value; }
+  int       getGEDFastDecision() const { return m_GEDFastDecision; }
+  void      setUseGEDSeedSearch(bool b) { m_GEDSeedSearch = b; }
+  bool      getUseGEDSeedSearch() const { return m_GEDSeedSearch; }
+  void      setUseEpipoleEstimation(bool b) { m_epipoleEstimation = b; }
+  bool      getUseEpipoleEstimation() const { return m_epipoleEstimation; }
 
   void      setAllowDisFracMMVD             ( bool b )       { m_allowDisFracMMVD = b;    }
   bool      getAllowDisFracMMVD             ()         const { return m_allowDisFracMMVD; }
@@ -1474,6 +1504,7 @@ public:
   bool      getDisableFastDecisionTT        () const         { return m_disableFastDecisionTT; }
 
   void      setLog2MaxTbSize                ( uint32_t  u )   { m_log2MaxTbSize = u; }
+  uint32_t  getLog2MaxTbSize                () const          { return m_log2MaxTbSize; }
 
   //====== Loop/Deblock Filter ========
   void      setDeblockingFilterDisable      ( bool  b )      { m_deblockingFilterDisable           = b; }
@@ -1637,6 +1668,7 @@ public:
   bool      getDisableIntraPUsInInterSlices    () const { return m_bDisableIntraPUsInInterSlices; }
   MESearchMethod getMotionEstimationSearchMethod ( ) const { return m_motionEstimationSearchMethod; }
   int       getSearchRange                     () const { return m_searchRange; }
+  int       getBipredSearchRange               () const { return m_bipredSearchRange; }
   bool      getClipForBiPredMeEnabled          () const { return m_bClipForBiPredMeEnabled; }
   bool      getFastMEAssumingSmootherMVEnabled () const { return m_bFastMEAssumingSmootherMVEnabled; }
   int       getMinSearchWindow                 () const { return m_minSearchWindow; }
@@ -1696,6 +1728,10 @@ public:
   void      setAdaptQPmap                   (std::map<int, int*> map) { m_adaptQPmap = map; }
   int*      getAdaptQPmap                   (int poc)                 { return m_adaptQPmap[poc]; }
   std::map<int, int*> *getAdaptQPmap        ()                        { return &m_adaptQPmap; }
+  void      setGopBasedTemporalFilterMotionSeeds(bool b)              { m_gopBasedTemporalFilterMotionSeeds = b; }
+  bool      getGopBasedTemporalFilterMotionSeeds() const              { return m_gopBasedTemporalFilterMotionSeeds; }
+  EncMotionSeeds*       getMotionSeeds      ()                        { return &m_motionSeeds; }
+  const EncMotionSeeds* getMotionSeeds      ()                  const { return &m_motionSeeds; }
 
   bool      getUseReconBasedCrossCPredictionEstimate ()                const { return m_reconBasedCrossCPredictionEstimate;  }
   void      setUseReconBasedCrossCPredictionEstimate (const bool value)      { m_reconBasedCrossCPredictionEstimate = value; }
@@ -1776,6 +1812,12 @@ public:
   bool  getSaoGreedyMergeEnc           ()                            { return m_saoGreedyMergeEnc; }
   void  setEntropyCodingSyncEnabledFlag(bool b)                      { m_entropyCodingSyncEnabledFlag = b; }
   bool  getEntropyCodingSyncEnabledFlag() const                      { return m_entropyCodingSyncEnabledFlag; }
+  void  setWppThreads(int i)                                         { m_wppThreads = i; }
+  int   getWppThreads() const                                        { return m_wppThreads; }
+  void  setWppRowReset(bool b)                                       { m_wppRowReset = b; }
+  bool  getWppRowReset() const                                       { return m_wppRowReset; }
+  void  setFrameThreads(int i)                                       { m_frameThreads = i; }
+  int   getFrameThreads() const                                      { return m_frameThreads; }
   void  setEntryPointPresentFlag(bool b)                             { m_entryPointPresentFlag = b; }
   void  setDecodedPictureHashSEIType(HashType m)                     { m_decodedPictureHashSEIType = m; }
   HashType getDecodedPictureHashSEIType() const                      { return m_decodedPictureHashSEIType; }
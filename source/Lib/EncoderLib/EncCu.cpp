@@ -58,8 +58,37 @@
 //! \ingroup EncoderLib
 //! \{
 
+/// Exclusive access to the picture coding structure for the concurrent rows of WppThreads, with the HMVP and palette
+/// predictor state of the row swapped in. Does nothing if the row is null.
+class CtuRowPictureLock
+{
+public:
+  CtuRowPictureLock( EncCtuRow* ctuRow, CodingStructure& cs ) : m_ctuRow( ctuRow ), m_cs( cs )
+  {
+    if( m_ctuRow )
+    {
+      m_ctuRow->picLock->lock();
+      std::swap( m_cs.motionLut, m_ctuRow->motionLut );
+      std::swap( m_cs.prevPLT,   m_ctuRow->prevPLT );
+    }
+  }
+  ~CtuRowPictureLock()
+  {
+    if( m_ctuRow )
+    {
+      std::swap( m_cs.motionLut, m_ctuRow->motionLut );
+      std::swap( m_cs.prevPLT,   m_ctuRow->prevPLT );
+      m_ctuRow->picLock->unlock();
+    }
+  }
+
+private:
+  EncCtuRow*       m_ctuRow;
+  CodingStructure& m_cs;
+};
+
 // ====================================================================================================================
-EncCu::EncCu() : m_GeoModeTest
+EncCu::EncCu() : m_ctuRow( nullptr ), m_GeoModeTest
 {
   GeoMotionInfo(0, 1), GeoMotionInfo(1, 0),GeoMotionInfo(0, 2), GeoMotionInfo(1, 2), GeoMotionInfo(2, 0),
   GeoMotionInfo(2, 1), GeoMotionInfo(0, 3),GeoMotionInfo(1, 3), GeoMotionInfo(2, 3), GeoMotionInfo(3, 0),
@@ -228,18 +257,26 @@ EncCu::~EncCu()
 /** \param    pcEncLib      pointer of encoder class
  */
 void EncCu::init( EncLib* pcEncLib, const SPS& sps )
+{
+  init( pcEncLib, sps, pcEncLib->getIntraSearch(), pcEncLib->getInterSearch(), pcEncLib->getTrQuant(),
+        pcEncLib->getRdCost(), pcEncLib->getCABACEncoder(), pcEncLib->getCtxCache(), pcEncLib->getDeblockingFilter() );
+}
+
+void EncCu::init( EncLib* pcEncLib, const SPS& sps, IntraSearch* pcIntraSearch, InterSearch* pcInterSearch,
+                  TrQuant* pcTrQuant, RdCost* pcRdCost, CABACEncoder* pcCABACEncoder, CtxCache* pcCtxCache,
+                  DeblockingFilter* pcDeblockingFilter )
 {
   m_pcEncCfg           = pcEncLib;
-  m_pcIntraSearch      = pcEncLib->getIntraSearch();
-  m_pcInterSearch      = pcEncLib->getInterSearch();
-  m_pcTrQuant          = pcEncLib->getTrQuant();
-  m_pcRdCost           = pcEncLib->getRdCost ();
-  m_CABACEstimator     = pcEncLib->getCABACEncoder()->getCABACEstimator( &sps );
+  m_pcIntraSearch      = pcIntraSearch;
+  m_pcInterSearch      = pcInterSearch;
+  m_pcTrQuant          = pcTrQuant;
+  m_pcRdCost           = pcRdCost;
+  m_CABACEstimator     = pcCABACEncoder->getCABACEstimator( &sps );
   m_CABACEstimator->setEncCu(this);
-  m_CtxCache           = pcEncLib->getCtxCache();
+  m_CtxCache           = pcCtxCache;
   m_pcRateCtrl         = pcEncLib->getRateCtrl();
   m_pcSliceEncoder     = pcEncLib->getSliceEncoder();
-  m_deblockingFilter   = pcEncLib->getDeblockingFilter();
+  m_deblockingFilter   = pcDeblockingFilter;
   m_GeoCostList.init(GEO_NUM_PARTITION_MODE, m_pcEncCfg->getMaxNumGeoCand());
   m_AFFBestSATDCost = MAX_DOUBLE;
 
@@ -257,13 +294,26 @@ void EncCu::init( EncLib* pcEncLib, const SPS& sps )
 // Public member functions
 // ====================================================================================================================
 
-void EncCu::compressCtu( CodingStructure& cs, const UnitArea& area, const unsigned ctuRsAddr, const int prevQP[], const int currQP[] )
+void EncCu::initCtuRow()
 {
+  m_pcInterSearch->resetAffineMVList();
+  m_pcInterSearch->resetUniMvList();
+  m_pcInterSearch->resetReusedUniMvs();
+  m_pcInterSearch->resetClassicMvInfo();
+  m_AFFBestSATDCost   = MAX_DOUBLE;
+  m_mergeBestSATDCost = MAX_DOUBLE;
+}
+
+void EncCu::compressCtu( CodingStructure& cs, const UnitArea& area, const unsigned ctuRsAddr, const int prevQP[], const int currQP[], EncCtuRow* ctuRow )
+{
+  m_ctuRow = ctuRow;
   m_modeCtrl->initCTUEncoding( *cs.slice );
-  cs.treeType = TREE_D;
 
-  cs.slice->m_mapPltCost[0].clear();
-  cs.slice->m_mapPltCost[1].clear();
+  if( cs.sps->getPLTMode() )
+  {
+    cs.slice->m_mapPltCost[0].clear();
+    cs.slice->m_mapPltCost[1].clear();
+  }
   // init the partitioning manager
   QTBTPartitioner partitioner;
   partitioner.initCtu(area, CH_L, *cs.slice);
@@ -297,19 +347,29 @@ void EncCu::compressCtu( CodingStructure& cs, const UnitArea& area, const unsign
   CodingStructure *tempCS = m_pTempCS[gp_sizeIdxInfo->idxFrom( area.lumaSize().width )][gp_sizeIdxInfo->idxFrom( area.lumaSize().height )];
   CodingStructure *bestCS = m_pBestCS[gp_sizeIdxInfo->idxFrom( area.lumaSize().width )][gp_sizeIdxInfo->idxFrom( area.lumaSize().height )];
 
-  cs.initSubStructure(*tempCS, partitioner.chType, partitioner.currArea(), false);
-  cs.initSubStructure(*bestCS, partitioner.chType, partitioner.currArea(), false);
+  {
+    CtuRowPictureLock picLock( m_ctuRow, cs );
+    cs.treeType = TREE_D;
+    cs.initSubStructure(*tempCS, partitioner.chType, partitioner.currArea(), false);
+    cs.initSubStructure(*bestCS, partitioner.chType, partitioner.currArea(), false);
+  }
   tempCS->currQP[CH_L] = bestCS->currQP[CH_L] =
   tempCS->baseQP       = bestCS->baseQP       = currQP[CH_L];
   tempCS->prevQP[CH_L] = bestCS->prevQP[CH_L] = prevQP[CH_L];
 
   xCompressCU(tempCS, bestCS, partitioner);
-  cs.slice->m_mapPltCost[0].clear();
-  cs.slice->m_mapPltCost[1].clear();
+  if( cs.sps->getPLTMode() )
+  {
+    cs.slice->m_mapPltCost[0].clear();
+    cs.slice->m_mapPltCost[1].clear();
+  }
   // all signals were already copied during compression if the CTU was split - at this point only the structures are copied to the top level CS
   const bool copyUnsplitCTUSignals = bestCS->cus.size() == 1;
-  cs.useSubStructure(*bestCS, partitioner.chType, CS::getArea(*bestCS, area, partitioner.chType), copyUnsplitCTUSignals,
-                     false, false, copyUnsplitCTUSignals, true);
+  {
+    CtuRowPictureLock picLock( m_ctuRow, cs );
+    cs.useSubStructure(*bestCS, partitioner.chType, CS::getArea(*bestCS, area, partitioner.chType), copyUnsplitCTUSignals,
+                       false, false, copyUnsplitCTUSignals, true);
+  }
 
   if (CS::isDualITree (cs) && isChromaEnabled (cs.pcv->chrFormat))
   {
@@ -317,8 +377,11 @@ void EncCu::compressCtu( CodingStructure& cs, const UnitArea& area, const unsign
 
     partitioner.initCtu(area, CH_C, *cs.slice);
 
-    cs.initSubStructure(*tempCS, partitioner.chType, partitioner.currArea(), false);
-    cs.initSubStructure(*bestCS, partitioner.chType, partitioner.currArea(), false);
+    {
+      CtuRowPictureLock picLock( m_ctuRow, cs );
+      cs.initSubStructure(*tempCS, partitioner.chType, partitioner.currArea(), false);
+      cs.initSubStructure(*bestCS, partitioner.chType, partitioner.currArea(), false);
+    }
     tempCS->currQP[CH_C] = bestCS->currQP[CH_C] =
     tempCS->baseQP       = bestCS->baseQP       = currQP[CH_C];
     tempCS->prevQP[CH_C] = bestCS->prevQP[CH_C] = prevQP[CH_C];
@@ -326,6 +389,7 @@ void EncCu::compressCtu( CodingStructure& cs, const UnitArea& area, const unsign
     xCompressCU(tempCS, bestCS, partitioner);
 
     const bool copyUnsplitCTUSignals = bestCS->cus.size() == 1;
+    CtuRowPictureLock picLock( m_ctuRow, cs );
     cs.useSubStructure(*bestCS, partitioner.chType, CS::getArea(*bestCS, area, partitioner.chType),
                        copyUnsplitCTUSignals, false, false, copyUnsplitCTUSignals, true);
   }
@@ -337,6 +401,7 @@ void EncCu::compressCtu( CodingStructure& cs, const UnitArea& area, const unsign
   // reset context states and uninit context pointer
   m_CABACEstimator->getCtx() = m_CurrCtx->start;
   m_CurrCtx                  = 0;
+  m_ctuRow                   = nullptr;
 
 
   // Ensure that a coding was found
@@ -774,13 +839,17 @@ void EncCu::xCompressCU( CodingStructure*& tempCS, CodingStructure*& bestCS, Par
         {
           for (auto motionModel : sps.getActiveMotionModels())
           {
-            if (motionModel != CLASSIC && tempCS->area.lumaSize().area() < m_pcEncCfg->getMMSizeConstraint())
+            if (motionModel != CLASSIC && (tempCS->area.lumaSize().area() < m_pcEncCfg->getMMSizeConstraint() || m_modeCtrl->skipGeodesicPass(*bestCS, partitioner)))
             {
               continue;
             }
             tempCS->bestCS = bestCS;
             xCheckRDCostInterIMV(tempCS, bestCS, partitioner, currTestMode, bestIntPelCost, motionModel);
             tempCS->bestCS = nullptr;
+            if (motionModel != CLASSIC)
+            {
+              m_modeCtrl->addGeodesicPassResult(*bestCS, partitioner);
+            }
             splitRdCostBest[CTU_LEVEL] = bestCS->cost;
             tempCS->splitRdCostBest = splitRdCostBest;
           }
@@ -790,13 +859,17 @@ void EncCu::xCompressCU( CodingStructure*& tempCS, CodingStructure*& bestCS, Par
       {
         for (auto motionModel : sps.getActiveMotionModels())
         {
-          if (motionModel != CLASSIC && tempCS->area.lumaSize().area() < m_pcEncCfg->getMMSizeConstraint())
+          if (motionModel != CLASSIC && (tempCS->area.lumaSize().area() < m_pcEncCfg->getMMSizeConstraint() || m_modeCtrl->skipGeodesicPass(*bestCS, partitioner)))
           {
             continue;
           }
           tempCS->bestCS = bestCS;
           xCheckRDCostInter( tempCS, bestCS, partitioner, currTestMode, motionModel );
           tempCS->bestCS = nullptr;
+          if (motionModel != CLASSIC)
+          {
+            m_modeCtrl->addGeodesicPassResult(*bestCS, partitioner);
+          }
           splitRdCostBest[CTU_LEVEL] = bestCS->cost;
           tempCS->splitRdCostBest = splitRdCostBest;
         }
@@ -1392,6 +1465,8 @@ void EncCu::xCheckModeSplit(CodingStructure *&tempCS, CodingStructure *&bestCS,
       }
     }
     assert( tempCS->treeType == TREE_L );
+    // the luma CUs stay in the picture while the chroma CUs are searched, other rows must not add units meanwhile
+    CtuRowPictureLock picLock( m_ctuRow, *tempCS->picture->cs );
     uint32_t numCuPuTu[6];
     tempCS->picture->cs->getNumCuPuTuOffset( numCuPuTu );
     tempCS->picture->cs->useSubStructure( *tempCS, partitioner.chType, CS::getArea( *tempCS, partitioner.currArea(), partitioner.chType ), false, true, false, false, false );
@@ -55,6 +55,8 @@
 #include "InterSearch.h"
 #include "RateCtrl.h"
 #include "EncModeCtrl.h"
+
+#include <mutex>
 //! \ingroup EncoderLib
 //! \{
 
@@ -62,6 +64,14 @@ class EncLib;
 class HLSWriter;
 class EncSlice;
 
+/// State of a CTU row that is encoded concurrently with the other rows of the picture (WppThreads)
+struct EncCtuRow
+{
+  std::mutex*   picLock;    ///< serializes the accesses to the units of the picture coding structure
+  LutMotionCand motionLut;  ///< HMVP candidates of the row
+  PLTBuf        prevPLT;    ///< palette predictor of the row
+};
+
 // ====================================================================================================================
 // Class definition
 // ====================================================================================================================
@@ -185,6 +195,7 @@ private:
   RateCtrl*             m_pcRateCtrl;
   IbcHashMap            m_ibcHashMap;
   EncModeCtrl          *m_modeCtrl;
+  EncCtuRow*            m_ctuRow;                   ///< row of the CTU being compressed, null if rows are not concurrent
 
   PelStorage            m_acMergeBuffer[MMVD_MRG_MAX_RD_BUF_NUM];
   PelStorage            m_acRealMergeBuffer[MRG_MAX_NUM_CANDS];
@@ -211,16 +222,24 @@ private:
 public:
   /// copy parameters from encoder class
   void  init                ( EncLib* pcEncLib, const SPS& sps );
+  /// copy parameters from encoder class, but use the given search and coding tools (e.g. those of a WPP worker)
+  void  init                ( EncLib* pcEncLib, const SPS& sps, IntraSearch* pcIntraSearch, InterSearch* pcInterSearch,
+                              TrQuant* pcTrQuant, RdCost* pcRdCost, CABACEncoder* pcCABACEncoder, CtxCache* pcCtxCache,
+                              DeblockingFilter* pcDeblockingFilter );
 
   void setDecCuReshaperInEncCU(EncReshape* pcReshape, ChromaFormat chromaFormatIDC) { initDecCuReshaper((Reshape*) pcReshape, chromaFormatIDC); }
+  /// slice encoder providing the lambda of the coded picture (e.g. that of a frame worker)
+  void  setSliceEncoder     ( EncSlice* pcSliceEncoder ) { m_pcSliceEncoder = pcSliceEncoder; }
   /// create internal buffers
   void  create              ( EncCfg* encCfg );
 
   /// destroy internal buffers
   void  destroy             ();
 
+  /// reset the search state carried from CTU to CTU, so that a CTU row does not depend on the rows before it
+  void  initCtuRow          ();
   /// CTU analysis function
-  void  compressCtu         ( CodingStructure& cs, const UnitArea& area, const unsigned ctuRsAddr, const int prevQP[], const int currQP[] );
+  void  compressCtu         ( CodingStructure& cs, const UnitArea& area, const unsigned ctuRsAddr, const int prevQP[], const int currQP[], EncCtuRow* ctuRow = nullptr );
   /// CTU encoding function
   int   updateCtuDataISlice ( const CPelBuf buf );
 
@@ -0,0 +1,309 @@
+//
+// Estimation of the translational epipole of a picture from a coarse motion field (EpipoleEstimation).
+//
+
+#include "EncEpipoleEstimator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "Eigen/Eigenvalues"
+
+
+void EncEpipoleEstimator::init(const Projection *projection, const int bitDepth)
+{
+  m_projection = projection;
+  m_bitDepth   = bitDepth;
+}
+
+bool EncEpipoleEstimator::estimate(const CPelBuf &cur, const CPelBuf &ref, const bool refIsPast, ThreadPool *threadPool,
+                                   Array3TCoord &epipole) const
+{
+  CHECK(cur.width != ref.width || cur.height != ref.height, "Epipole estimation requires pictures of the same size.");
+
+  int numLevels = 1;
+  while (numLevels < EPIPOLE_ESTIMATION_MAX_LEVELS && (cur.height >> numLevels) >= EPIPOLE_ESTIMATION_MIN_LEVEL_HEIGHT)
+  {
+    numLevels++;
+  }
+  // The motion field of the half resolution is fine enough for the fit.
+  const int fieldLevel = std::min(1, numLevels - 1);
+
+  std::vector<Plane> curPyramid;
+  std::vector<Plane> refPyramid;
+  buildPyramid(cur, numLevels, curPyramid);
+  buildPyramid(ref, numLevels, refPyramid);
+
+  std::vector<BlockMotion> motion;
+  std::vector<BlockMotion> coarse;
+  int                      coarseBlocksX = 0;
+  for (int level = numLevels - 1; level >= fieldLevel; level--)
+  {
+    searchLevel(curPyramid[level], refPyramid[level], level == numLevels - 1 ? nullptr : &coarse, coarseBlocksX,
+                level == fieldLevel, motion, threadPool);
+    coarseBlocksX = curPyramid[level].width / EPIPOLE_ESTIMATION_BLOCK_SIZE;
+    std::swap(coarse, motion);
+  }
+
+  std::vector<Eigen::Vector3d> normals;
+  Eigen::Vector3d              displacement;
+  collectNormals(curPyramid[fieldLevel], coarse, fieldLevel, normals, displacement);
+
+  Eigen::Vector3d direction;
+  if (!fitEpipole(normals, direction))
+  {
+    return false;
+  }
+
+  // The epipole is the focus of expansion: the picture content moves away from it with the camera movement, so the
+  // blocks of the later picture are found closer to the epipole in the earlier one.
+  const double towardsEpipole = displacement.dot(direction);
+  if ((towardsEpipole < 0) == refIsPast)
+  {
+    direction = -direction;
+  }
+  epipole = Array3TCoord(TCoord(direction.x()), TCoord(direction.y()), TCoord(direction.z()));
+  return true;
+}
+
+void EncEpipoleEstimator::buildPyramid(const CPelBuf &luma, const int numLevels, std::vector<Plane> &pyramid)
+{
+  pyramid.resize(numLevels);
+
+  Plane &base = pyramid[0];
+  base.width  = luma.width;
+  base.height = luma.height;
+  base.samples.resize(size_t(base.width) * base.height);
+  for (int y = 0; y < base.height; y++)
+  {
+    std::copy(luma.bufAt(0, y), luma.bufAt(0, y) + base.width, base.samples.begin() + size_t(y) * base.width);
+  }
+
+  for (int level = 1; level < numLevels; level++)
+  {
+    const Plane &src = pyramid[level - 1];
+    Plane       &dst = pyramid[level];
+    dst.width        = src.width / 2;
+    dst.height       = src.height / 2;
+    dst.samples.resize(size_t(dst.width) * dst.height);
+    for (int y = 0; y < dst.height; y++)
+    {
+      const Pel *srcRow      = src.row(2 * y);
+      const Pel *srcRowBelow = src.row(2 * y + 1);
+      Pel       *dstRow      = dst.samples.data() + size_t(y) * dst.width;
+      for (int x = 0; x < dst.width; x++)
+      {
+        dstRow[x] = (srcRow[2 * x] + srcRow[2 * x + 1] + srcRowBelow[2 * x] + srcRowBelow[2 * x + 1] + 2) >> 2;
+      }
+    }
+  }
+}
+
+int EncEpipoleEstimator::blockSad(const Plane &cur, const Plane &ref, const int x, const int y, const int dx,
+                                  const int dy, const int bestSad)
+{
+  int sad = 0;
+  for (int y1 = 0; y1 < EPIPOLE_ESTIMATION_BLOCK_SIZE; y1++)
+  {
+    const Pel *curRow = cur.row(y + y1) + x;
+    const Pel *refRow = ref.row(y + y1 + dy) + x + dx;
+    for (int x1 = 0; x1 < EPIPOLE_ESTIMATION_BLOCK_SIZE; x1++)
+    {
+      sad += abs(curRow[x1] - refRow[x1]);
+    }
+    if (sad >= bestSad)
+    {
+      return sad;
+    }
+  }
+  return sad;
+}
+
+void EncEpipoleEstimator::searchLevel(const Plane &cur, const Plane &ref, const std::vector<BlockMotion> *coarse,
+                                      const int coarseBlocksX, const bool subsample, std::vector<BlockMotion> &motion,
+                                      ThreadPool *threadPool) const
+{
+  const int blockSize = EPIPOLE_ESTIMATION_BLOCK_SIZE;
+  const int blocksX   = cur.width / blockSize;
+  const int blocksY   = cur.height / blockSize;
+  const int range     = coarse ? EPIPOLE_ESTIMATION_REFINE_RANGE : EPIPOLE_ESTIMATION_SEARCH_RANGE;
+  motion.resize(size_t(blocksX) * blocksY);
+
+  // The block rows are independent: the candidates only come from the coarser level.
+  ThreadPool::parallelFor(threadPool, 0, blocksY, [&](int blockY) {
+    const int y = blockY * blockSize;
+    for (int blockX = 0; blockX < blocksX; blockX++)
+    {
+      const int x = blockX * blockSize;
+
+      // Candidates must keep the reference block inside the picture.
+      auto isInside = [&](int dx, int dy) {
+        return x + dx >= 0 && y + dy >= 0 && x + dx + blockSize <= ref.width && y + dy + blockSize <= ref.height;
+      };
+
+      BlockMotion best = { 0, 0, blockSad(cur, ref, x, y, 0, 0, std::numeric_limits<int>::max()), 0, 0 };
+      if (coarse)
+      {
+        const int coarseX = std::min(blockX / 2, coarseBlocksX - 1);
+        const int coarseY = std::min(blockY / 2, int(coarse->size()) / coarseBlocksX - 1);
+        const BlockMotion &predictor = (*coarse)[size_t(coarseY) * coarseBlocksX + coarseX];
+        if (isInside(2 * predictor.x, 2 * predictor.y))
+        {
+          const int sad = blockSad(cur, ref, x, y, 2 * predictor.x, 2 * predictor.y, best.sad);
+          if (sad < best.sad)
+          {
+            best = { 2 * predictor.x, 2 * predictor.y, sad, 0, 0 };
+          }
+        }
+      }
+
+      const BlockMotion center = best;
+      for (int dy = center.y - range; dy <= center.y + range; dy++)
+      {
+        for (int dx = center.x - range; dx <= center.x + range; dx++)
+        {
+          if (!isInside(dx, dy))
+          {
+            continue;
+          }
+          const int sad = blockSad(cur, ref, x, y, dx, dy, best.sad);
+          if (sad < best.sad)
+          {
+            best = { dx, dy, sad, 0, 0 };
+          }
+        }
+      }
+      // sub-sample offset of the minimum of a parabola through the costs around the best position
+      best.fracX = 0;
+      best.fracY = 0;
+      if (subsample)
+      {
+        auto offset = [&](int dx0, int dy0, int dx1, int dy1) {
+          if (!isInside(dx0, dy0) || !isInside(dx1, dy1))
+          {
+            return 0.0;
+          }
+          const int    sad0      = blockSad(cur, ref, x, y, dx0, dy0, std::numeric_limits<int>::max());
+          const int    sad1      = blockSad(cur, ref, x, y, dx1, dy1, std::numeric_limits<int>::max());
+          const int    curvature = sad0 + sad1 - 2 * best.sad;
+          return curvature > 0 ? Clip3(-0.5, 0.5, 0.5 * (sad0 - sad1) / curvature) : 0.0;
+        };
+        best.fracX = offset(best.x - 1, best.y, best.x + 1, best.y);
+        best.fracY = offset(best.x, best.y - 1, best.x, best.y + 1);
+      }
+      motion[size_t(blockY) * blocksX + blockX] = best;
+    }
+  });
+}
+
+void EncEpipoleEstimator::collectNormals(const Plane &cur, const std::vector<BlockMotion> &motion, const int level,
+                                         std::vector<Eigen::Vector3d> &normals, Eigen::Vector3d &displacement) const
+{
+  const int    blockSize = EPIPOLE_ESTIMATION_BLOCK_SIZE;
+  const int    blocksX   = cur.width / blockSize;
+  const int    blocksY   = cur.height / blockSize;
+  const double scale     = double(1 << level);
+  // Flat blocks match anywhere; at least an average deviation of 2 (8 bit) from the block mean is required.
+  const int minDeviation = (2 * blockSize * blockSize) << std::max(0, m_bitDepth - 8);
+
+  normals.clear();
+  displacement.setZero();
+  for (int blockY = 0; blockY < blocksY; blockY++)
+  {
+    for (int blockX = 0; blockX < blocksX; blockX++)
+    {
+      const BlockMotion &mv = motion[size_t(blockY) * blocksX + blockX];
+      if (mv.x == 0 && mv.y == 0)
+      {
+        continue;
+      }
+
+      const int x   = blockX * blockSize;
+      const int y   = blockY * blockSize;
+      int       sum = 0;
+      for (int y1 = 0; y1 < blockSize; y1++)
+      {
+        const Pel *row = cur.row(y + y1) + x;
+        for (int x1 = 0; x1 < blockSize; x1++)
+        {
+          sum += row[x1];
+        }
+      }
+      const int mean      = (sum + blockSize * blockSize / 2) / (blockSize * blockSize);
+      int       deviation = 0;
+      for (int y1 = 0; y1 < blockSize; y1++)
+      {
+        const Pel *row = cur.row(y + y1) + x;
+        for (int x1 = 0; x1 < blockSize; x1++)
+        {
+          deviation += abs(row[x1] - mean);
+        }
+      }
+      if (deviation < minDeviation)
+      {
+        continue;
+      }
+
+      // block center in luma samples of the full resolution and its position in the reference picture
+      const double   centerX = (x + 0.5 * blockSize) * scale;
+      const double   centerY = (y + 0.5 * blockSize) * scale;
+      const auto     point   = m_projection->toSphere(Array2TCoord(TCoord(centerX), TCoord(centerY)));
+      const auto     moved   = m_projection->toSphere(
+        Array2TCoord(TCoord(centerX + (mv.x + mv.fracX) * scale), TCoord(centerY + (mv.y + mv.fracY) * scale)));
+      const Eigen::Vector3d p(point.x(), point.y(), point.z());
+      const Eigen::Vector3d q(moved.x(), moved.y(), moved.z());
+
+      // normal of the great circle through both positions, which passes through the epipole
+      const Eigen::Vector3d normal = p.cross(q);
+      if (normal.squaredNorm() > 0)
+      {
+        normals.push_back(normal.normalized());
+        displacement += q - p;
+      }
+    }
+  }
+}
+
+bool EncEpipoleEstimator::fitEpipole(const std::vector<Eigen::Vector3d> &normals, Eigen::Vector3d &epipole)
+{
+  if (int(normals.size()) < EPIPOLE_ESTIMATION_MIN_BLOCKS)
+  {
+    return false;
+  }
+
+  // The epipole minimizes the weighted squared distances sum(w * (n . e)^2) to the great circles, i.e., it is the
+  // eigenvector of the smallest eigenvalue of sum(w * n * n^T). The Cauchy weights are derived from the distances to
+  // the previous estimate, scaled by their median absolute deviation.
+  std::vector<double> weights(normals.size(), 1.0);
+  std::vector<double> distances(normals.size());
+  Eigen::SelfAdjointEigenSolver<Eigen::Matrix3d> solver;
+  for (int iteration = 0; iteration < EPIPOLE_ESTIMATION_FIT_ITERATIONS; iteration++)
+  {
+    Eigen::Matrix3d scatter = Eigen::Matrix3d::Zero();
+    for (size_t i = 0; i < normals.size(); i++)
+    {
+      scatter += weights[i] * normals[i] * normals[i].transpose();
+    }
+    solver.compute(scatter);
+    epipole = solver.eigenvectors().col(0);
+
+    for (size_t i = 0; i < normals.size(); i++)
+    {
+      distances[i] = std::abs(normals[i].dot(epipole));
+    }
+    std::vector<double> sorted = distances;
+    std::nth_element(sorted.begin(), sorted.begin() + sorted.size() / 2, sorted.end());
+    const double sigma = std::max(1.4826 * sorted[sorted.size() / 2], 1e-3);
+    for (size_t i = 0; i < normals.size(); i++)
+    {
+      const double r = distances[i] / sigma;
+      weights[i]     = 1.0 / (1.0 + r * r);
+    }
+  }
+
+  // With the great circles all through one axis, the smallest eigenvalue is distinct; otherwise the motion is no
+  // translation (e.g., a camera rotation or noise) and the estimate is not used.
+  const Eigen::Vector3d eigenvalues = solver.eigenvalues();
+  return eigenvalues(1) > EPIPOLE_ESTIMATION_MIN_EIGENVALUE_RATIO * eigenvalues(0);
+}
@@ -0,0 +1,64 @@
+//
+// Estimation of the translational epipole of a picture from a coarse motion field (EpipoleEstimation).
+//
+
+#pragma once
+
+#include <vector>
+
+#include "CommonLib/Unit.h"
+#include "CommonLib/Coordinate.h"
+#include "CommonLib/Projection.h"
+#include "CommonLib/ThreadPool.h"
+
+
+/**
+ * Estimates the direction of the camera translation between a picture and a reference picture. A block motion field is
+ * searched hierarchically on a luma pyramid, like the subsampled motion estimation of the temporal filter. Each moving
+ * block maps to a great circle through the epipole on the sphere; the epipole is the direction closest to all of these
+ * great circles, fitted with iteratively reweighted least squares to suppress blocks that do not follow the camera motion.
+ */
+class EncEpipoleEstimator {
+public:
+  EncEpipoleEstimator(): m_projection(nullptr), m_bitDepth(0) {}
+
+  void init(const Projection *projection, int bitDepth);
+
+  /**
+   * @brief Estimate the epipole of the picture cur from its motion to the reference picture ref (luma of the coding
+   * projection). The epipole points in the direction of the camera movement. Returns false and leaves epipole unchanged
+   * if the motion field does not determine the epipole, e.g., for a static camera.
+   */
+  bool estimate(const CPelBuf &cur, const CPelBuf &ref, bool refIsPast, ThreadPool *threadPool, Array3TCoord &epipole) const;
+
+protected:
+  struct Plane {
+    int              width;
+    int              height;
+    std::vector<Pel> samples;
+
+    const Pel *row(int y) const { return samples.data() + size_t(y) * width; }
+  };
+  struct BlockMotion {
+    int    x;
+    int    y;
+    int    sad;
+    double fracX;  ///< sub-sample offset of the motion, on the finest searched level only
+    double fracY;
+  };
+
+  /** Luma pyramid of the picture, level 0 in full resolution and each further level subsampled by 2 */
+  static void buildPyramid(const CPelBuf &luma, int numLevels, std::vector<Plane> &pyramid);
+  static int  blockSad(const Plane &cur, const Plane &ref, int x, int y, int dx, int dy, int bestSad);
+
+  /** Search the blocks of one pyramid level around the motion of the next coarser level (nullptr: full search) */
+  void searchLevel(const Plane &cur, const Plane &ref, const std::vector<BlockMotion> *coarse, int coarseBlocksX,
+                   bool subsample, std::vector<BlockMotion> &motion, ThreadPool *threadPool) const;
+  /** Great circle normals on the sphere of the textured moving blocks of the motion field on the given pyramid level */
+  void collectNormals(const Plane &cur, const std::vector<BlockMotion> &motion, int level,
+                      std::vector<Eigen::Vector3d> &normals, Eigen::Vector3d &displacement) const;
+  static bool fitEpipole(const std::vector<Eigen::Vector3d> &normals, Eigen::Vector3d &epipole);
+
+  const Projection *m_projection;
+  int               m_bitDepth;
+};
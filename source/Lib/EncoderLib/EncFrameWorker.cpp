@@ -0,0 +1,79 @@
+//
+// Encoder state of one picture compressed concurrently with other pictures of the GOP (FrameThreads).
+//
+
+#include "EncFrameWorker.h"
+
+#include "EncLib.h"
+
+
+void EncFrameWorker::init(EncLib *encLib, const SPS &sps)
+{
+  m_tools.init(encLib, sps);
+  m_sliceEncoder.init(encLib, sps, &m_tools);
+  m_tools.getCuEncoder()->setSliceEncoder(&m_sliceEncoder);
+
+  if (encLib->getWppThreads() > 0)
+  {
+    m_wppThreadPool.reset(new ThreadPool(encLib->getWppThreads()));
+    for (int i = 0; i < m_wppThreadPool->numThreads(); i++)
+    {
+      m_wppWorkers.emplace_back(new EncWppWorker);
+      m_wppWorkers.back()->init(encLib, sps);
+      m_wppWorkers.back()->getCuEncoder()->setSliceEncoder(&m_sliceEncoder);
+    }
+    m_sliceEncoder.setWppThreads(m_wppThreadPool.get(), &m_wppWorkers);
+  }
+}
+
+void EncFrameWorker::destroy()
+{
+  m_wppThreadPool.reset();
+  for (auto &worker: m_wppWorkers)
+  {
+    worker->destroy();
+  }
+  m_wppWorkers.clear();
+  m_sliceEncoder.destroy();
+  m_tools.destroy();
+}
+
+void EncFrameWorker::initPicture(EncLib *encLib, Picture &pic)
+{
+  m_sliceEncoder.initPicture(*encLib->getSliceEncoder());
+  m_tools.initSlice(encLib, *pic.slices[0]);
+
+  // EncSlice::initEncSlice() has set up the hash map of the CU encoder of EncLib only
+  if ((encLib->getIBCHashSearch() && encLib->getIBCMode()) || encLib->getAllowDisFracMMVD())
+  {
+    IbcHashMap &ibcHashMap = m_tools.getCuEncoder()->getIbcHashMap();
+    ibcHashMap.destroy();
+    ibcHashMap.init(pic.cs->pps->getPicWidthInLumaSamples(), pic.cs->pps->getPicHeightInLumaSamples());
+  }
+
+  // EncGOP sets the next picture up in the header of EncLib while this one is compressed
+  m_sharedPicHeader = pic.cs->picHeader;
+  m_picHeader       = *m_sharedPicHeader;
+  xSetPicHeader(pic, &m_picHeader);
+}
+
+void EncFrameWorker::finishPicture(EncLib *encLib, Picture &pic)
+{
+  *m_sharedPicHeader = m_picHeader;
+  xSetPicHeader(pic, m_sharedPicHeader);
+
+  // the loop filters and the LMCS APS use the reshaper of EncLib
+  if (pic.cs->sps->getUseLmcs())
+  {
+    *encLib->getReshaper() = *m_tools.getReshaper();
+  }
+}
+
+void EncFrameWorker::xSetPicHeader(Picture &pic, PicHeader *picHeader)
+{
+  pic.cs->picHeader = picHeader;
+  for (Slice *slice: pic.slices)
+  {
+    slice->setPicHeader(picHeader);
+  }
+}
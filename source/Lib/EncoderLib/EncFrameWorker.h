@@ -0,0 +1,54 @@
+//
+// Encoder state of one picture compressed concurrently with other pictures of the GOP (FrameThreads).
+//
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "CommonLib/Picture.h"
+#include "CommonLib/Slice.h"
+#include "CommonLib/ThreadPool.h"
+
+#include "EncSlice.h"
+#include "EncWppWorker.h"
+
+class EncLib;
+
+
+/**
+ * Slice encoder with its own tool set, CTU row threads and picture header. EncGOP sets a picture up with the tools of
+ * EncLib; the frame worker takes that state over, compresses the slices of the picture while the other frame workers
+ * compress theirs, and hands the picture back to EncLib for the loop filters and the writing of the bitstream.
+ */
+class EncFrameWorker {
+public:
+  EncFrameWorker() = default;
+
+  EncFrameWorker(const EncFrameWorker&) = delete;
+  EncFrameWorker& operator=(const EncFrameWorker&) = delete;
+
+  /** @brief Create the tools for the configuration of encLib, after EncLib::init has set up its own tools. */
+  void init(EncLib *encLib, const SPS &sps);
+  void destroy();
+
+  /** @brief Take over the picture EncGOP has set up: slice level tool state, GOP entry and picture header. */
+  void initPicture(EncLib *encLib, Picture &pic);
+  /** @brief Hand the picture header and the reshaper of the compressed picture back to encLib. */
+  void finishPicture(EncLib *encLib, Picture &pic);
+
+  EncSlice*     getSliceEncoder()                     { return &m_sliceEncoder; }
+  InterSearch*  getInterSearch()                      { return m_tools.getInterSearch(); }
+  EncReshape*   getReshaper()                         { return m_tools.getReshaper(); }
+
+protected:
+  void xSetPicHeader(Picture &pic, PicHeader *picHeader);
+
+  EncWppWorker                               m_tools;
+  EncSlice                                   m_sliceEncoder;
+  PicHeader                                  m_picHeader;                ///< Header of the picture while it is compressed
+  PicHeader*                                 m_sharedPicHeader = nullptr; ///< Header of EncLib the picture is set up in
+  std::unique_ptr<ThreadPool>                m_wppThreadPool;            ///< Threads encoding the CTU rows (WppThreads)
+  std::vector<std::unique_ptr<EncWppWorker>> m_wppWorkers;
+};
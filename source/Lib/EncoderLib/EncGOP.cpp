@@ -2265,6 +2265,14 @@ void EncGOP::compressGOP(int pocLast, int numPicRcvd, PicList &rcListPic, std::l
   AccessUnit::iterator  itLocationToPushSliceHeaderNALU; // used to store location where NALU containing slice header is to be inserted
   Picture* scaledRefPic[MAX_NUM_REF] = {};
 
+  // concurrently compressed pictures are set up one after the other in coding order
+  const bool concurrent    = m_concurrentPics.numPics > 0;
+  const int  concurrentIdx = picIdInGOP - m_concurrentPics.firstPicId;
+  if( concurrent )
+  {
+    xWaitConcurrentPics( [&] { return m_concurrentPics.numSetUp == concurrentIdx; } );
+  }
+
   xInitGOP(pocLast, numPicRcvd, isField, isEncodeLtRef);
 
   m_iNumPicCoded = 0;
@@ -3101,10 +3109,30 @@ void EncGOP::compressGOP(int pocLast, int numPicRcvd, PicList &rcListPic, std::l
 
     pcSlice->setDefaultClpRng(*pcSlice->getSPS());
 
+    // The temporal filter motion of a picture only seeds its own motion search. Fields of the pictures set up before
+    // are erased once no earlier picture is in flight.
+    if( m_pcCfg->getGopBasedTemporalFilterMotionSeeds() )
+    {
+      if( !concurrent || concurrentIdx == 0 )
+      {
+        m_pcCfg->getMotionSeeds()->eraseRetired();
+      }
+      m_pcCfg->getMotionSeeds()->retire( pocCurr );
+    }
+
     // Multi-model
     if (picHeader->getPicInterSliceAllowedFlag() && pcSlice->getSPS()->getUseGED())
     {
       const auto epipoleList = m_pcCfg->getEpipoleList();
+
+      // Drop the epipoles of pictures no longer used for reference. Pictures compressed concurrently with the current
+      // one may still look the epipoles up, so they are erased once no earlier picture is in flight.
+      epipoleList->retireUnreferenced( rcListPic );
+      if( !concurrent || concurrentIdx == 0 )
+      {
+        epipoleList->eraseRetired();
+      }
+
       const auto epipolePredictor = epipoleList->derivePredictor(pocCurr);
 
       // Make the registered epipoles of the current POC available for coding.
@@ -3112,11 +3140,16 @@ void EncGOP::compressGOP(int pocLast, int numPicRcvd, PicList &rcListPic, std::l
       epipoleList->makeAvailable(pocCurr);
 
       // Find the epipole for the current POC. Returns the global epipole if no epipole for the current POC is registered.
-      const auto epipole = epipoleList->findEpipole(pocCurr, -1);
+      auto epipole = epipoleList->findEpipole(pocCurr, -1);
 
       // In case the global epipole has been returned (no epipole for the current POC is registered), the global epipole is registered for the current POC for further epipole prediciton.
+      // With EpipoleEstimation, the epipole estimated from the motion of the picture is registered instead, if it can be determined.
       if (!epipoleList->hasEpipole(pocCurr, -1))
       {
+        if (m_pcCfg->getUseEpipoleEstimation() && m_pcEncLib->estimateEpipole(*pcSlice, epipole))
+        {
+          msg( DETAILS, "POC %d: estimated epipole (%.4f, %.4f, %.4f)\n", pocCurr, epipole.x(), epipole.y(), epipole.z() );
+        }
         epipoleList->addEpipole(epipole, pocCurr, -1, true);
       }
 
@@ -3125,6 +3158,9 @@ void EncGOP::compressGOP(int pocLast, int numPicRcvd, PicList &rcListPic, std::l
       const auto epipoleSphericalTrim = Array2TCoord(epipoleSpherical.coeff(1), epipoleSpherical.coeff(2));
       const Array2Fixed epipoleDelta = FloatingFixedConversion::floatingToFixed(epipoleSphericalTrim, EPIPOLE_PRECISION_FIXED) - FloatingFixedConversion::floatingToFixed(epipolePredictor, EPIPOLE_PRECISION_FIXED);
       picHeader->setEpipoleDelta(epipoleDelta);
+
+      // Build the coordinate tables of all reference epipoles before the CTU loop.
+      m_pcEncLib->prepareGEDTables(*pcSlice);
     }
 
     // Allocate some coders, now the number of tiles are known.
@@ -3236,6 +3272,35 @@ void EncGOP::compressGOP(int pocLast, int numPicRcvd, PicList &rcListPic, std::l
       pcSlice->setReverseLastSigCoeffFlag(m_cnt_right_bottom >= 0);
     }
 
+    // a concurrently compressed picture moves to its frame worker, the next picture is set up in the meantime
+    EncFrameWorker *frameWorker  = nullptr;
+    EncSlice       *sliceEncoder = m_pcSliceEncoder;
+    InterSearch    *interSearch  = m_pcEncLib->getInterSearch();
+    EncReshape     *reshaper     = m_pcReshaper;
+    if( concurrent )
+    {
+      CHECK( !encPic, "Concurrently compressed pictures must be encoded" );
+      for( int l = 0; l < NUM_REF_PIC_LIST_01; l++ )
+      {
+        for( int refIdx = 0; refIdx < pcSlice->getNumRefIdx( RefPicList( l ) ); refIdx++ )
+        {
+          CHECK( !pcSlice->getRefPic( RefPicList( l ), refIdx )->reconstructed,
+                 "Reference picture compressed concurrently with the current picture" );
+        }
+      }
+
+      frameWorker  = m_pcEncLib->getFrameWorker( concurrentIdx );
+      frameWorker->initPicture( m_pcEncLib, *pcPic );
+      picHeader    = pcPic->cs->picHeader;
+      sliceEncoder = frameWorker->getSliceEncoder();
+      interSearch  = frameWorker->getInterSearch();
+      reshaper     = frameWorker->getReshaper();
+      resetBcwCodingOrder( false, *pcPic->cs );
+
+      xAdvanceConcurrentPics( m_concurrentPics.numSetUp );
+      xWaitConcurrentPics( [&] { return m_concurrentPics.numSetUp == m_concurrentPics.numPics; } );
+    }
+
     if( encPic )
     // now compress (trial encode) the various slice segments (slices, and dependent slices)
     {
@@ -3336,14 +3401,14 @@ void EncGOP::compressGOP(int pocLast, int numPicRcvd, PicList &rcListPic, std::l
 
             if (pcSlice->getLmcsEnabledFlag())
             {
-              pcPic->getOrigBuf(COMPONENT_Y).rspSignal(m_pcReshaper->getFwdLUT());
-              m_pcReshaper->setSrcReshaped(true);
-              m_pcReshaper->setRecReshaped(true);
+              pcPic->getOrigBuf(COMPONENT_Y).rspSignal(reshaper->getFwdLUT());
+              reshaper->setSrcReshaped(true);
+              reshaper->setRecReshaped(true);
             }
             else
             {
-              m_pcReshaper->setSrcReshaped(false);
-              m_pcReshaper->setRecReshaped(false);
+              reshaper->setSrcReshaped(false);
+              reshaper->setRecReshaped(false);
             }
           }
         }
@@ -3353,31 +3418,31 @@ void EncGOP::compressGOP(int pocLast, int numPicRcvd, PicList &rcListPic, std::l
         {
           isLossless = pcPic->losslessSlice(sliceIdx);
         }
-        m_pcSliceEncoder->setLosslessSlice(pcPic, isLossless);
+        sliceEncoder->setLosslessSlice(pcPic, isLossless);
 
         if( pcSlice->getSliceType() != I_SLICE && pcSlice->getRefPic( REF_PIC_LIST_0, 0 )->subPictures.size() > 1 )
         {
           clipMv = clipMvInSubpic;
-          m_pcEncLib->getInterSearch()->setClipMvInSubPic(true);
+          interSearch->setClipMvInSubPic(true);
         }
         else
         {
           clipMv = clipMvInPic;
-          m_pcEncLib->getInterSearch()->setClipMvInSubPic(false);
+          interSearch->setClipMvInSubPic(false);
         }
 
         if (pcSlice->isIntra() && (pocLast == 0 || m_pcCfg->getIntraPeriod() > 1))
         {
           computeSignalling(pcPic, pcSlice);
         }
-        m_pcSliceEncoder->precompressSlice( pcPic );
-        m_pcSliceEncoder->compressSlice   ( pcPic, false, false );
+        sliceEncoder->precompressSlice( pcPic );
+        sliceEncoder->compressSlice   ( pcPic, false, false );
 
         if(sliceIdx < pcPic->cs->pps->getNumSlicesInPic() - 1)
         {
           uint32_t independentSliceIdx = pcSlice->getIndependentSliceIdx();
           pcPic->allocateNewSlice();
-          m_pcSliceEncoder->setSliceSegmentIdx      (uiNumSliceSegments);
+          sliceEncoder->setSliceSegmentIdx      (uiNumSliceSegments);
           // prepare for next slice
           pcSlice = pcPic->slices[uiNumSliceSegments];
           CHECK(!(pcSlice->getPPS() != 0), "Unspecified error");
@@ -3389,6 +3454,17 @@ void EncGOP::compressGOP(int pocLast, int numPicRcvd, PicList &rcListPic, std::l
         }
       }
 
+      if( frameWorker )
+      {
+        // the loop filters and the writing of the pictures follow in coding order, with the tools of EncLib
+        xAdvanceConcurrentPics( m_concurrentPics.numCompressed );
+        xWaitConcurrentPics( [&] { return m_concurrentPics.numCompressed == m_concurrentPics.numPics
+                                          && m_concurrentPics.numFinished == concurrentIdx; } );
+        frameWorker->finishPicture( m_pcEncLib, *pcPic );
+        picHeader      = pcPic->cs->picHeader;
+        m_iNumPicCoded = 0;
+      }
+
       duData.clear();
 
       CodingStructure& cs = *pcPic->cs;
@@ -4216,6 +4292,7 @@ void EncGOP::compressGOP(int pocLast, int numPicRcvd, PicList &rcListPic, std::l
 
     DTRACE_UPDATE( g_trace_ctx, ( std::make_pair( "final", 0 ) ) );
 
+    pcPic->compressMotion();
     pcPic->reconstructed = true;
     m_bFirst = false;
     m_iNumPicCoded++;
@@ -4241,6 +4318,124 @@ void EncGOP::compressGOP(int pocLast, int numPicRcvd, PicList &rcListPic, std::l
   delete pcBitstreamRedirect;
 
   CHECK( m_iNumPicCoded > 1, "Unspecified error" );
+
+  if( concurrent )
+  {
+    xAdvanceConcurrentPics( m_concurrentPics.numFinished );
+  }
+}
+
+int EncGOP::getNumConcurrentPics( int pocLast, int numPicRcvd, int picIdInGOP, int maxPics )
+{
+  // the first picture is coded alone, low-delay pictures reference the picture coded before them
+  if( pocLast == 0 || m_pcCfg->getIsLowDelay() )
+  {
+    return 1;
+  }
+  // an update of the LMCS model in an inter picture changes the LMCS APS of EncLib during its setup
+  if( m_pcCfg->getLmcs() && m_pcCfg->getReshapeCW().updateCtrl == 2 )
+  {
+    return 1;
+  }
+
+  const int        gopSize     = m_pcCfg->getGOPSize();
+  const int        intraPeriod = m_pcCfg->getIntraPeriod();
+  std::vector<int> pocs;
+
+  for( int gopId = picIdInGOP; gopId < gopSize && int( pocs.size() ) < maxPics; gopId++ )
+  {
+    const GOPEntry &gopEntry = m_pcCfg->getGOPEntry( gopId );
+    const int       pocCurr  = pocLast - numPicRcvd + gopEntry.m_POC;
+
+    // skipped pictures end compressGOP() before the setup
+    if( pocCurr >= m_pcCfg->getFramesToBeEncoded() )
+    {
+      break;
+    }
+
+    // intra pictures start a new reference structure and are coded alone
+    if( gopEntry.m_sliceType == 'I' || ( intraPeriod > 0 && pocCurr % intraPeriod == 0 ) )
+    {
+      if( pocs.empty() )
+      {
+        pocs.push_back( pocCurr );
+      }
+      break;
+    }
+
+    // all reference picture lists EncLib::selectReferencePictureList() may choose for the picture
+    int pocIndex = intraPeriod > 0 ? pocCurr % intraPeriod : 0;
+    if( intraPeriod > 0 && pocIndex == 0 )
+    {
+      pocIndex = intraPeriod;
+    }
+    bool dependent = false;
+    for( int rplIdx = 0; rplIdx < m_pcCfg->getRPLCandidateSize( 0 ) && !dependent; rplIdx++ )
+    {
+      if( rplIdx != gopId
+          && ( rplIdx < gopSize || ( intraPeriod > 0 && m_pcCfg->getRPLEntry( 0, rplIdx ).m_POC != pocIndex ) ) )
+      {
+        continue;
+      }
+      for( int l = 0; l < NUM_REF_PIC_LIST_01 && !dependent; l++ )
+      {
+        const RPLEntry &rpl = m_pcCfg->getRPLEntry( l, rplIdx );
+        dependent = rpl.m_ltrp_in_slice_header_flag;
+        for( int i = 0; i < rpl.m_numRefPics && !dependent; i++ )
+        {
+          dependent = std::find( pocs.begin(), pocs.end(), pocCurr - rpl.m_deltaRefPics[i] ) != pocs.end();
+        }
+      }
+    }
+    if( dependent )
+    {
+      break;
+    }
+    pocs.push_back( pocCurr );
+  }
+
+  return std::max<int>( 1, int( pocs.size() ) );
+}
+
+void EncGOP::compressGOPConcurrently( int pocLast, int numPicRcvd, PicList &rcListPic,
+                                      std::list<PelUnitBuf *> &rcListPicYuvRec,
+                                      const InputColourSpaceConversion snr_conversion, const bool printFrameMSE,
+                                      const bool printMSSSIM, const int firstPicIdInGOP, const int numPics,
+                                      ThreadPool *threadPool )
+{
+  // the pictures wait for each other, so each needs its own thread
+  CHECK( numPics > threadPool->numThreads(), "More concurrent pictures than frame threads" );
+
+  m_concurrentPics.firstPicId    = firstPicIdInGOP;
+  m_concurrentPics.numPics       = numPics;
+  m_concurrentPics.numSetUp      = 0;
+  m_concurrentPics.numCompressed = 0;
+  m_concurrentPics.numFinished   = 0;
+  m_concurrentPics.abort         = false;
+
+  for( int i = 0; i < numPics; i++ )
+  {
+    threadPool->addTask( [&, i]
+    {
+      try
+      {
+        compressGOP( pocLast, numPicRcvd, rcListPic, rcListPicYuvRec, false, false, snr_conversion, printFrameMSE,
+                     printMSSSIM, false, firstPicIdInGOP + i );
+      }
+      catch( ... )
+      {
+        {
+          std::lock_guard<std::mutex> lock( m_concurrentPics.mutex );
+          m_concurrentPics.abort = true;
+        }
+        m_concurrentPics.changed.notify_all();
+        throw;
+      }
+    } );
+  }
+  threadPool->waitForAll();
+
+  m_concurrentPics.numPics = 0;
 }
 
 void EncGOP::printOutSummary( uint32_t uiNumAllPicCoded, bool isField, const bool printMSEBasedSNR,
@@ -4413,6 +4608,25 @@ void EncGOP::xInitGOP(int pocLast, int numPicRcvd, bool isField, bool isEncodeLt
   return;
 }
 
+void EncGOP::xWaitConcurrentPics( const std::function<bool()> &ready )
+{
+  std::unique_lock<std::mutex> lock( m_concurrentPics.mutex );
+  m_concurrentPics.changed.wait( lock, [&] { return m_concurrentPics.abort || ready(); } );
+  if( m_concurrentPics.abort )
+  {
+    THROW( "A concurrently compressed picture failed" );
+  }
+}
+
+void EncGOP::xAdvanceConcurrentPics( int &counter )
+{
+  {
+    std::lock_guard<std::mutex> lock( m_concurrentPics.mutex );
+    counter++;
+  }
+  m_concurrentPics.changed.notify_all();
+}
+
 void EncGOP::xGetBuffer(PicList &rcListPic, std::list<PelUnitBuf *> &rcListPicYuvRecOut, int numPicRcvd, int timeOffset,
                         Picture *&rpcPic, int pocCurr, bool isField)
 {
@@ -45,6 +45,7 @@
 #include "CommonLib/Picture.h"
 #include "CommonLib/DeblockingFilter.h"
 #include "CommonLib/NAL.h"
+#include "CommonLib/ThreadPool.h"
 #include "EncSampleAdaptiveOffset.h"
 #include "EncAdaptiveLoopFilter.h"
 #include "EncReshape.h"
@@ -138,6 +139,20 @@ private:
   int                     m_cnt_right_bottom;
   int                     m_cnt_right_bottom_i;
 
+  /// Progress of the pictures compressed concurrently by compressGOPConcurrently()
+  struct ConcurrentPics
+  {
+    std::mutex              mutex;
+    std::condition_variable changed;
+    int                     firstPicId    = 0;
+    int                     numPics       = 0;      ///< 0: compressGOP() codes its picture alone
+    int                     numSetUp      = 0;      ///< Pictures set up, in coding order
+    int                     numCompressed = 0;
+    int                     numFinished   = 0;      ///< Pictures filtered and written, in coding order
+    bool                    abort         = false;  ///< A picture failed, the others give up waiting
+  };
+  ConcurrentPics          m_concurrentPics;
+
   //  Access channel
   EncLib*                 m_pcEncLib;
   EncCfg*                 m_pcCfg;
@@ -226,6 +241,12 @@ public:
   void  compressGOP(int pocLast, int numPicRcvd, PicList &rcListPic, std::list<PelUnitBuf *> &rcListPicYuvRec,
                     bool isField, bool isTff, const InputColourSpaceConversion snr_conversion, const bool printFrameMSE,
                     bool printMSSSIM, bool isEncodeLtRef, const int picIdInGOP);
+  /// Number of pictures from picIdInGOP on, up to maxPics, whose reference picture lists do not refer to each other
+  int   getNumConcurrentPics( int pocLast, int numPicRcvd, int picIdInGOP, int maxPics );
+  /// Compress numPics pictures found by getNumConcurrentPics() at once, each on a thread of threadPool and a frame worker of EncLib
+  void  compressGOPConcurrently( int pocLast, int numPicRcvd, PicList &rcListPic, std::list<PelUnitBuf *> &rcListPicYuvRec,
+                                 const InputColourSpaceConversion snr_conversion, const bool printFrameMSE,
+                                 const bool printMSSSIM, const int firstPicIdInGOP, const int numPics, ThreadPool *threadPool );
   void  xAttachSliceDataToNalUnit (OutputNALUnit& rNalu, OutputBitstream* pcBitstreamRedirect);
 
 
@@ -284,6 +305,8 @@ protected:
   void  xPicInitHashME( Picture *pic, const PPS *pps, PicList &rcListPic );
   void  xPicInitRateControl(int &estimatedBits, int gopId, double &lambda, Picture *pic, Slice *slice);
   void  xPicInitLMCS       (Picture *pic, PicHeader *picHeader, Slice *slice);
+  void  xWaitConcurrentPics   ( const std::function<bool()> &ready );  ///< Block until ready() holds, throw if a picture failed
+  void  xAdvanceConcurrentPics( int &counter );
   void  xGetBuffer(PicList &rcListPic, std::list<PelUnitBuf *> &rcListPicYuvRecOut, int numPicRcvd, int timeOffset,
                    Picture *&rpcPic, int pocCurr, bool isField);
   void xGetSubpicIdsInPic(std::vector<uint16_t>& subpicIDs, const SPS* sps, const PPS* pps);
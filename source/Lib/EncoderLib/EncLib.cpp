@@ -140,6 +140,19 @@ void EncLib::destroy ()
   m_cReshaper.          destroy();
   m_cInterSearch.       destroy();
   m_cIntraSearch.       destroy();
+  m_gedTableThreadPool.reset();
+  m_wppThreadPool.reset();
+  for( auto &worker : m_wppWorkers )
+  {
+    worker->destroy();
+  }
+  m_wppWorkers.clear();
+  m_frameThreadPool.reset();
+  for( auto &worker : m_frameWorkers )
+  {
+    worker->destroy();
+  }
+  m_frameWorkers.clear();
 
   return;
 }
@@ -336,6 +349,15 @@ void EncLib::init(AUWriterIf *auWriterIf)
       CHECK(true, "Unknown projection function.")
     }
     m_mvReprojection.init(m_projection, picSize, &sps0, &m_epipoleList);
+    if (m_GED)
+    {
+      m_mvReprojection.setTableBudget(size_t(m_GEDTableMemoryBudget) << 20);
+      if (m_GEDTableThreads > 0)
+      {
+        m_gedTableThreadPool.reset(new ThreadPool(m_GEDTableThreads));
+      }
+      m_epipoleEstimator.init(m_projection, m_bitDepth[CHANNEL_TYPE_LUMA]);
+    }
   }
 
 
@@ -366,6 +388,27 @@ void EncLib::init(AUWriterIf *auWriterIf)
   // link temporary buffets from intra search with inter search to avoid unneccessary memory overhead
   m_cInterSearch.setTempBuffers( m_cIntraSearch.getSplitCSBuf(), m_cIntraSearch.getFullCSBuf(), m_cIntraSearch.getSaveCSBuf() );
 
+  if( m_wppThreads > 0 && m_wppWorkers.empty() )
+  {
+    m_wppThreadPool.reset( new ThreadPool( m_wppThreads ) );
+    for( int i = 0; i < m_wppThreadPool->numThreads(); i++ )
+    {
+      m_wppWorkers.emplace_back( new EncWppWorker );
+      m_wppWorkers.back()->init( this, sps0 );
+    }
+    m_cSliceEncoder.setWppThreads( m_wppThreadPool.get(), &m_wppWorkers );
+  }
+
+  if( m_frameThreads > 1 && m_frameWorkers.empty() )
+  {
+    m_frameThreadPool.reset( new ThreadPool( m_frameThreads ) );
+    for( int i = 0; i < m_frameThreadPool->numThreads(); i++ )
+    {
+      m_frameWorkers.emplace_back( new EncFrameWorker );
+      m_frameWorkers.back()->init( this, sps0 );
+    }
+  }
+
   m_maxRefPicNum = 0;
 
 #if ER_CHROMA_QP_WCG_PPS
@@ -716,11 +759,23 @@ bool EncLib::encodePrep(bool flush, PelStorage *pcPicYuvOrg, PelStorage *cPicYuv
 bool EncLib::encode(const InputColourSpaceConversion snrCSC, std::list<PelUnitBuf *> &rcListPicYuvRecOut,
                     int &numEncoded)
 {
-  // compress GOP
-  m_cGOPEncoder.compressGOP(m_pocLast, m_receivedPicCount, m_cListPic, rcListPicYuvRecOut, false, false, snrCSC,
-                            m_printFrameMSE, m_printMSSSIM, false, m_picIdInGOP);
+  // compress GOP, several pictures at once if they do not reference each other
+  const int numPics = m_frameThreadPool ? m_cGOPEncoder.getNumConcurrentPics( m_pocLast, m_receivedPicCount, m_picIdInGOP,
+                                                                              m_frameThreadPool->numThreads() )
+                                        : 1;
+  if( numPics > 1 )
+  {
+    m_cGOPEncoder.compressGOPConcurrently( m_pocLast, m_receivedPicCount, m_cListPic, rcListPicYuvRecOut, snrCSC,
+                                           m_printFrameMSE, m_printMSSSIM, m_picIdInGOP, numPics,
+                                           m_frameThreadPool.get() );
+  }
+  else
+  {
+    m_cGOPEncoder.compressGOP(m_pocLast, m_receivedPicCount, m_cListPic, rcListPicYuvRecOut, false, false, snrCSC,
+                              m_printFrameMSE, m_printMSSSIM, false, m_picIdInGOP);
+  }
 
-  m_picIdInGOP++;
+  m_picIdInGOP += numPics;
 
   // go over all pictures in a GOP excluding the first IRAP
   if (m_picIdInGOP != m_iGOPSize && m_pocLast)
@@ -1315,6 +1370,8 @@ void EncLib::xInitSPS( SPS& sps )
   sps.setUseGED(m_GED);
   if (sps.getUseMultiModel()) {
     sps.setGEDFlavor(m_GEDFlavor);
+    sps.setUseGEDFixedPoint(m_GEDFixedPoint);
+    sps.setUseGEDDMVRWindow(m_GEDDMVRWindow);
     sps.setUseMMMVP(m_MMMVP);
     sps.setMMOffset4x4(m_MMOffset4x4);
     sps.setProjectionFct(m_projectionFct);
@@ -2280,6 +2337,32 @@ void EncLib::selectReferencePictureList(Slice* slice, int POCCurr, int GOPid, in
   *slice->getRPL1() = *rpl1;
 }
 
+bool EncLib::estimateEpipole( const Slice &slice, Array3TCoord &epipole )
+{
+  // the motion to the temporally closest reference picture is the largest part that follows the current camera movement
+  const Picture *refPic = nullptr;
+  for( int l = 0; l < NUM_REF_PIC_LIST_01; l++ )
+  {
+    for( int refIdx = 0; refIdx < slice.getNumRefIdx( RefPicList( l ) ); refIdx++ )
+    {
+      const Picture *pic = slice.getRefPic( RefPicList( l ), refIdx );
+      if( pic->getPOC() != slice.getPOC() && !pic->isRefScaled( slice.getPPS() )
+          && ( refPic == nullptr || abs( pic->getPOC() - slice.getPOC() ) < abs( refPic->getPOC() - slice.getPOC() ) ) )
+      {
+        refPic = pic;
+      }
+    }
+  }
+  if( refPic == nullptr )
+  {
+    return false;
+  }
+
+  const Picture *pic = slice.getPic();
+  return m_epipoleEstimator.estimate( pic->getOrigBuf( COMPONENT_Y ), refPic->getOrigBuf( COMPONENT_Y ),
+                                      refPic->getPOC() < slice.getPOC(), m_gedTableThreadPool.get(), epipole );
+}
+
 
 void EncLib::setParamSetChanged(int spsId, int ppsId)
 {
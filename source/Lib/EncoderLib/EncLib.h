@@ -42,6 +42,7 @@
 #include "CommonLib/TrQuant.h"
 #include "CommonLib/DeblockingFilter.h"
 #include "CommonLib/NAL.h"
+#include "CommonLib/ThreadPool.h"
 
 #include "Utilities/VideoIOYuv.h"
 
@@ -55,6 +56,9 @@
 #include "IntraSearch.h"
 #include "EncSampleAdaptiveOffset.h"
 #include "EncReshape.h"
+#include "EncWppWorker.h"
+#include "EncFrameWorker.h"
+#include "EncEpipoleEstimator.h"
 #include "EncAdaptiveLoopFilter.h"
 #include "RateCtrl.h"
 
@@ -81,6 +85,16 @@ private:
   // Multi-model inter prediction
   Projection*               m_projection;                        ///< Fisheye (or 360°) projection
   MVReprojection            m_mvReprojection;                    ///< Motion vector reprojection handler
+  std::unique_ptr<ThreadPool> m_gedTableThreadPool;              ///< Workers for the GED coordinate tables at picture start
+  EncEpipoleEstimator       m_epipoleEstimator;                  ///< Epipoles of pictures without a given epipole (EpipoleEstimation)
+
+  // wavefront-parallel CTU row encoding
+  std::vector<std::unique_ptr<EncWppWorker>> m_wppWorkers;       ///< Encoder tools of the CTU row threads
+  std::unique_ptr<ThreadPool> m_wppThreadPool;                   ///< Threads encoding the CTU rows of a picture (WppThreads)
+
+  // pictures of a GOP compressed concurrently
+  std::vector<std::unique_ptr<EncFrameWorker>> m_frameWorkers;   ///< Slice encoders of the concurrent pictures
+  std::unique_ptr<ThreadPool> m_frameThreadPool;                 ///< Threads compressing the pictures (FrameThreads)
 
   // encoder search
   InterSearch               m_cInterSearch;                       ///< encoder search class
@@ -136,8 +150,6 @@ private:
 public:
   SPS*                      getSPS( int spsId ) { return m_spsMap.getPS( spsId ); };
   APS**                     getApss() { return m_apss; }
-  Ctx                       m_entropyCodingSyncContextState;      ///< leave in addition to vector for compatibility
-  PLTBuf                    m_palettePredictorSyncState;
 
 protected:
   void  xGetNewPicBuffer  ( std::list<PelUnitBuf*>& rcListPicYuvRecOut, Picture*& rpcPic, int ppsId ); ///< get picture buffer which will be processed. If ppsId<0, then the ppsMap will be queried for the first match.
@@ -187,6 +199,13 @@ public:
   CtxCache*               getCtxCache           ()              { return  &m_CtxCache;             }
   RateCtrl*               getRateCtrl           ()              { return  &m_cRateCtrl;            }
 
+  /// Build the GED coordinate tables of the slice's reference epipoles on the table workers, if enabled
+  void                    prepareGEDTables      ( const Slice &slice ) { if( m_gedTableThreadPool ) { m_mvReprojection.prepareTables( slice, m_gedTableThreadPool.get() ); } }
+  /// Estimate the epipole of the slice's picture from the motion to its closest reference picture, false if undetermined
+  bool                    estimateEpipole       ( const Slice &slice, Array3TCoord &epipole );
+
+  EncFrameWorker*         getFrameWorker        ( int i )       { return  m_frameWorkers[i].get(); }
+
 
   void                    getActiveRefPicListNumForPOC(const SPS *sps, int POCCurr, int GOPid, uint32_t *activeL0, uint32_t *activeL1);
   void                    selectReferencePictureList(Slice* slice, int POCCurr, int GOPid, int ltPoc);
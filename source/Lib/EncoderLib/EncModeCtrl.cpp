@@ -55,6 +55,9 @@ void EncModeCtrl::init( EncCfg *pCfg, RateCtrl *pRateCtrl, RdCost* pRdCost )
   m_pcRateCtrl    = pRateCtrl;
   m_pcRdCost      = pRdCost;
   m_fastDeltaQP   = false;
+  m_geodesicStatsPOC    = MAX_INT;
+  m_numGeodesicPasses   = 0;
+  m_numGeodesicSelected = 0;
 #if SHARP_LUMA_DELTA_QP
   m_lumaQPOffset  = 0;
 
@@ -123,6 +126,71 @@ void EncModeCtrl::setBest( CodingStructure& cs )
   }
 }
 
+static bool usesGeodesic( const CodingUnit* cu )
+{
+  if( cu == nullptr || !CU::isInter( *cu ) || cu->firstPU == nullptr )
+  {
+    return false;
+  }
+  const PredictionUnit& pu = *cu->firstPU;
+  return ( ( pu.interDir & 1 ) && pu.motionModel[REF_PIC_LIST_0] != CLASSIC ) || ( ( pu.interDir & 2 ) && pu.motionModel[REF_PIC_LIST_1] != CLASSIC );
+}
+
+bool EncModeCtrl::skipGeodesicPass( const CodingStructure& bestCS, const Partitioner& partitioner ) const
+{
+  const int preset = m_pcEncCfg->getGEDFastDecision();
+  if( preset == 0 || bestCS.cost == MAX_DOUBLE )
+  {
+    return false;
+  }
+
+  // Neighbourhood with GEODESIC motion, always test
+  const Position pos = bestCS.area.lumaPos();
+  if( ( pos.x > 0 && usesGeodesic( bestCS.getCU( pos.offset( -1, 0 ), CHANNEL_TYPE_LUMA ) ) )
+   || ( pos.y > 0 && usesGeodesic( bestCS.getCU( pos.offset( 0, -1 ), CHANNEL_TYPE_LUMA ) ) ) )
+  {
+    return false;
+  }
+  if( m_ComprCUCtxList.size() > 1 && m_ComprCUCtxList.end()[-2].bestCS && usesGeodesic( m_ComprCUCtxList.end()[-2].bestCU ) )
+  {
+    return false;
+  }
+
+  const CodingUnit* bestCU = bestCS.getCU( partitioner.chType );
+  if( bestCU && CU::isInter( *bestCU ) && !usesGeodesic( bestCU ) )
+  {
+    if( bestCU->skip )
+    {
+      return true;
+    }
+    const PredictionUnit& pu = *bestCU->firstPU;
+    int mvMagnitude = 0;
+    for( int refList = 0; refList < NUM_REF_PIC_LIST_01; refList++ )
+    {
+      if( pu.interDir & ( 1 << refList ) )
+      {
+        mvMagnitude = std::max( mvMagnitude, std::max( abs( pu.mv[refList].getHor() ), abs( pu.mv[refList].getVer() ) ) );
+      }
+    }
+    if( mvMagnitude < GED_FAST_DECISION_MV_THRESHOLD[preset] )
+    {
+      return true;
+    }
+  }
+
+  return m_numGeodesicPasses >= GED_FAST_DECISION_MIN_PASSES
+      && ( m_numGeodesicSelected << GED_FAST_DECISION_RATE_SHIFT[preset] ) < m_numGeodesicPasses;
+}
+
+void EncModeCtrl::addGeodesicPassResult( const CodingStructure& bestCS, const Partitioner& partitioner )
+{
+  m_numGeodesicPasses++;
+  if( usesGeodesic( bestCS.getCU( partitioner.chType ) ) )
+  {
+    m_numGeodesicSelected++;
+  }
+}
+
 void EncModeCtrl::xGetMinMaxQP( int& minQP, int& maxQP, const CodingStructure& cs, const Partitioner &partitioner, const int baseQP, const SPS& sps, const PPS& pps, const PartSplit splitMode )
 {
   if( m_pcEncCfg->getUseRateCtrl() )
@@ -1065,6 +1133,13 @@ void EncModeCtrlMTnoRQT::initCTUEncoding( const Slice &slice )
 
   m_slice             = &slice;
 
+  if( slice.getPOC() != m_geodesicStatsPOC )
+  {
+    m_geodesicStatsPOC    = slice.getPOC();
+    m_numGeodesicPasses   = 0;
+    m_numGeodesicSelected = 0;
+  }
+
   if( m_pcEncCfg->getUseE0023FastEnc() )
   {
     if (m_pcEncCfg->getUseCompositeRef())
@@ -1869,12 +1944,7 @@ bool EncModeCtrlMTnoRQT::tryMode( const EncTestMode& encTestmode, const CodingSt
     CHECK( encTestmode.type != ETM_POST_DONT_SPLIT, "Unknown mode" );
     if ((cuECtx.get<double>(BEST_NO_IMV_COST) == (MAX_DOUBLE * .5) || cuECtx.get<bool>(IS_REUSING_CU)) && !slice.isIntra())
     {
-      unsigned idx1, idx2, idx3, idx4;
-      getAreaIdx(partitioner.currArea().Y(), *slice.getPPS()->pcv, idx1, idx2, idx3, idx4);
-      if (g_isReusedUniMVsFilled[idx1][idx2][idx3][idx4])
-      {
-        m_pcInterSearch->insertUniMvCands(partitioner.currArea().Y(), g_reusedUniMVs[idx1][idx2][idx3][idx4]);
-      }
+      m_pcInterSearch->insertReusedUniMvCands(partitioner.currArea().Y(), *slice.getPPS()->pcv);
     }
     if( !bestCS || ( bestCS && isModeSplit( bestMode ) ) )
     {
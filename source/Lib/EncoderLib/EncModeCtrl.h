@@ -261,6 +261,13 @@ struct ComprCUCtx
   void                      set( int ft, double val ) { extraFeaturesd[ft] = val; }
 };
 
+/// GEODESIC pass statistics of the GED fast mode decision (GEDFastDecision)
+struct GeodesicPassStats
+{
+  int numPasses;    ///< GEODESIC passes
+  int numSelected;  ///< GEODESIC passes that produced the best CU
+};
+
 //////////////////////////////////////////////////////////////////////////
 // EncModeCtrl - abstract class specifying the general flow of mode control
 //////////////////////////////////////////////////////////////////////////
@@ -284,6 +291,10 @@ protected:
 
   bool                  m_doPlt;
 
+  int                   m_geodesicStatsPOC;          ///< Picture of the GEODESIC pass statistics
+  int                   m_numGeodesicPasses;         ///< GEODESIC passes of the picture
+  int                   m_numGeodesicSelected;       ///< GEODESIC passes that produced the best CU
+
 public:
 
   virtual ~EncModeCtrl              () {}
@@ -358,6 +369,19 @@ public:
   void setInterSearch                 (InterSearch* pcInterSearch)   { m_pcInterSearch = pcInterSearch; }
   void   setPltEnc                    ( bool b )                { m_doPlt = b; }
   bool   getPltEnc()                                      const { return m_doPlt; }
+
+  /** @brief Decide from the CLASSIC result in bestCS whether the GEODESIC pass of the current CU can be skipped (GEDFastDecision).
+   *
+   * GEODESIC is always tested if the parent CU or the left or above neighbour uses it. Otherwise it is skipped if the
+   * best CU is a skip CU, if the CLASSIC mvs are too small for the models to differ or if GEODESIC rarely wins in the picture.
+   */
+  bool   skipGeodesicPass             ( const CodingStructure& bestCS, const Partitioner& partitioner ) const;
+  /** @brief Record whether a GEODESIC pass produced the best CU for the per-picture selection rate. */
+  void   addGeodesicPassResult        ( const CodingStructure& bestCS, const Partitioner& partitioner );
+  /** @brief Selection rate statistics of the picture that the CTU being compressed sees. */
+  GeodesicPassStats getGeodesicPassStats() const { return GeodesicPassStats{ m_numGeodesicPasses, m_numGeodesicSelected }; }
+  /** @brief Start the next CTU of picture poc from the statistics that EncSlice merged from the CTUs coded before it. */
+  void   setGeodesicPassStats         ( int poc, const GeodesicPassStats& stats ) { m_geodesicStatsPOC = poc; m_numGeodesicPasses = stats.numPasses; m_numGeodesicSelected = stats.numSelected; }
   void   setBIMQPMap                  ( std::map<int, int*> *qpMap ) { m_bimQPMap = qpMap; }
   int    getBIMOffset                 ( int poc, int ctuId )
   {
@@ -0,0 +1,86 @@
+//
+// Motion fields of the temporal filter kept as start candidates of the integer motion search (TemporalFilterMotionSeeds).
+//
+
+#include "EncMotionSeeds.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iterator>
+
+
+void EncMotionSeeds::init(const int width, const int height, const int blockSize)
+{
+  m_width     = width;
+  m_height    = height;
+  m_blockSize = blockSize;
+  m_blocksX   = width / blockSize;
+  m_blocksY   = height / blockSize;
+  m_fieldMap.clear();
+}
+
+void EncMotionSeeds::addField(const int poc, const int offset, std::vector<Mv> &&mvs)
+{
+  CHECK(offset == 0, "A motion field needs a neighbouring picture.");
+  CHECK(mvs.size() != size_t(m_blocksX) * m_blocksY, "Motion field does not match the block grid.");
+
+  FieldEntry &entry = m_fieldMap[poc];
+  entry.fields.push_back(Field());
+  entry.fields.back().offset = offset;
+  entry.fields.back().mvs    = std::move(mvs);
+}
+
+bool EncMotionSeeds::getMv(const int poc, const int refPoc, const Area &blk, const Size &picSize, Mv &mv) const
+{
+  const auto it = m_fieldMap.find(poc);
+  const int  dist = refPoc - poc;
+  if (it == m_fieldMap.end() || dist == 0 || m_blocksX == 0 || m_blocksY == 0)
+  {
+    return false;
+  }
+
+  // the field of the closest neighbour on the side of the reference picture
+  const Field *best = nullptr;
+  for (const Field &field: it->second.fields)
+  {
+    if ((field.offset > 0) == (dist > 0) && (best == nullptr || abs(field.offset - dist) < abs(best->offset - dist)))
+    {
+      best = &field;
+    }
+  }
+  if (best == nullptr)
+  {
+    return false;
+  }
+
+  // block of the field at the center of blk
+  const int64_t centerX = blk.x + (blk.width >> 1);
+  const int64_t centerY = blk.y + (blk.height >> 1);
+  const int     blockX  = std::min(int(centerX * m_width / picSize.width) / m_blockSize, m_blocksX - 1);
+  const int     blockY  = std::min(int(centerY * m_height / picSize.height) / m_blockSize, m_blocksY - 1);
+  const Mv     &fieldMv = best->mvs[size_t(blockY) * m_blocksX + blockX];
+
+  // Field mvs are in 1/16 sample like the internal precision; scale to the coding resolution and reference distance.
+  const double scale = double(dist) / best->offset;
+  mv.set(int(std::lround(fieldMv.hor * scale * picSize.width / m_width)),
+         int(std::lround(fieldMv.ver * scale * picSize.height / m_height)));
+  return true;
+}
+
+void EncMotionSeeds::retire(const int poc)
+{
+  const auto it = m_fieldMap.find(poc);
+  if (it != m_fieldMap.end())
+  {
+    it->second.isRetired = true;
+  }
+}
+
+void EncMotionSeeds::eraseRetired()
+{
+  for (auto it = m_fieldMap.begin(); it != m_fieldMap.end();)
+  {
+    it = it->second.isRetired ? m_fieldMap.erase(it) : std::next(it);
+  }
+}
@@ -0,0 +1,63 @@
+//
+// Motion fields of the temporal filter kept as start candidates of the integer motion search (TemporalFilterMotionSeeds).
+//
+
+#pragma once
+
+#include <map>
+#include <vector>
+
+#include "CommonLib/Mv.h"
+#include "CommonLib/Unit.h"
+
+
+/**
+ * Block motion fields that the temporal filter estimates from the pictures it filters to their neighbouring pictures,
+ * stored per (POC, neighbour POC). The motion search of a picture takes the field closest to the distance of the
+ * reference picture, scaled to the reference distance and to the coding resolution, as an additional start candidate.
+ */
+class EncMotionSeeds {
+public:
+  EncMotionSeeds(): m_width(0), m_height(0), m_blockSize(0), m_blocksX(0), m_blocksY(0) {}
+
+  /** Fields cover pictures of width x height luma samples with one mv per blockSize x blockSize block. */
+  void init(int width, int height, int blockSize);
+  bool isInitialized() const { return m_blockSize > 0; }
+
+  /**
+   * @brief Store the field of picture poc to the picture at POC distance offset. The mvs are in raster order of the
+   * blocks, in 1/16 luma sample of the field resolution.
+   */
+  void addField(int poc, int offset, std::vector<Mv> &&mvs);
+
+  /**
+   * @brief Seed of the block blk of picture poc (coding resolution picSize) to the reference picture refPoc, in
+   * internal mv precision. Returns false if there is no field of poc in the direction of refPoc.
+   */
+  bool getMv(int poc, int refPoc, const Area &blk, const Size &picSize, Mv &mv) const;
+
+  /** @brief Mark the fields of poc for removal; they stay valid until eraseRetired(). */
+  void retire(int poc);
+  /** @brief Remove the retired fields, only while no picture is searched. */
+  void eraseRetired();
+
+protected:
+  struct Field {
+    int             offset;
+    std::vector<Mv> mvs;
+  };
+  struct FieldEntry {
+    std::vector<Field> fields;
+    bool               isRetired;
+
+    FieldEntry(): fields(), isRetired(false) {}
+  };
+
+  int m_width;
+  int m_height;
+  int m_blockSize;
+  int m_blocksX;
+  int m_blocksY;
+
+  std::map<int, FieldEntry> m_fieldMap;
+};
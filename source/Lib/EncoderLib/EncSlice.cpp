@@ -46,6 +46,8 @@
 
 
 #include <math.h>
+#include <condition_variable>
+#include <mutex>
 #if ENC_CTU_PROGRESS
 #include "CommonLib/ProgressBar.h"
 #endif
@@ -96,6 +98,11 @@ void EncSlice::init( EncLib* pcEncLib, const SPS& sps )
   m_CABACEstimator    = pcEncLib->getCABACEncoder()->getCABACEstimator(&sps);
   m_pcTrQuant         = pcEncLib->getTrQuant();
   m_pcRdCost          = pcEncLib->getRdCost();
+  m_pcReshaper        = pcEncLib->getReshaper();
+
+  m_pcTools           = nullptr;
+  m_wppThreadPool     = nullptr;
+  m_wppWorkers        = nullptr;
 
   // create lambda and QP arrays
   m_vdRdPicLambda.resize(m_pcCfg->getDeltaQpRD() * 2 + 1 );
@@ -104,6 +111,38 @@ void EncSlice::init( EncLib* pcEncLib, const SPS& sps )
   m_pcRateCtrl        = pcEncLib->getRateCtrl();
 }
 
+void EncSlice::init( EncLib* pcEncLib, const SPS& sps, EncWppWorker* pcTools )
+{
+  init( pcEncLib, sps );
+
+  m_pcCuEncoder       = pcTools->getCuEncoder();
+  m_pcInterSearch     = pcTools->getInterSearch();
+  m_CABACWriter       = pcTools->getCABACEncoder()->getCABACWriter   (&sps);
+  m_CABACEstimator    = pcTools->getCABACEncoder()->getCABACEstimator(&sps);
+  m_pcTrQuant         = pcTools->getTrQuant();
+  m_pcRdCost          = pcTools->getRdCost();
+  m_pcReshaper        = pcTools->getReshaper();
+
+  m_pcTools           = pcTools;
+}
+
+void EncSlice::setWppThreads( ThreadPool* wppThreadPool, std::vector<std::unique_ptr<EncWppWorker>>* wppWorkers )
+{
+  m_wppThreadPool     = wppThreadPool;
+  m_wppWorkers        = wppWorkers;
+}
+
+void EncSlice::initPicture( const EncSlice& sliceEncoder )
+{
+  m_uiSliceSegmentIdx = sliceEncoder.m_uiSliceSegmentIdx;
+#if SHARP_LUMA_DELTA_QP || ENABLE_QPA_SUB_CTU
+  m_gopID             = sliceEncoder.m_gopID;
+#endif
+#if ENABLE_QPA
+  m_adaptedLumaQP     = sliceEncoder.m_adaptedLumaQP;
+#endif
+}
+
 void EncSlice::setUpLambda(Slice *slice, const double dLambda, int qp)
 {
   m_pcRdCost->resetStore();
@@ -1575,7 +1614,7 @@ void EncSlice::compressSlice( Picture* pcPic, const bool bCompressEntireSlice, c
 #endif
   m_pcInterSearch->resetAffineMVList();
   m_pcInterSearch->resetUniMvList();
-  ::memset(g_isReusedUniMVsFilled, 0, sizeof(g_isReusedUniMVsFilled));
+  m_pcInterSearch->resetReusedUniMvs();
 #if INTERPRED_PROFILING
   m_pcInterSearch->reset_profiling();
 #endif
@@ -1676,9 +1715,9 @@ void EncSlice::encodeCtus( Picture* pcPic, const bool bCompressEntireSlice, cons
   const int iQPIndex              = pcSlice->getSliceQpBase();
 #endif
 
-  CABACWriter*    pCABACWriter    = pEncLib->getCABACEncoder()->getCABACEstimator( pcSlice->getSPS() );
-  TrQuant*        pTrQuant        = pEncLib->getTrQuant();
-  RdCost*         pRdCost         = pEncLib->getRdCost();
+  CABACWriter*    pCABACWriter    = m_CABACEstimator;
+  TrQuant*        pTrQuant        = m_pcTrQuant;
+  RdCost*         pRdCost         = m_pcRdCost;
   EncCfg*         pCfg            = pEncLib;
   RateCtrl*       pRateCtrl       = pEncLib->getRateCtrl();
   pRdCost->setLosslessRDCost(pcSlice->isLossless());
@@ -1735,6 +1774,23 @@ void EncSlice::encodeCtus( Picture* pcPic, const bool bCompressEntireSlice, cons
     }
   }
 
+  const bool wppRowReset = pEncLib->getEntropyCodingSyncEnabledFlag() && pCfg->getWppRowReset();
+  if( wppRowReset && pcSlice->getCtuAddrInSlice( 0 ) == 0 )
+  {
+    // the GEODESIC pass statistics of the picture, merged per CTU in wavefront order
+    m_ctuGeodesicStats.assign( pcv.sizeInCtus, GeodesicPassStats{ 0, 0 } );
+  }
+
+#if !ENABLE_TRACING && !K0149_BLOCK_STATISTICS
+  // the traces and statistics are written in CTU order, as are the debug CTU and the subpicture border padding
+  if( m_wppThreadPool && cs.pps->getNumTiles() == 1 && cs.pps->getNumSubPics() < 2
+      && ( pCfg->getSwitchPOC() != pcPic->poc || -1 == pCfg->getDebugCTU() ) )
+  {
+    xEncodeCtuRows( pcPic, pEncLib );
+    return;
+  }
+#endif
+
 #if ENC_CTU_PROGRESS
   ProgressBar progress{std::clog, 70u, "Coding POC " + std::to_string(pcSlice->getPOC()), '='};
 #endif
@@ -1789,6 +1845,11 @@ void EncSlice::encodeCtus( Picture* pcPic, const bool bCompressEntireSlice, cons
         }
       }
     }
+    if( wppRowReset && ( cs.pps->ctuIsTileColBd( ctuXPosInCtus ) || ctuIdx == 0 ) )
+    {
+      // same search state at the start of a CTU row as with the threaded CTU rows (WppThreads)
+      m_pcCuEncoder->initCtuRow();
+    }
     if (cs.pps->ctuIsTileColBd( ctuXPosInCtus ) && cs.pps->ctuIsTileRowBd( ctuYPosInCtus ))
     {
       pCABACWriter->initCtxModels( *pcSlice );
@@ -1803,11 +1864,11 @@ void EncSlice::encodeCtus( Picture* pcPic, const bool bCompressEntireSlice, cons
       if( cs.getCURestricted( pos.offset(0, -1), pos, pcSlice->getIndependentSliceIdx(), cs.pps->getTileIdx( pos ), CH_L ) )
       {
         // Top is available, we use it.
-        pCABACWriter->getCtx() = pEncLib->m_entropyCodingSyncContextState;
+        pCABACWriter->getCtx() = m_entropyCodingSyncContextState;
         pCABACWriter->getCtx().riceStatReset(
           pcSlice->getSPS()->getBitDepth(CHANNEL_TYPE_LUMA),
           pcSlice->getSPS()->getSpsRangeExtension().getPersistentRiceAdaptationEnabledFlag());
-        cs.setPrevPLT(pEncLib->m_palettePredictorSyncState);
+        cs.setPrevPLT(m_palettePredictorSyncState);
       }
       prevQP[0] = prevQP[1] = pcSlice->getSliceQp();
     }
@@ -1899,12 +1960,16 @@ void EncSlice::encodeCtus( Picture* pcPic, const bool bCompressEntireSlice, cons
     bool updateBcwCodingOrder = cs.slice->getSliceType() == B_SLICE && ctuIdx == 0;
     if( updateBcwCodingOrder )
     {
-      resetBcwCodingOrder(false, cs);
+      if( !m_pcTools )
+      {
+        // the frame workers only read the coding order, EncGOP sets it up before their pictures are compressed
+        resetBcwCodingOrder(false, cs);
+      }
       m_pcInterSearch->initWeightIdxBits();
     }
     if (pcSlice->getSPS()->getUseLmcs())
     {
-      m_pcCuEncoder->setDecCuReshaperInEncCU(m_pcLib->getReshaper(), pcSlice->getSPS()->getChromaFormatIdc());
+      m_pcCuEncoder->setDecCuReshaperInEncCU(m_pcReshaper, pcSlice->getSPS()->getChromaFormatIdc());
     }
     if( !cs.slice->isIntra() && pCfg->getMCTSEncConstraint() )
     {
@@ -1913,7 +1978,17 @@ void EncSlice::encodeCtus( Picture* pcPic, const bool bCompressEntireSlice, cons
 
     if (pCfg->getSwitchPOC() != pcPic->poc || ctuRsAddr >= pCfg->getDebugCTU())
     {
-      m_pcCuEncoder->compressCtu(cs, ctuArea, ctuRsAddr, prevQP, currQP);
+      if( wppRowReset )
+      {
+        EncModeCtrl&            modeCtrl   = *m_pcCuEncoder->getModeCtrl();
+        const GeodesicPassStats aboveStats = xInitCtuGeodesicPassStats( modeCtrl, pcPic->poc, ctuXPosInCtus, ctuYPosInCtus, widthInCtus );
+        m_pcCuEncoder->compressCtu(cs, ctuArea, ctuRsAddr, prevQP, currQP);
+        xStoreCtuGeodesicPassStats( modeCtrl, aboveStats, ctuXPosInCtus, ctuYPosInCtus, widthInCtus );
+      }
+      else
+      {
+        m_pcCuEncoder->compressCtu(cs, ctuArea, ctuRsAddr, prevQP, currQP);
+      }
     }
 #if K0149_BLOCK_STATISTICS
     getAndStoreBlockStatistics(cs, ctuArea);
@@ -1928,8 +2003,8 @@ void EncSlice::encodeCtus( Picture* pcPic, const bool bCompressEntireSlice, cons
     // Store probabilities of first CTU in line into buffer - used only if wavefront-parallel-processing is enabled.
     if( cs.pps->ctuIsTileColBd( ctuXPosInCtus ) && pEncLib->getEntropyCodingSyncEnabledFlag() )
     {
-      pEncLib->m_entropyCodingSyncContextState = pCABACWriter->getCtx();
-      cs.storePrevPLT(pEncLib->m_palettePredictorSyncState);
+      m_entropyCodingSyncContextState = pCABACWriter->getCtx();
+      cs.storePrevPLT(m_palettePredictorSyncState);
     }
 
     int actualBits = int(cs.fracBits >> SCALE_BITS);
@@ -2021,6 +2096,232 @@ void EncSlice::encodeCtus( Picture* pcPic, const bool bCompressEntireSlice, cons
   }
 }
 
+void EncSlice::xEncodeCtuRows( Picture* pcPic, EncLib* pEncLib )
+{
+  CodingStructure&     cs          = *pcPic->cs;
+  Slice*               pcSlice     = cs.slice;
+  const PreCalcValues& pcv         = *cs.pcv;
+  const int            widthInCtus = int( pcv.widthInCtus );
+  ThreadPool*          threadPool  = m_wppThreadPool;
+
+  if( cs.slice->getSliceType() == B_SLICE )
+  {
+    if( !m_pcTools )
+    {
+      resetBcwCodingOrder( false, cs );
+    }
+    m_pcInterSearch->initWeightIdxBits();
+  }
+  std::vector<EncWppWorker*> freeWorkers;
+  for( auto &worker : *m_wppWorkers )
+  {
+    if( m_pcTools )
+    {
+      worker->initSlice( *m_pcTools, *pcSlice );
+    }
+    else
+    {
+      worker->initSlice( pEncLib, *pcSlice );
+    }
+    freeWorkers.push_back( worker.get() );
+  }
+
+  // the rows read the units of the picture while other rows add theirs, so the unit vectors must not reallocate
+  size_t maxNumUnits = 0;
+  for( uint32_t ch = 0; ch < ::getNumberValidChannels( cs.area.chromaFormat ); ch++ )
+  {
+    maxNumUnits += cs.area.blocks[ch].area() >> ( 2 * MIN_CU_LOG2 );
+  }
+  cs.cus.reserve( maxNumUnits );
+  cs.pus.reserve( maxNumUnits );
+  cs.tus.reserve( maxNumUnits );
+
+  // the CTUs of the slice in each CTU row
+  struct CtuRowSegment
+  {
+    int y;
+    int xBegin;
+    int xEnd;
+  };
+  std::vector<CtuRowSegment> segments;
+  for( uint32_t ctuIdx = 0; ctuIdx < pcSlice->getNumCtuInSlice(); ctuIdx++ )
+  {
+    const int ctuRsAddr = int( pcSlice->getCtuAddrInSlice( ctuIdx ) );
+    const int x         = ctuRsAddr % widthInCtus;
+    const int y         = ctuRsAddr / widthInCtus;
+    if( segments.empty() || segments.back().y != y )
+    {
+      segments.push_back( CtuRowSegment{ y, x, x + 1 } );
+    }
+    else
+    {
+      CHECK( segments.back().xEnd != x, "The CTUs of a slice in a CTU row must be consecutive" );
+      segments.back().xEnd = x + 1;
+    }
+  }
+
+  // number of coded CTUs per row, rows outside of the slice count as coded
+  std::vector<int> colsDone( pcv.heightInCtus, widthInCtus );
+  for( const CtuRowSegment &segment : segments )
+  {
+    colsDone[segment.y] = segment.xBegin;
+  }
+  std::vector<Ctx>       syncCtx( pcv.heightInCtus );
+  std::vector<PLTBuf>    syncPLT( pcv.heightInCtus );
+  std::vector<uint32_t>  rowBits( segments.size(), 0 );
+  std::mutex             picLock;
+  std::vector<EncCtuRow> ctuRows( segments.size(), EncCtuRow{ &picLock, cs.motionLut, cs.prevPLT } );
+
+  std::mutex              rowMutex;
+  std::condition_variable rowDone;
+  bool                    abort = false;
+
+  for( int s = 0; s < int( segments.size() ); s++ )
+  {
+    // the tasks start in row order, so a row only waits for rows that are already running
+    threadPool->addTask( [&, s]
+    {
+      const CtuRowSegment &segment = segments[s];
+      EncCtuRow           &ctuRow  = ctuRows[s];
+      EncWppWorker        *worker  = nullptr;
+      {
+        std::unique_lock<std::mutex> lock( rowMutex );
+        CHECK( freeWorkers.empty(), "No free WPP worker" );
+        worker = freeWorkers.back();
+        freeWorkers.pop_back();
+      }
+
+      try
+      {
+        EncCu*       cuEncoder    = worker->getCuEncoder();
+        CABACWriter* pCABACWriter = worker->getCABACEstimator( pcSlice->getSPS() );
+        int prevQP[2];
+        int currQP[2];
+        prevQP[0] = prevQP[1] = pcSlice->getSliceQp();
+        currQP[0] = currQP[1] = pcSlice->getSliceQp();
+        pCABACWriter->initCtxModels( *pcSlice );
+        cuEncoder->initCtuRow();
+
+        for( int x = segment.xBegin; x < segment.xEnd; x++ )
+        {
+          const uint32_t ctuRsAddr = segment.y * widthInCtus + x;
+          const Position pos( x * pcv.maxCUWidth, segment.y * pcv.maxCUHeight );
+          const UnitArea ctuArea( cs.area.chromaFormat, Area( pos.x, pos.y, pcv.maxCUWidth, pcv.maxCUHeight ) );
+
+          // the CTU above right must be coded
+          if( segment.y > 0 )
+          {
+            std::unique_lock<std::mutex> lock( rowMutex );
+            rowDone.wait( lock, [&] { return abort || colsDone[segment.y - 1] >= std::min( x + 2, widthInCtus ); } );
+            if( abort )
+            {
+              break;
+            }
+          }
+
+          if( x == 0 )
+          {
+            if( cs.slice->getSliceType() != I_SLICE || cs.sps->getIBCFlag() )
+            {
+              ctuRow.motionLut.lut.resize( 0 );
+              ctuRow.motionLut.lutIbc.resize( 0 );
+            }
+            cs.resetPrevPLT( ctuRow.prevPLT );
+            if( cs.getCURestricted( pos.offset( 0, -1 ), pos, pcSlice->getIndependentSliceIdx(), cs.pps->getTileIdx( pos ), CH_L ) )
+            {
+              // Top is available, we use it.
+              pCABACWriter->getCtx() = syncCtx[segment.y - 1];
+              pCABACWriter->getCtx().riceStatReset(
+                pcSlice->getSPS()->getBitDepth( CHANNEL_TYPE_LUMA ),
+                pcSlice->getSPS()->getSpsRangeExtension().getPersistentRiceAdaptationEnabledFlag() );
+              ctuRow.prevPLT = syncPLT[segment.y - 1];
+            }
+          }
+
+          const GeodesicPassStats aboveStats = xInitCtuGeodesicPassStats( *cuEncoder->getModeCtrl(), pcPic->poc, x, segment.y, widthInCtus );
+          cuEncoder->compressCtu( cs, ctuArea, ctuRsAddr, prevQP, currQP, &ctuRow );
+          xStoreCtuGeodesicPassStats( *cuEncoder->getModeCtrl(), aboveStats, x, segment.y, widthInCtus );
+
+          {
+            std::lock_guard<std::mutex> lock( picLock );
+            pCABACWriter->resetBits();
+            pCABACWriter->coding_tree_unit( cs, ctuArea, prevQP, ctuRsAddr, true, true );
+          }
+          rowBits[s] += uint32_t( pCABACWriter->getEstFracBits() >> SCALE_BITS );
+
+          if( x == 0 )
+          {
+            syncCtx[segment.y] = pCABACWriter->getCtx();
+            syncPLT[segment.y] = ctuRow.prevPLT;
+          }
+
+          {
+            std::lock_guard<std::mutex> lock( rowMutex );
+            colsDone[segment.y] = x + 1;
+          }
+          rowDone.notify_all();
+        }
+      }
+      catch( ... )
+      {
+        {
+          std::lock_guard<std::mutex> lock( rowMutex );
+          abort = true;
+          freeWorkers.push_back( worker );
+        }
+        rowDone.notify_all();
+        throw;
+      }
+
+      std::lock_guard<std::mutex> lock( rowMutex );
+      freeWorkers.push_back( worker );
+    } );
+  }
+  threadPool->waitForAll();
+
+  for( uint32_t bits : rowBits )
+  {
+    pcSlice->setSliceBits( pcSlice->getSliceBits() + bits );
+  }
+  cs.motionLut = ctuRows.back().motionLut;
+  cs.prevPLT   = ctuRows.back().prevPLT;
+  m_entropyCodingSyncContextState = syncCtx[segments.back().y];
+  m_palettePredictorSyncState     = syncPLT[segments.back().y];
+
+  m_uiPicTotalBits = cs.fracBits >> SCALE_BITS;
+  m_uiPicDist      = cs.dist;
+
+  // same unit order as with the CTUs coded one after the other
+  cs.sortUnitsInCtuOrder();
+}
+
+GeodesicPassStats EncSlice::xInitCtuGeodesicPassStats( EncModeCtrl& modeCtrl, const int poc, const int x, const int y, const int widthInCtus ) const
+{
+  // The rows above are coded up to the CTU above right, each further row one CTU more. These CTUs are done in any
+  // order of the threaded rows, so the statistics do not depend on the timing of the threads.
+  GeodesicPassStats aboveStats{ 0, 0 };
+  for( int k = 1; k <= y; k++ )
+  {
+    const GeodesicPassStats& rowStats = m_ctuGeodesicStats[( y - k ) * widthInCtus + std::min( x + k, widthInCtus - 1 )];
+    aboveStats.numPasses   += rowStats.numPasses;
+    aboveStats.numSelected += rowStats.numSelected;
+  }
+  GeodesicPassStats stats = aboveStats;
+  if( x > 0 )
+  {
+    stats.numPasses   += m_ctuGeodesicStats[y * widthInCtus + x - 1].numPasses;
+    stats.numSelected += m_ctuGeodesicStats[y * widthInCtus + x - 1].numSelected;
+  }
+  modeCtrl.setGeodesicPassStats( poc, stats );
+  return aboveStats;
+}
+
+void EncSlice::xStoreCtuGeodesicPassStats( const EncModeCtrl& modeCtrl, const GeodesicPassStats& aboveStats, const int x, const int y, const int widthInCtus )
+{
+  const GeodesicPassStats stats = modeCtrl.getGeodesicPassStats();
+  m_ctuGeodesicStats[y * widthInCtus + x] = GeodesicPassStats{ stats.numPasses - aboveStats.numPasses, stats.numSelected - aboveStats.numSelected };
+}
+
 void EncSlice::encodeSlice   ( Picture* pcPic, OutputBitstream* pcSubstreams, uint32_t &numBinsCoded )
 {
 
@@ -51,6 +51,8 @@
 
 class EncLib;
 class EncGOP;
+class EncWppWorker;
+class ThreadPool;
 
 // ====================================================================================================================
 // Class definition
@@ -83,6 +85,14 @@ private:
   // RD optimization
   RdCost*                 m_pcRdCost;                           ///< RD cost computation
   CABACWriter*            m_CABACEstimator;
+  EncReshape*             m_pcReshaper;                         ///< reshaper of the CU encoder
+
+  // wavefront-parallel CTU row encoding
+  EncWppWorker*           m_pcTools;                            ///< tools of a frame worker (FrameThreads), nullptr: those of EncLib
+  ThreadPool*             m_wppThreadPool;                      ///< threads encoding the CTU rows (WppThreads)
+  std::vector<std::unique_ptr<EncWppWorker>>* m_wppWorkers;     ///< tools of the CTU row threads
+  std::vector<GeodesicPassStats> m_ctuGeodesicStats;           ///< GEODESIC pass statistics of each CTU row up to each CTU (WppRowReset)
+
   uint64_t                  m_uiPicTotalBits;                     ///< total bits for the picture
   uint64_t                  m_uiPicDist;                          ///< total distortion for the picture
   std::vector<double>     m_vdRdPicLambda;                      ///< array of lambda candidates
@@ -116,6 +126,12 @@ public:
                  uint8_t uhTotalDepth);
   void    destroy             ();
   void    init                ( EncLib* pcEncLib, const SPS& sps );
+  /// initialize with the tools of a frame worker (FrameThreads) instead of those of EncLib
+  void    init                ( EncLib* pcEncLib, const SPS& sps, EncWppWorker* pcTools );
+  /// encode the CTU rows of the slices on the given threads and tools (WppThreads)
+  void    setWppThreads       ( ThreadPool* wppThreadPool, std::vector<std::unique_ptr<EncWppWorker>>* wppWorkers );
+  /// take over the picture level state (GOP entry, slice segment) that initEncSlice set up in another slice encoder
+  void    initPicture         ( const EncSlice& sliceEncoder );
 
   /// preparation of slice encoding (reference marking, QP and lambda)
   void initEncSlice(Picture *pcPic, const int pocLast, const int pocCurr, const int gopId, Slice *&rpcSlice,
@@ -145,6 +161,13 @@ public:
   void    setEncCABACTableIdx (SliceType b)         { m_encCABACTableIdx = b; }
 private:
   double  xGetQPValueAccordingToLambda ( double lambda );
+  /// compress the CTU rows of the slice on the WPP workers of pcEncLib, each row trailing the row above by two CTUs
+  void    xEncodeCtuRows      ( Picture* pcPic, EncLib* pcEncLib );
+  /// start CTU (x, y) of picture poc from the GEODESIC pass statistics of the CTUs that wavefront order codes before it,
+  /// returns those of the rows above
+  GeodesicPassStats xInitCtuGeodesicPassStats( EncModeCtrl& modeCtrl, int poc, int x, int y, int widthInCtus ) const;
+  /// keep the GEODESIC pass statistics of the CTU row up to CTU (x, y)
+  void    xStoreCtuGeodesicPassStats( const EncModeCtrl& modeCtrl, const GeodesicPassStats& aboveStats, int x, int y, int widthInCtus );
 };
 
 //! \}
@@ -47,6 +47,7 @@ const double EncTemporalFilter::m_chromaFactor    =  0.55;
 const double EncTemporalFilter::m_sigmaMultiplier =  9.0;
 const double EncTemporalFilter::m_sigmaZeroPoint  = 10.0;
 const int EncTemporalFilter::m_motionVectorFactor = 16;
+const int EncTemporalFilter::m_motionSeedBlockSize = 8;
 const int EncTemporalFilter::m_padding = 128;
 const int EncTemporalFilter::m_interpolationFilter[16][8] =
 {
@@ -84,7 +85,8 @@ EncTemporalFilter::EncTemporalFilter() :
   m_sourceHeight(0),
   m_QP(0),
   m_clipInputVideoToRec709Range(false),
-  m_inputColourSpaceConvert(NUMBER_INPUT_COLOUR_SPACE_CONVERSIONS)
+  m_inputColourSpaceConvert(NUMBER_INPUT_COLOUR_SPACE_CONVERSIONS),
+  m_motionSeeds(nullptr)
 {}
 
 void EncTemporalFilter::init(const int frameSkip, const int inputBitDepth[MAX_NUM_CHANNEL_TYPE],
@@ -95,6 +97,7 @@ void EncTemporalFilter::init(const int frameSkip, const int inputBitDepth[MAX_NU
                              const int qp, const std::map<int, double> &temporalFilterStrengths, const int pastRefs,
                              const int futureRefs, const int firstValidFrame, const int lastValidFrame
                              , const bool mctfEnabled, std::map<int, int*> *adaptQPmap, const bool bimEnabled, const int ctuSize
+                             , EncMotionSeeds *motionSeeds
                              )
 {
   m_FrameSkip = frameSkip;
@@ -128,6 +131,11 @@ void EncTemporalFilter::init(const int frameSkip, const int inputBitDepth[MAX_NU
   m_numCtu = ((width + ctuSize - 1) / ctuSize) * ((height + ctuSize - 1) / ctuSize);
   m_ctuSize = ctuSize;
   m_ctuAdaptedQP = adaptQPmap;
+  m_motionSeeds = motionSeeds;
+  if (m_motionSeeds != nullptr)
+  {
+    m_motionSeeds->init(width, height, m_motionSeedBlockSize);
+  }
 }
 
 // ====================================================================================================================
@@ -200,6 +208,23 @@ bool EncTemporalFilter::filter(PelStorage *orgPic, int receivedPoc)
 
       motionEstimation(srcPic.mvs, origPadded, srcPic.picBuffer, origSubsampled2, origSubsampled4);
       srcPic.origOffset = poc - currentFilePoc;
+
+      if (m_motionSeeds != nullptr)
+      {
+        // the 8x8 block mvs occupy the first width / 8 x height / 8 entries of the field
+        std::vector<Mv> seeds;
+        seeds.reserve(size_t(m_sourceWidth / m_motionSeedBlockSize) * (m_sourceHeight / m_motionSeedBlockSize));
+        for (int y = 0; y < m_sourceHeight / m_motionSeedBlockSize; y++)
+        {
+          for (int x = 0; x < m_sourceWidth / m_motionSeedBlockSize; x++)
+          {
+            const MotionVector &mv = srcPic.mvs.get(x, y);
+            seeds.push_back(Mv(mv.x * (1 << MV_FRACTIONAL_BITS_INTERNAL) / m_motionVectorFactor,
+                               mv.y * (1 << MV_FRACTIONAL_BITS_INTERNAL) / m_motionVectorFactor));
+          }
+        }
+        m_motionSeeds->addField(receivedPoc, srcPic.origOffset, std::move(seeds));
+      }
     }
 
     // filter
@@ -114,6 +114,7 @@ public:
             const std::map<int, double> &temporalFilterStrengths, const int pastRefs, const int futureRefs,
             const int firstValidFrame, const int lastValidFrame
             , const bool bMCTFenabled, std::map<int, int*> *adaptQPmap, const bool bBIMenabled, const int ctuSize
+            , EncMotionSeeds *motionSeeds = nullptr
             );
 
   bool filter(PelStorage *orgPic, int frame);
@@ -128,6 +129,7 @@ private:
   static const int m_interpolationFilter[16][8];
   static const double m_refStrengths[2][4];
   static const int m_cuTreeThresh[4];
+  static const int m_motionSeedBlockSize;
 
   // Private member variables
   int m_FrameSkip;
@@ -154,6 +156,7 @@ private:
   int m_numCtu;
   int m_ctuSize;
   std::map<int, int*> *m_ctuAdaptedQP;
+  EncMotionSeeds *m_motionSeeds;  ///< Keeps the motion fields for the motion search, nullptr if unused
 
   // Private functions
   void subsampleLuma(const PelStorage &input, PelStorage &output, const int factor = 2) const;
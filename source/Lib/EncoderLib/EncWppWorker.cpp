@@ -0,0 +1,90 @@
+//
+// Encoder tools of one worker thread of the wavefront-parallel CTU row encoder (WppThreads).
+//
+
+#include "EncWppWorker.h"
+
+#include "EncLib.h"
+
+
+void EncWppWorker::init(EncLib *encLib, const SPS &sps)
+{
+  const uint32_t maxCUWidth      = encLib->getMaxCUWidth();
+  const uint32_t maxCUHeight     = encLib->getMaxCUHeight();
+  const uint32_t maxTotalCUDepth = floorLog2(maxCUWidth) - encLib->getLog2MinCodingBlockSize();
+
+  m_cuEncoder.create(encLib);
+  m_deblockingFilter.create(floorLog2(maxCUWidth) - MIN_CU_LOG2);
+  if (!encLib->getDeblockingFilterDisable() && encLib->getUseEncDbOpt())
+  {
+    m_deblockingFilter.initEncPicYuvBuffer(encLib->getChromaFormatIdc(),
+                                           Size(encLib->getSourceWidth(), encLib->getSourceHeight()), maxCUWidth);
+  }
+
+  m_cuEncoder.init(encLib, sps, &m_intraSearch, &m_interSearch, &m_trQuant, &m_rdCost, &m_CABACEncoder, &m_ctxCache,
+                   &m_deblockingFilter);
+
+  // shares the scaling lists of the encoder's quantizer
+  m_trQuant.init(encLib->getTrQuant()->getQuant(), 1 << encLib->getLog2MaxTbSize(), encLib->getUseRDOQ(),
+                 encLib->getUseRDOQTS(), encLib->getUseSelectiveRDOQ(), true);
+
+  MVReprojection *mvReprojection = encLib->getInterSearch()->getMVReprojection();
+  if (mvReprojection->isInitialized())
+  {
+    m_mvReprojection.init(mvReprojection->getData());
+  }
+
+  CABACWriter *cabacEstimator = m_CABACEncoder.getCABACEstimator(&sps);
+  m_intraSearch.init(encLib, &m_trQuant, &m_rdCost, cabacEstimator, &m_ctxCache, maxCUWidth, maxCUHeight,
+                     maxTotalCUDepth, &m_reshaper, sps.getBitDepth(CHANNEL_TYPE_LUMA));
+  m_interSearch.init(encLib, &m_trQuant, encLib->getSearchRange(), encLib->getBipredSearchRange(),
+                     encLib->getMotionEstimationSearchMethod(), encLib->getUseCompositeRef(), maxCUWidth, maxCUHeight,
+                     maxTotalCUDepth, &m_rdCost, cabacEstimator, &m_ctxCache, &m_reshaper, &m_mvReprojection);
+  m_interSearch.setTempBuffers(m_intraSearch.getSplitCSBuf(), m_intraSearch.getFullCSBuf(), m_intraSearch.getSaveCSBuf());
+}
+
+void EncWppWorker::destroy()
+{
+  m_cuEncoder.destroy();
+  m_deblockingFilter.destroy();
+  m_interSearch.destroy();
+  m_intraSearch.destroy();
+}
+
+void EncWppWorker::initSlice(EncLib *encLib, const Slice &slice)
+{
+  xInitSlice(*encLib->getRdCost(), *encLib->getTrQuant(), *encLib->getInterSearch(), *encLib->getReshaper(),
+             *encLib->getCuEncoder()->getModeCtrl(), slice);
+}
+
+void EncWppWorker::initSlice(EncWppWorker &source, const Slice &slice)
+{
+  xInitSlice(source.m_rdCost, source.m_trQuant, source.m_interSearch, source.m_reshaper,
+             *source.m_cuEncoder.getModeCtrl(), slice);
+}
+
+void EncWppWorker::xInitSlice(const RdCost &rdCost, const TrQuant &trQuant, const InterSearch &interSearch,
+                              const EncReshape &reshaper, const EncModeCtrl &modeCtrl, const Slice &slice)
+{
+  m_rdCost = rdCost;
+
+#if RDOQ_CHROMA_LAMBDA
+  double lambdas[MAX_NUM_COMPONENT];
+  trQuant.getLambdas(lambdas);
+  m_trQuant.setLambdas(lambdas);
+#endif
+  m_trQuant.setLambda(trQuant.getLambda());
+  m_trQuant.resetStore();
+
+  m_interSearch.copySliceSettings(interSearch);
+  m_interSearch.initWeightIdxBits();
+
+  if (slice.getSPS()->getUseLmcs())
+  {
+    m_reshaper = reshaper;
+    m_cuEncoder.setDecCuReshaperInEncCU(&m_reshaper, slice.getSPS()->getChromaFormatIdc());
+  }
+
+  m_cuEncoder.getModeCtrl()->setFastDeltaQp(modeCtrl.getFastDeltaQp());
+  m_cuEncoder.getModeCtrl()->setPltEnc(modeCtrl.getPltEnc());
+}
@@ -0,0 +1,64 @@
+//
+// Encoder tools of one worker thread of the wavefront-parallel CTU row encoder (WppThreads).
+//
+
+#pragma once
+
+#include "CommonLib/DeblockingFilter.h"
+#include "CommonLib/MVReprojection.h"
+#include "CommonLib/RdCost.h"
+#include "CommonLib/TrQuant.h"
+
+#include "CABACWriter.h"
+#include "EncCu.h"
+#include "EncReshape.h"
+#include "InterSearch.h"
+#include "IntraSearch.h"
+
+class EncLib;
+
+
+/**
+ * Own instances of the CU encoder and of the search and coding tools it uses, set up like those of EncLib. One worker
+ * encodes one CTU row at a time; EncSlice hands the rows of a picture to the workers in wavefront order. The frame
+ * workers of FrameThreads use the same tool set for the pictures they compress.
+ */
+class EncWppWorker {
+public:
+  EncWppWorker() = default;
+
+  EncWppWorker(const EncWppWorker&) = delete;
+  EncWppWorker& operator=(const EncWppWorker&) = delete;
+
+  /** @brief Create the tools for the configuration of encLib, after EncLib::init has set up its own tools. */
+  void init(EncLib *encLib, const SPS &sps);
+  void destroy();
+
+  /** @brief Take over the slice level state of the tools of encLib (lambdas, search ranges, reshaper, mode control). */
+  void initSlice(EncLib *encLib, const Slice &slice);
+  /** @brief Take over the slice level state of the tools of another worker. */
+  void initSlice(EncWppWorker &source, const Slice &slice);
+
+  EncCu*        getCuEncoder()                        { return &m_cuEncoder; }
+  CABACEncoder* getCABACEncoder()                     { return &m_CABACEncoder; }
+  CABACWriter*  getCABACEstimator(const SPS *sps)     { return m_CABACEncoder.getCABACEstimator(sps); }
+  InterSearch*  getInterSearch()                      { return &m_interSearch; }
+  TrQuant*      getTrQuant()                          { return &m_trQuant; }
+  RdCost*       getRdCost()                           { return &m_rdCost; }
+  EncReshape*   getReshaper()                         { return &m_reshaper; }
+
+protected:
+  void xInitSlice(const RdCost &rdCost, const TrQuant &trQuant, const InterSearch &interSearch,
+                  const EncReshape &reshaper, const EncModeCtrl &modeCtrl, const Slice &slice);
+
+  EncCu            m_cuEncoder;
+  IntraSearch      m_intraSearch;
+  InterSearch      m_interSearch;
+  TrQuant          m_trQuant;
+  RdCost           m_rdCost;
+  CABACEncoder     m_CABACEncoder;
+  CtxCache         m_ctxCache;
+  EncReshape       m_reshaper;
+  DeblockingFilter m_deblockingFilter;
+  MVReprojection   m_mvReprojection;  ///< Context on the reprojection data of EncLib with the caches of this worker
+};
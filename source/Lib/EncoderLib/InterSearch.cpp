@@ -117,6 +117,7 @@ InterSearch::InterSearch()
   m_uniMvList = nullptr;
   m_uniMvListSize = 0;
   m_uniMvListIdx = 0;
+  m_classicMvInfo = BlkClassicMvInfo();
   m_histBestSbt    = MAX_UCHAR;
   m_histBestMtsIdx = MAX_UCHAR;
 }
@@ -286,12 +287,27 @@ void InterSearch::init( EncCfg *pcEncCfg,
   }
   m_uniMvListIdx = 0;
   m_uniMvListSize = 0;
+  if (!m_reusedUniMvs)
+  {
+    m_reusedUniMvs.reset(new ReusedUniMvs);
+  }
+  resetReusedUniMvs();
   m_isInitialized = true;
 
   // Multi-model
   m_tmpMMStorage.create(Size(MAX_CU_SIZE, MAX_CU_SIZE));
 }
 
+void InterSearch::insertReusedUniMvCands(const CompArea &blkArea, const PreCalcValues &pcv)
+{
+  unsigned idx1, idx2, idx3, idx4;
+  getAreaIdx(blkArea, pcv, idx1, idx2, idx3, idx4);
+  if (m_reusedUniMvs->filled[idx1][idx2][idx3][idx4])
+  {
+    insertUniMvCands(blkArea, m_reusedUniMvs->mvs[idx1][idx2][idx3][idx4]);
+  }
+}
+
 void InterSearch::resetSavedAffineMotion()
 {
   for ( int i = 0; i < 2; i++ )
@@ -366,6 +382,23 @@ inline void InterSearch::xTZSearchHelp( IntTZSearchStruct& rcStruct, const int i
 
 //  CHECK(!( !( rcStruct.searchRange.left > iSearchX || rcStruct.searchRange.right < iSearchX || rcStruct.searchRange.top > iSearchY || rcStruct.searchRange.bottom < iSearchY )), "Unspecified error");
 
+  // GED fast search: skip the full reprojection and interpolation of candidates whose mv cost alone reaches the best
+  // cost, which is exact, and of candidates whose subsampled estimate exceeds it by a margin, which can drop the best
+  // candidate. There is no pruning along the epipole axis; each candidate is checked on its own.
+  if (rcStruct.motionModel != CLASSIC && m_pcEncCfg->getUseGEDFastSearch() && rcStruct.uiBestSad < std::numeric_limits<Distortion>::max())
+  {
+    const Distortion uiBitCost = m_pcRdCost->getCostOfVectorWithPredictor(iSearchX, iSearchY, rcStruct.imvShift);
+    if (uiBitCost >= rcStruct.uiBestSad)
+    {
+      return;
+    }
+    if ((rcStruct.blkSize.width >> 2) * (rcStruct.blkSize.height >> 2) >= GED_FAST_SEARCH_MIN_SUBBLOCKS
+        && xGetSampledDistortionGED(rcStruct, Mv(iSearchX, iSearchY)) + uiBitCost > rcStruct.uiBestSad + (rcStruct.uiBestSad >> GED_FAST_SEARCH_MARGIN_SHIFT))
+    {
+      return;
+    }
+  }
+
   xApplyMvVA(rcStruct, Mv(iSearchX, iSearchY), MV_PRECISION_INT);
 
   if( 1 == rcStruct.subShiftMode )
@@ -3240,8 +3273,8 @@ void InterSearch::predInterSearch(CodingUnit& cu, Partitioner& partitioner, cons
 
         unsigned idx1, idx2, idx3, idx4;
         getAreaIdx(cu.Y(), *cu.slice->getPPS()->pcv, idx1, idx2, idx3, idx4);
-        ::memcpy(&(g_reusedUniMVs[idx1][idx2][idx3][idx4][0][0]), cMvTemp, 2 * 33 * sizeof(Mv));
-        g_isReusedUniMVsFilled[idx1][idx2][idx3][idx4] = true;
+        ::memcpy(&(m_reusedUniMvs->mvs[idx1][idx2][idx3][idx4][0][0]), cMvTemp, 2 * 33 * sizeof(Mv));
+        m_reusedUniMvs->filled[idx1][idx2][idx3][idx4] = true;
       }
       //  Bi-predictive Motion estimation
       if( ( cs.slice->isInterB() ) && ( PU::isBipredRestriction( pu ) == false )
@@ -5090,6 +5123,24 @@ void InterSearch::xMotionEstimation(PredictionUnit &pu, PelUnitBuf &origBuf, Ref
       }
     }
 
+    Mv seedMv;
+    if( !bBi && xGetTemporalFilterSeedMv( pu, eRefPicList, refIdxPred, cStruct.motionModel, seedMv ) )
+    {
+      cTmpMv = seedMv;
+      clipMv( cTmpMv, pu.cu->lumaPos(), pu.cu->lumaSize(), *pu.cs->sps, *pu.cs->pps, cStruct.motionModel);
+      cTmpMv.changePrecision(MV_PRECISION_INTERNAL, MV_PRECISION_INT);
+      xApplyMvVA(cStruct, cTmpMv, MV_PRECISION_INT);
+
+      Distortion uiSad = m_cDistParam.distFunc(m_cDistParam);
+      uiSad += m_pcRdCost->getCostOfVectorWithPredictor(cTmpMv.hor, cTmpMv.ver, cStruct.imvShift);
+      if (uiSad < uiBestSad)
+      {
+        uiBestSad                                  = uiSad;
+        bestInitMv                                 = seedMv;
+        m_cDistParam.maximumDistortionForEarlyExit = uiSad;
+      }
+    }
+
     if( !bQTBTMV )
     {
 #if GDR_ENABLED
@@ -5100,6 +5151,15 @@ void InterSearch::xMotionEstimation(PredictionUnit &pu, PelUnitBuf &origBuf, Ref
     }
     xPatternSearch( cStruct, rcMv, ruiCost);
   }
+  else if( xGetGeodesicSeedMv( pu, eRefPicList, refIdxPred, rcMv ) )
+  {
+    cStruct.subShiftMode = ( m_pcEncCfg->getFastInterSearchMode() == FASTINTERSEARCH_MODE1 || m_pcEncCfg->getFastInterSearchMode() == FASTINTERSEARCH_MODE3 ) ? 2 : 0;
+#if GDR_ENABLED
+    xSeededSearch(pu, cStruct, rcMv, ruiCost, eRefPicList, refIdxPred);
+#else
+    xSeededSearch(pu, cStruct, rcMv, ruiCost);
+#endif
+  }
   else if( bQTBTMV2 )
   {
     rcMv = cIntMv;
@@ -5166,9 +5226,105 @@ void InterSearch::xMotionEstimation(PredictionUnit &pu, PelUnitBuf &origBuf, Ref
     xPatternSearchIntRefine( pu, cStruct, rcMv, rcMvPred, riMVPIdx, ruiBits, ruiCost, amvpInfo, fWeight);
 #endif
   }
+  if( cStruct.motionModel == CLASSIC && !bBi && pu.cs->sps->getUseGED() && m_pcEncCfg->getUseGEDSeedSearch() )
+  {
+    xStoreClassicMv( pu, eRefPicList, refIdxPred, rcMv );
+  }
   DTRACE(g_trace_ctx, D_ME, "   MECost<L%d,%d>: %6d (%d)  MV:%d,%d\n", (int)eRefPicList, (int)bBi, ruiCost, ruiBits, rcMv.getHor() << 2, rcMv.getVer() << 2);
 }
 
+void InterSearch::xStoreClassicMv( const PredictionUnit& pu, RefPicList eRefPicList, int refIdx, const Mv& mv )
+{
+  BlkClassicMvInfo& info = m_classicMvInfo;
+  const CompArea&   blk  = pu.Y();
+  if( info.x != blk.x || info.y != blk.y || info.w != blk.width || info.h != blk.height || info.imv != pu.cu->imv )
+  {
+    info.x   = blk.x;
+    info.y   = blk.y;
+    info.w   = blk.width;
+    info.h   = blk.height;
+    info.imv = pu.cu->imv;
+    ::memset( info.valid, 0, sizeof( info.valid ) );
+  }
+  info.mvs  [eRefPicList][refIdx] = mv;
+  info.valid[eRefPicList][refIdx] = true;
+}
+
+bool InterSearch::xGetGeodesicSeedMv( const PredictionUnit& pu, RefPicList eRefPicList, int refIdx, Mv& rcMv )
+{
+  const BlkClassicMvInfo& info = m_classicMvInfo;
+  const CompArea&         blk  = pu.Y();
+  if( pu.motionModel[eRefPicList] != GEODESIC || !m_pcEncCfg->getUseGEDSeedSearch()
+   || info.x != blk.x || info.y != blk.y || info.w != blk.width || info.h != blk.height || info.imv != pu.cu->imv
+   || !info.valid[eRefPicList][refIdx] )
+  {
+    return false;
+  }
+
+  // Equivalent GEODESIC mv that moves the block center like the CLASSIC mv
+  const int      curPOC = pu.cu->slice->getPOC();
+  const int      refPOC = pu.cu->slice->getRefPOC( eRefPicList, refIdx );
+  const Position center = blk.pos().offset( blk.width >> 1, blk.height >> 1 );
+  rcMv = m_mvReprojection->motionVectorInDesiredMotionModel( center, info.mvs[eRefPicList][refIdx], CLASSIC, GEODESIC,
+                                                             MV_FRACTIONAL_BITS_INTERNAL, MV_FRACTIONAL_BITS_INTERNAL,
+                                                             curPOC, refPOC, curPOC, refPOC, blk.pos(), blk.size(), blk.pos(), blk.size() );
+  return true;
+}
+
+bool InterSearch::xGetTemporalFilterSeedMv( const PredictionUnit& pu, RefPicList eRefPicList, int refIdx,
+                                            MotionModelID motionModel, Mv& rcMv ) const
+{
+  if( !m_pcEncCfg->getGopBasedTemporalFilterMotionSeeds() || ( motionModel != CLASSIC && motionModel != GEODESIC ) )
+  {
+    return false;
+  }
+
+  const CompArea& blk    = pu.Y();
+  const int       curPOC = pu.cu->slice->getPOC();
+  const int       refPOC = pu.cu->slice->getRefPOC( eRefPicList, refIdx );
+  Mv              mv;
+  if( !m_pcEncCfg->getMotionSeeds()->getMv( curPOC, refPOC, blk, pu.cs->picture->lumaSize(), mv ) )
+  {
+    return false;
+  }
+
+  rcMv = mv;
+  if( motionModel == GEODESIC )
+  {
+    // Equivalent GEODESIC mv that moves the block center like the CLASSIC mv of the field
+    const Position center = blk.pos().offset( blk.width >> 1, blk.height >> 1 );
+    rcMv = m_mvReprojection->motionVectorInDesiredMotionModel( center, mv, CLASSIC, GEODESIC,
+                                                               MV_FRACTIONAL_BITS_INTERNAL, MV_FRACTIONAL_BITS_INTERNAL,
+                                                               curPOC, refPOC, curPOC, refPOC, blk.pos(), blk.size(), blk.pos(), blk.size() );
+  }
+  return true;
+}
+
+void InterSearch::xTestTemporalFilterSeed( const PredictionUnit& pu, RefPicList eRefPicList, int refIdxPred,
+                                           IntTZSearchStruct& cStruct )
+{
+  Mv seedMv;
+  if( !xGetTemporalFilterSeedMv( pu, eRefPicList, refIdxPred, cStruct.motionModel, seedMv ) )
+  {
+    return;
+  }
+
+  if( m_pcEncCfg->getMCTSEncConstraint() )
+  {
+    MCTSHelper::clipMvToArea( seedMv, pu.Y(), pu.cs->picture->mctsInfo.getTileArea(), *pu.cs->sps );
+  }
+  else
+  {
+    clipMv( seedMv, pu.cu->lumaPos(), pu.cu->lumaSize(), *pu.cs->sps, *pu.cs->pps, cStruct.motionModel );
+  }
+  seedMv.changePrecision( MV_PRECISION_INTERNAL, MV_PRECISION_INT );
+  if( seedMv.getHor() != cStruct.iBestX || seedMv.getVer() != cStruct.iBestY )
+  {
+    // the search range is centered on the best start point, so that the seed extends it
+    xTZSearchHelp( cStruct, seedMv.getHor(), seedMv.getVer(), 0, 0 );
+  }
+}
+
 void InterSearch::xSetSearchRange(const PredictionUnit &pu, const Mv &cMvPred, const int iSrchRng, SearchRange &sr,
                                   IntTZSearchStruct &cStruct
 #if GDR_ENABLED
@@ -5505,6 +5661,8 @@ void InterSearch::xTZSearch(const PredictionUnit &pu, RefPicList eRefPicList, in
 #endif
   }
 
+  xTestTemporalFilterSeed( pu, eRefPicList, refIdxPred, cStruct );
+
   {
     // set search range
     Mv currBestMv(cStruct.iBestX, cStruct.iBestY );
@@ -5721,6 +5879,41 @@ void InterSearch::xTZSearch(const PredictionUnit &pu, RefPicList eRefPicList, in
   ruiSAD = cStruct.uiBestSad - m_pcRdCost->getCostOfVectorWithPredictor( cStruct.iBestX, cStruct.iBestY, cStruct.imvShift );
 }
 
+void InterSearch::xSeededSearch(const PredictionUnit &pu, IntTZSearchStruct &cStruct, Mv &rcMv, Distortion &ruiSAD
+#if GDR_ENABLED
+                                ,
+                                RefPicList eRefPicList, int refIdxPred
+#endif
+)
+{
+  clipMv( rcMv, pu.cu->lumaPos(), pu.cu->lumaSize(), *pu.cs->sps, *pu.cs->pps, cStruct.motionModel);
+#if GDR_ENABLED
+  xSetSearchRange(pu, rcMv, GED_SEED_SEARCH_RANGE, cStruct.searchRange, cStruct, eRefPicList, refIdxPred);
+#else
+  xSetSearchRange(pu, rcMv, GED_SEED_SEARCH_RANGE, cStruct.searchRange, cStruct);
+#endif
+  rcMv.changePrecision(MV_PRECISION_INTERNAL, MV_PRECISION_QUARTER);
+  rcMv.divideByPowerOf2(2);
+
+  cStruct.uiBestSad = std::numeric_limits<Distortion>::max();
+  m_cDistParam.maximumDistortionForEarlyExit = cStruct.uiBestSad;
+  prepareRdCostDistParamVA(cStruct, COMPONENT_Y, cStruct.subShiftMode);
+  xTZSearchHelp( cStruct, rcMv.getHor(), rcMv.getVer(), 0, 0 );
+
+  // Unit step descent inside the window until the center is the best point
+  int iStartX, iStartY;
+  do
+  {
+    iStartX = cStruct.iBestX;
+    iStartY = cStruct.iBestY;
+    xTZ8PointSquareSearch( cStruct, iStartX, iStartY, 1 );
+  } while( cStruct.iBestX != iStartX || cStruct.iBestY != iStartY );
+
+  // write out best match
+  rcMv.set( cStruct.iBestX, cStruct.iBestY );
+  ruiSAD = cStruct.uiBestSad - m_pcRdCost->getCostOfVectorWithPredictor( cStruct.iBestX, cStruct.iBestY, cStruct.imvShift );
+}
+
 void InterSearch::xTZSearchSelective(const PredictionUnit &pu, RefPicList eRefPicList, int refIdxPred,
                                      IntTZSearchStruct &cStruct, Mv &rcMv, Distortion &ruiSAD,
                                      const Mv *const pIntegerMv2Nx2NPred)
@@ -5809,6 +6002,8 @@ void InterSearch::xTZSearchSelective(const PredictionUnit &pu, RefPicList eRefPi
     }
   }
 
+  xTestTemporalFilterSeed( pu, eRefPicList, refIdxPred, cStruct );
+
   {
     // set search range
     Mv currBestMv(cStruct.iBestX, cStruct.iBestY );
@@ -6274,6 +6469,43 @@ inline void InterSearch::xApplyMvVA(const IntTZSearchStruct &rcStruct, const Mv
   }
 }
 
+Distortion InterSearch::xGetSampledDistortionGED(const IntTZSearchStruct &rcStruct, const Mv &rMv)
+{
+  const int numRows = rcStruct.blkSize.height >> 2;
+  const int numCols = rcStruct.blkSize.width >> 2;
+  const Position subblocks[GED_FAST_SEARCH_NUM_SAMPLES] = { Position(0, 0), Position(numCols - 1, 0), Position(0, numRows - 1),
+                                                            Position(numCols - 1, numRows - 1), Position(numCols >> 1, numRows >> 1) };
+  int xFixed[GED_FAST_SEARCH_NUM_SAMPLES], yFixed[GED_FAST_SEARCH_NUM_SAMPLES];
+  Mv mv(rMv);
+  mv.changePrecision(MV_PRECISION_INT, MV_PRECISION_INTERNAL);
+  m_mvReprojection->reprojectSubblockSamples(rcStruct.blkPos, rcStruct.blkSize, mv, rcStruct.motionModel, rcStruct.curPOC, rcStruct.refPOC,
+                                             GED_FAST_SEARCH_NUM_SAMPLES, subblocks, xFixed, yFixed);
+
+  const CPelBuf &refBuf = *rcStruct.pcRefBuf;
+  const CPelBuf &orgBuf = *rcStruct.pcPatternKey;
+  Distortion sad = 0;
+  for (int i = 0; i < GED_FAST_SEARCH_NUM_SAMPLES; i++)
+  {
+    const int xPos = (xFixed[i] + (1 << (MV_FRACTIONAL_BITS_INTERNAL - 1))) >> MV_FRACTIONAL_BITS_INTERNAL;
+    const int yPos = (yFixed[i] + (1 << (MV_FRACTIONAL_BITS_INTERNAL - 1))) >> MV_FRACTIONAL_BITS_INTERNAL;
+    // Subblocks outside of the reference picture are predicted with zeros, see xMVReprojectionInterpolation
+    const bool isOutside = xPos < 0 || yPos < 0 || xPos >= refBuf.width - 4 || yPos >= refBuf.height - 4;
+    const Pel *org = orgBuf.buf + 4 * subblocks[i].y * orgBuf.stride + 4 * subblocks[i].x;
+    const Pel *ref = isOutside ? nullptr : refBuf.buf + yPos * refBuf.stride + xPos;
+    for (int y = 0; y < 4; y++)
+    {
+      for (int x = 0; x < 4; x++)
+      {
+        sad += abs(org[x] - (isOutside ? 0 : ref[x]));
+      }
+      org += orgBuf.stride;
+      ref = isOutside ? nullptr : ref + refBuf.stride;
+    }
+  }
+  sad >>= DISTORTION_PRECISION_ADJUSTMENT(m_cDistParam.bitDepth);
+  return sad * numRows * numCols / GED_FAST_SEARCH_NUM_SAMPLES;
+}
+
 void InterSearch::xMVReprojectionInterpolation(const Position &cuPosition,
                                                const Size &cuSize,
                                                const CPelBuf &refBuf,
@@ -6297,8 +6529,8 @@ void InterSearch::xMVReprojectionInterpolation(const Position &cuPosition,
   auto start_mvReprojTime = std::chrono::high_resolution_clock::now();
 #endif
   ChromaFormat tmpChFmt = CHROMA_400; // Dummy chroma format for MVReprojection -> Only luma is of interest.
-  ArrayXXFixedPtrPair cart2DProjMovedFixed4x4 = m_mvReprojection->reprojectMotionVectorSubblocks(
-    cuPosition, cuSize, mv, motionModel, COMPONENT_Y, tmpChFmt, curPOC, refPOC);
+  const ArrayXXFixedConstMapPair cart2DProjMovedFixed4x4 = m_mvReprojection->reprojectMotionVectorSubblocks(
+    cuPosition, cuSize, mv, motionModel, COMPONENT_Y, tmpChFmt, curPOC, refPOC, m_reprojectionArena);
 #if INTERPRED_PROFILING
   auto end_mvReprojTime = std::chrono::high_resolution_clock::now();
   dbg_mvReprojTime += std::chrono::duration<double>(end_mvReprojTime - start_mvReprojTime).count();
@@ -6307,12 +6539,9 @@ void InterSearch::xMVReprojectionInterpolation(const Position &cuPosition,
 #if INTERPRED_PROFILING
   auto start_fracCalcTime = std::chrono::high_resolution_clock::now();
 #endif
-  ArrayXXFixed xPos, yPos;  // Integer pixel coordinates
-  ArrayXXFixed xFrac, yFrac; // Fractional pixel coordinates
-  xPos = std::get<0>(cart2DProjMovedFixed4x4)->unaryExpr([](int val){ return val >> MV_FRACTIONAL_BITS_INTERNAL; });
-  yPos = std::get<1>(cart2DProjMovedFixed4x4)->unaryExpr([](int val){ return val >> MV_FRACTIONAL_BITS_INTERNAL; });
-  xFrac = std::get<0>(cart2DProjMovedFixed4x4)->unaryExpr([](int val){ return val & ((1 << MV_FRACTIONAL_BITS_INTERNAL) - 1); });
-  yFrac = std::get<1>(cart2DProjMovedFixed4x4)->unaryExpr([](int val){ return val & ((1 << MV_FRACTIONAL_BITS_INTERNAL) - 1); });
+  // Integer and fractional pixel coordinates are split per 4x4 block below.
+  const ArrayXXFixedConstMap &xFixed = std::get<0>(cart2DProjMovedFixed4x4);
+  const ArrayXXFixedConstMap &yFixed = std::get<1>(cart2DProjMovedFixed4x4);
 #if INTERPRED_PROFILING
   auto end_fracCalcTime = std::chrono::high_resolution_clock::now();
   dbg_fracCalcTime += std::chrono::duration<double>(end_fracCalcTime - start_fracCalcTime).count();
@@ -6327,53 +6556,39 @@ void InterSearch::xMVReprojectionInterpolation(const Position &cuPosition,
   auto start_interpolTime = std::chrono::high_resolution_clock::now();
 #endif
   int maxCUWidth = 0; // int(m_pcEncCfg->getMaxCUWidth());
-  for (int col = 0; col < cuSize.width / 4; ++col) {
-    for (int row = 0; row < cuSize.height / 4; ++row) {
-      if (xPos(row, col) < -maxCUWidth or yPos(row, col) < -maxCUWidth or xPos(row, col) >= refBuf.width + maxCUWidth - 4 or yPos(row, col) >= refBuf.height + maxCUWidth - 4)
+  const int numRows = cuSize.height / 4;
+  const int numCols = cuSize.width / 4;
+  int xPos[MAX_CU_SIZE / MIN_PU_SIZE], yPos[MAX_CU_SIZE / MIN_PU_SIZE];
+  int xFrac[MAX_CU_SIZE / MIN_PU_SIZE], yFrac[MAX_CU_SIZE / MIN_PU_SIZE];
+  const auto isOutside = [&](int col) {
+    return xPos[col] < -maxCUWidth or yPos[col] < -maxCUWidth or xPos[col] >= refBuf.width + maxCUWidth - 4 or yPos[col] >= refBuf.height + maxCUWidth - 4;
+  };
+  for (int row = 0; row < numRows; ++row) {
+    Pel *dstRow = dstBuf.buf + row * 4 * dstBuf.stride;
+    for (int col = 0; col < numCols; ++col) {
+      xPos[col]  = xFixed(row, col) >> MV_FRACTIONAL_BITS_INTERNAL;               // Integer pixel coordinates
+      yPos[col]  = yFixed(row, col) >> MV_FRACTIONAL_BITS_INTERNAL;
+      xFrac[col] = xFixed(row, col) & ((1 << MV_FRACTIONAL_BITS_INTERNAL) - 1);  // Fractional pixel coordinates
+      yFrac[col] = yFixed(row, col) & ((1 << MV_FRACTIONAL_BITS_INTERNAL) - 1);
+    }
+
+    // Interpolate the row of 4x4 blocks in segments between blocks outside of the reference picture
+    int col = 0;
+    while (col < numCols) {
+      if (isOutside(col))
       {
         dstBuf.subBuf(col * 4, row * 4, 4, 4).memset(0);
+        col++;
         continue;
       }
-
-      if (yFrac(row, col) == 0)
-      {
-        m_if.filterHor(COMPONENT_Y,
-                       (Pel *) refBuf.buf + yPos(row, col) * refBuf.stride + xPos(row, col),
-                       refBuf.stride,
-                       dstBuf.buf + row * 4 * dstBuf.stride + col * 4,
-                       dstBuf.stride,
-                       4, 4, xFrac(row, col), rndRes, clpRng, filterIdx, useAltHpelIf);
-      }
-      else if (xFrac(row, col) == 0)
-      {
-        m_if.filterVer(COMPONENT_Y,
-                       (Pel *) refBuf.buf + yPos(row, col) * refBuf.stride + xPos(row, col),
-                       refBuf.stride,
-                       dstBuf.buf + row * 4 * dstBuf.stride + col * 4,
-                       dstBuf.stride,
-                       4, 4, yFrac(row, col), true, rndRes, clpRng, filterIdx, useAltHpelIf);
-      }
-      else
+      int segmentEnd = col + 1;
+      while (segmentEnd < numCols && !isOutside(segmentEnd))
       {
-        PelBuf tmpBuf = PelBuf(m_filteredBlockTmp[0][COMPONENT_Y], Size(4, 4));
-
-        int vFilterSize = NTAPS_LUMA;
-        if (biMCForDMVR)
-        {
-          vFilterSize = NTAPS_BILINEAR;
-        }
-        m_if.filterHor(COMPONENT_Y, (Pel *) refBuf.buf + yPos(row, col) * refBuf.stride + xPos(row, col) - ((vFilterSize >> 1) - 1) * refBuf.stride,
-                       refBuf.stride,
-                       tmpBuf.buf,
-                       tmpBuf.stride,
-                       4, 4 + vFilterSize - 1, xFrac(row, col), false, clpRng, filterIdx, useAltHpelIf);
-        m_if.filterVer(COMPONENT_Y,
-                       (Pel *) tmpBuf.buf + ((vFilterSize >> 1) - 1) * tmpBuf.stride,
-                       tmpBuf.stride,
-                       dstBuf.buf + row * 4 * dstBuf.stride + col * 4,
-                       dstBuf.stride,
-                       4, 4, yFrac(row, col), false, rndRes, clpRng, filterIdx, useAltHpelIf);
+        segmentEnd++;
       }
+      m_if.filterSubblocks(COMPONENT_Y, refBuf.buf, refBuf.stride, dstRow + col * 4, dstBuf.stride, Size(4, 4),
+                           segmentEnd - col, xPos + col, yPos + col, xFrac + col, yFrac + col, rndRes, clpRng, filterIdx, useAltHpelIf);
+      col = segmentEnd;
     }
   }
 #if INTERPRED_PROFILING
@@ -54,6 +54,7 @@
 #include "CommonLib/Hash.h"
 #include <unordered_map>
 #include <vector>
+#include <memory>
 #include "EncReshape.h"
 //! \ingroup EncoderLib
 //! \{
@@ -89,6 +90,14 @@ struct BlkUniMvInfo
   int x, y, w, h;
 };
 
+/// CLASSIC uni-prediction motion of the block last searched, seeds the GEODESIC search of the same block (GEDSeedSearch)
+struct BlkClassicMvInfo
+{
+  Mv   mvs[2][33];
+  bool valid[2][33];
+  int  x, y, w, h, imv;
+};
+
 typedef struct
 {
   Mv acMvAffine4Para[2][3];
@@ -139,6 +148,14 @@ private:
   int             m_uniMvListIdx;
   int             m_uniMvListSize;
   int             m_uniMvListMaxSize;
+  /// Uni-prediction MVs of the last search at each CTU-relative area, reused when the area is tested again
+  struct ReusedUniMvs
+  {
+    Mv   mvs[32][32][8][8][2][33];
+    bool filled[32][32][8][8];
+  };
+  std::unique_ptr<ReusedUniMvs> m_reusedUniMvs;
+  BlkClassicMvInfo m_classicMvInfo;
   Distortion      m_hevcCost;
 #if GDR_ENABLED
   bool            m_hevcCostOk;
@@ -280,6 +297,10 @@ public:
     }
   }
   void resetUniMvList() { m_uniMvListIdx = 0; m_uniMvListSize = 0; }
+  void resetReusedUniMvs() { ::memset(m_reusedUniMvs->filled, 0, sizeof(m_reusedUniMvs->filled)); }
+  void resetClassicMvInfo() { m_classicMvInfo = BlkClassicMvInfo(); }
+  /// insert the reused uni-prediction MVs of the area into the uni MV list, if any were stored
+  void insertReusedUniMvCands(const CompArea &blkArea, const PreCalcValues &pcv);
   void insertUniMvCands(CompArea blkArea, Mv cMvTemp[2][33])
   {
     BlkUniMvInfo* curMvInfo = m_uniMvList + m_uniMvListIdx;
@@ -421,6 +442,12 @@ public:
     CHECK(dir >= MAX_NUM_REF_LIST_ADAPT_SR || refIdx >= int(MAX_IDX_ADAPT_SR), "Invalid index");
     m_adaptSR[dir][refIdx] = searchRange;
   }
+  /// take over the slice level settings (adaptive search ranges, sub-picture mv clipping) of another instance
+  void copySliceSettings(const InterSearch &other)
+  {
+    ::memcpy(m_adaptSR, other.m_adaptSR, sizeof(m_adaptSR));
+    m_clipMvInSubPic = other.m_clipMvInSubPic;
+  }
   bool  predIBCSearch           ( CodingUnit& cu, Partitioner& partitioner, const int localSearchRangeX, const int localSearchRangeY, IbcHashMap& ibcHashMap);
   void  xIntraPatternSearch         ( PredictionUnit& pu, IntTZSearchStruct&  cStruct, Mv& rcMv, Distortion&  ruiCost, Mv* cMvSrchRngLT, Mv* cMvSrchRngRB, Mv* pcMvPred);
   void  xSetIntraSearchRange        ( PredictionUnit& pu, int iRoiWidth, int iRoiHeight, const int localSearchRangeX, const int localSearchRangeY, Mv& rcMvSrchRngLT, Mv& rcMvSrchRngRB);
@@ -490,6 +517,22 @@ protected:
                          Mv &rcMv, int &riMVPIdx, uint32_t &ruiBits, Distortion &ruiCost, const AMVPInfo &amvpInfo,
                          bool bBi = false);
 #endif
+  /// Remember the CLASSIC uni-prediction mv of the current block for the GEODESIC search (GEDSeedSearch)
+  void xStoreClassicMv           ( const PredictionUnit& pu, RefPicList eRefPicList, int refIdx, const Mv& mv );
+  /// Equivalent GEODESIC mv of the stored CLASSIC mv of the current block, false if there is none
+  bool xGetGeodesicSeedMv        ( const PredictionUnit& pu, RefPicList eRefPicList, int refIdx, Mv& rcMv );
+  /// Start candidate of the integer search from the temporal filter motion of the picture, in the motion model of the
+  /// search; false if there is none (TemporalFilterMotionSeeds)
+  bool xGetTemporalFilterSeedMv  ( const PredictionUnit& pu, RefPicList eRefPicList, int refIdx, MotionModelID motionModel, Mv& rcMv ) const;
+  /// Test the temporal filter seed as start point of the TZ searches
+  void xTestTemporalFilterSeed   ( const PredictionUnit& pu, RefPicList eRefPicList, int refIdxPred, IntTZSearchStruct& cStruct );
+  /// Integer search in a GED_SEED_SEARCH_RANGE window around the seed rcMv by unit step descent
+  void xSeededSearch(const PredictionUnit &pu, IntTZSearchStruct &cStruct, Mv &rcMv, Distortion &ruiSAD
+#if GDR_ENABLED
+                     ,
+                     RefPicList eRefPicList, int refIdxPred
+#endif
+  );
   void xTZSearch(const PredictionUnit &pu, RefPicList eRefPicList, int refIdxPred, IntTZSearchStruct &cStruct, Mv &rcMv,
                  Distortion &ruiSAD, const Mv *const pIntegerMv2Nx2NPred, const bool bExtendedSettings,
                  const bool bFastSettings = false);
@@ -552,6 +595,8 @@ protected:
                                 bool useHadamard = false);
 
   inline void xApplyMvVA(const IntTZSearchStruct &rcStruct, const Mv &rMv, MvPrecision mvPrec);
+  /// estimate of the GED distortion of an integer mv from the nearest integer samples of the corner and center subblocks
+  Distortion xGetSampledDistortionGED(const IntTZSearchStruct &rcStruct, const Mv &rMv);
 
   void xMVReprojectionInterpolation ( const Position&  cuPosition,
                                       const Size&      cuSize,
@@ -1122,6 +1122,8 @@ void HLSWriter::codeSPS( const SPS* pcSPS )
   if(pcSPS->getUseMultiModel()) {
     if(pcSPS->getUseGED()) {
       WRITE_UVLC(pcSPS->getGEDFlavor(), "sps_ged_flavor");
+      WRITE_FLAG(pcSPS->getUseGEDFixedPoint(), "sps_ged_fixed_point_flag");
+      WRITE_FLAG(pcSPS->getUseGEDDMVRWindow(), "sps_ged_dmvr_window_flag");
     }
     WRITE_FLAG(pcSPS->getUseMMMVP(), "sps_mmmvp_enabled_flag");
     WRITE_UVLC(pcSPS->getMMOffset4x4(), "sps_mm_offset_4x4");
@@ -37,6 +37,7 @@
 
 #include <math.h>
 #include "../CommonLib/ChromaFormat.h"
+#include "../CommonLib/ThreadPool.h"
 #include "TGeometry.h"
 #include "TEquiRect.h"
 #if SVIDEO_ADJUSTED_EQUALAREA
@@ -97,6 +98,20 @@ template<typename T> static inline Int filter1D(T *pSrc, Int iStride, Filter1DIn
   return ret;
 }
 
+// 2D filter with the number of taps fixed at compile time, so that the tap loops are unrolled and vectorized;
+template<Int iTaps> static Int filterSample(const Pel *pSrc, Int iStride, const Int *pWLut)
+{
+  Int sum = 0;
+  for (Int m = 0; m < iTaps; m++)
+  {
+    for (Int n = 0; n < iTaps; n++)
+      sum += pSrc[n] * pWLut[n];
+    pSrc += iStride;
+    pWLut += iTaps;
+  }
+  return sum;
+}
+
 TChar TGeometry::m_strGeoName[SVIDEO_TYPE_NUM][256] = { { "Equirectangular" },
                                                         { "Cubemap" },
 #if SVIDEO_ADJUSTED_EQUALAREA
@@ -199,7 +214,9 @@ TGeometry::TGeometry()
 
   memset(m_pWeightLut, 0, sizeof(m_pWeightLut));
   memset(m_iInterpFilterTaps, 0, sizeof(m_iInterpFilterTaps));
+  m_filterSample[0] = m_filterSample[1] = nullptr;
   m_bConvOutputPaddingNeeded = false;
+  m_pThreadPool              = nullptr;
 }
 
 Void TGeometry::geoInit(SVideoInfo &sVideoInfo, InputGeoParam *pInGeoParam)
@@ -1116,8 +1133,24 @@ Void TGeometry::geoConvert(TGeometry *pGeoDst
           ? 0
           : (ch > 0 ? 1 : 0);
       ChannelType chType = toChannelType(chId);
+      Int         iWLutIdx =
+        (m_chromaFormatIDC == CHROMA_400 || (m_InterpolationType[0] == m_InterpolationType[1])) ? 0 : chType;
+      Int iStrideSrc = getStride(chId);
+      Int iTLOffset =
+        ((m_iInterpFilterTaps[chType][1] - 1) >> 1) * iStrideSrc + ((m_iInterpFilterTaps[chType][0] - 1) >> 1);
+      filterSampleFP filterSample = m_filterSample[chType];
+#if SVIDEO_FISHEYE
+      Bool   bCircular = pGeoDst->m_sVideoInfo.geoType == SVIDEO_FISHEYE_CIRCULAR;
+      Double cnt_x     = pGeoDst->m_sVideoInfo.sFisheyeInfo.fCircularRegionCentre_x;
+      Double cnt_y     = pGeoDst->m_sVideoInfo.sFisheyeInfo.fCircularRegionCentre_y;
+      Double dRadius   = (Double)(pGeoDst->m_sVideoInfo.sFisheyeInfo.fCircularRegionRadius) - 0.5;
+#endif
+
+      // the rows of the face only read the padded source faces, so they are filtered independently;
+      ThreadPool::parallelFor(m_pThreadPool, -nMarginY, nHeight + nMarginY, [&](Int j) {
+        const PxlFltLut *pPelWeightLine = pGeoDst->m_pPixelWeight[fIdx][mapIdx] + (j + nMarginY) * iWidthPW + nMarginX;
+        Pel             *pDstLine       = pGeoDst->m_pFacesOrig[fIdx][ch] + j * pGeoDst->getStride(chId);
 
-      for (Int j = -nMarginY; j < nHeight + nMarginY; j++)
         for (Int i = -nMarginX; i < nWidth + nMarginX; i++)
         {
           if (!pGeoDst->m_bConvOutputPaddingNeeded
@@ -1125,57 +1158,32 @@ Void TGeometry::geoConvert(TGeometry *pGeoDst
                                       (j << pGeoDst->getComponentScaleY(chId)), COMPONENT_Y, chId))
             continue;
 
-          Int x   = i + nMarginX;
-          Int y   = j + nMarginY;
-          Int sum = 0;
-
 #if SVIDEO_FISHEYE
+          if (bCircular)
           {
-            Int    xx    = i << pGeoDst->getComponentScaleX(chId);
-            Int    yy    = j << pGeoDst->getComponentScaleY(chId);
-            Double cnt_x = pGeoDst->m_sVideoInfo.sFisheyeInfo.fCircularRegionCentre_x;
-            Double cnt_y = pGeoDst->m_sVideoInfo.sFisheyeInfo.fCircularRegionCentre_y;
-            Double dist  = ssqrt((xx + 0.5 - cnt_x) * (xx + 0.5 - cnt_x) + (yy + 0.5 - cnt_y) * (yy + 0.5 - cnt_y));
-
-            if (pGeoDst->m_sVideoInfo.geoType != SVIDEO_FISHEYE_CIRCULAR
-                || (/*pGeoDst->m_sVideoInfo.geoType == SVIDEO_FISHEYE_CIRCULAR &&*/ dist
-                    < (Double)(pGeoDst->m_sVideoInfo.sFisheyeInfo.fCircularRegionRadius) - 0.5))
+            Int    xx   = i << pGeoDst->getComponentScaleX(chId);
+            Int    yy   = j << pGeoDst->getComponentScaleY(chId);
+            Double dist = ssqrt((xx + 0.5 - cnt_x) * (xx + 0.5 - cnt_x) + (yy + 0.5 - cnt_y) * (yy + 0.5 - cnt_y));
+            if (!(dist < dRadius))
             {
+              pDstLine[i] = 1 << (m_nBitDepth - 1);
+              continue;
+            }
+          }
 #endif
 
-              PxlFltLut *pPelWeight = pGeoDst->m_pPixelWeight[fIdx][mapIdx] + y * iWidthPW + x;
-              Int        face       = (pPelWeight->facePos) & iWeightMapFaceMask;
-              Int        iTLPos     = (pPelWeight->facePos) >> m_WeightMap_NumOfBits4Faces;
-              Int        iWLutIdx =
-                (m_chromaFormatIDC == CHROMA_400 || (m_InterpolationType[0] == m_InterpolationType[1])) ? 0 : chType;
-              Int *pWLut    = m_pWeightLut[iWLutIdx][pPelWeight->weightIdx];
-              Pel *pPelLine = m_pFacesOrig[face][ch] + iTLPos
-                              - ((m_iInterpFilterTaps[chType][1] - 1) >> 1) * getStride(chId)
-                              - ((m_iInterpFilterTaps[chType][0] - 1) >> 1);
-              for (Int m = 0; m < m_iInterpFilterTaps[chType][1]; m++)
-              {
-                for (Int n = 0; n < m_iInterpFilterTaps[chType][0]; n++)
-                  sum += pPelLine[n] * pWLut[n];
-                pPelLine += getStride(chId);
-                pWLut += m_iInterpFilterTaps[chType][0];
-              }
-
-              Int iPos = j * pGeoDst->getStride(chId) + i;
+          const PxlFltLut &wList  = pPelWeightLine[i];
+          Int              face   = (wList.facePos) & iWeightMapFaceMask;
+          Int              iTLPos = (wList.facePos) >> m_WeightMap_NumOfBits4Faces;
+          Int              sum    = filterSample(m_pFacesOrig[face][ch] + iTLPos - iTLOffset, iStrideSrc,
+                                                 m_pWeightLut[iWLutIdx][wList.weightIdx]);
 #if SVIDEO_GEOCONVERT_CLIP
-              pGeoDst->m_pFacesOrig[fIdx][ch][iPos] = ClipBD((sum + iOffset) >> iBDPrecision, m_nBitDepth);
+          pDstLine[i] = ClipBD((sum + iOffset) >> iBDPrecision, m_nBitDepth);
 #else
-          pGeoDst->m_pFacesOrig[fIdx][ch][iPos] = (sum + iOffset) >> iBDPrecision;
-#endif
-#if SVIDEO_FISHEYE
-            }
-            else if (pGeoDst->m_sVideoInfo.geoType == SVIDEO_FISHEYE_CIRCULAR)
-            {
-              Int iPos                              = j * pGeoDst->getStride(chId) + i;
-              pGeoDst->m_pFacesOrig[fIdx][ch][iPos] = 1 << (m_nBitDepth - 1);
-            }
-          }
+          pDstLine[i] = (sum + iOffset) >> iBDPrecision;
 #endif
         }
+      });
     }
   }
 
@@ -1470,9 +1478,15 @@ Void TGeometry::spherePadding(Bool bEnforced)
                      ? 0
                      : (ch > 0 ? 1 : 0);
       ChannelType chType = toChannelType(chId);
-
-      for (Int j = -nMarginY; j < nHeight + nMarginY; j++)
-      {
+      Int         iWLutIdx =
+        (m_chromaFormatIDC == CHROMA_400 || (m_InterpolationType[0] == m_InterpolationType[1])) ? 0 : chType;
+      Int iStride = getStride(chId);
+      Int iTLOffset =
+        ((m_iInterpFilterTaps[chType][1] - 1) >> 1) * iStride + ((m_iInterpFilterTaps[chType][0] - 1) >> 1);
+      filterSampleFP filterSample = m_filterSample[chType];
+
+      // the padding of a face is interpolated from the other faces, so its rows are filtered independently;
+      ThreadPool::parallelFor(m_pThreadPool, -nMarginY, nHeight + nMarginY, [&](Int j) {
         for (Int i = -nMarginX; i < nWidth + nMarginX; i++)
         {
 #if SVIDEO_HEMI_PROJECTIONS
@@ -1491,28 +1505,16 @@ Void TGeometry::spherePadding(Bool bEnforced)
 
           Int iLutIdx;
           getSPLutIdx(ch, i, j, iLutIdx);
-          Int sum = 0;
-
-          PxlFltLut *pPelWeight = m_pPixelWeight4SherePadding[fIdx][mapIdx] + iLutIdx;
-          Int        face       = (pPelWeight->facePos) & iWeightMapFaceMask;
-          Int        iTLPos     = (pPelWeight->facePos) >> m_WeightMap_NumOfBits4Faces;
-          Int        iWLutIdx =
-            (m_chromaFormatIDC == CHROMA_400 || (m_InterpolationType[0] == m_InterpolationType[1])) ? 0 : chType;
-          Int *pWLut    = m_pWeightLut[iWLutIdx][pPelWeight->weightIdx];
-          Pel *pPelLine = m_pFacesOrig[face][ch] + iTLPos
-                          - ((m_iInterpFilterTaps[chType][1] - 1) >> 1) * getStride(chId)
-                          - ((m_iInterpFilterTaps[chType][0] - 1) >> 1);
-          for (Int m = 0; m < m_iInterpFilterTaps[chType][1]; m++)
-          {
-            for (Int n = 0; n < m_iInterpFilterTaps[chType][0]; n++)
-              sum += pPelLine[n] * pWLut[n];
-            pPelLine += getStride(chId);
-            pWLut += m_iInterpFilterTaps[chType][0];
-          }
 
-          m_pFacesOrig[fIdx][ch][j * getStride(chId) + i] = ClipBD((sum + iOffset) >> iBDPrecision, m_nBitDepth);
+          const PxlFltLut &wList  = m_pPixelWeight4SherePadding[fIdx][mapIdx][iLutIdx];
+          Int              face   = (wList.facePos) & iWeightMapFaceMask;
+          Int              iTLPos = (wList.facePos) >> m_WeightMap_NumOfBits4Faces;
+          Int              sum    = filterSample(m_pFacesOrig[face][ch] + iTLPos - iTLOffset, iStride,
+                                                 m_pWeightLut[iWLutIdx][wList.weightIdx]);
+
+          m_pFacesOrig[fIdx][ch][j * iStride + i] = ClipBD((sum + iOffset) >> iBDPrecision, m_nBitDepth);
         }
-      }
+      });
     }
   }
   m_bPadded = true;
@@ -2307,14 +2309,17 @@ Void TGeometry::initInterpolation(Int *pInterpolateType)
     case SI_NN:
       m_interpolateWeight[ch]    = &TGeometry::interpolate_nn_weight;
       m_iInterpFilterTaps[ch][0] = m_iInterpFilterTaps[ch][1] = 1;
+      m_filterSample[ch]         = filterSample<1>;
       break;
     case SI_BILINEAR:
       m_interpolateWeight[ch]    = &TGeometry::interpolate_bilinear_weight;
       m_iInterpFilterTaps[ch][0] = m_iInterpFilterTaps[ch][1] = 2;
+      m_filterSample[ch]         = filterSample<2>;
       break;
     case SI_BICUBIC:
       m_interpolateWeight[ch]    = &TGeometry::interpolate_bicubic_weight;
       m_iInterpFilterTaps[ch][0] = m_iInterpFilterTaps[ch][1] = 4;
+      m_filterSample[ch]         = filterSample<4>;
       break;
     case SI_LANCZOS2:
     case SI_LANCZOS3:
@@ -2330,6 +2335,7 @@ Void TGeometry::initInterpolation(Int *pInterpolateType)
       }
       m_interpolateWeight[ch]    = &TGeometry::interpolate_lanczos_weight;
       m_iInterpFilterTaps[ch][0] = m_iInterpFilterTaps[ch][1] = m_iLanczosParamA[ch] * 2;
+      m_filterSample[ch]         = (m_iLanczosParamA[ch] == 2) ? filterSample<4> : filterSample<6>;
       break;
     default: CHECK(true, "Not supported yet!"); break;
     }
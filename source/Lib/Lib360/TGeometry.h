@@ -41,6 +41,7 @@
 #include "../CommonLib/CommonDef.h"
 #include "../Utilities/VideoIOYuv.h"
 
+class ThreadPool;
 
 // ====================================================================================================================
 // Class definition
@@ -533,6 +534,7 @@ struct PxlFltLut
   UShort weightIdx; 
 };
 typedef Void (TGeometry::*interpolateWeightFP)(ComponentID chId, SPos *pSPosIn, PxlFltLut &wlist);
+typedef Int (*filterSampleFP)(const Pel *pSrc, Int iStride, const Int *pWLut);   //weighted sum over the taps x taps window at pSrc;
 
 
 struct InputGeoParam
@@ -605,6 +607,7 @@ protected:
   interpolateWeightFP m_interpolateWeight[MAX_NUM_CHANNEL_TYPE]; 
 
   Int m_iInterpFilterTaps[MAX_NUM_CHANNEL_TYPE][2];                                        //[channel][hor/ver];
+  filterSampleFP m_filterSample[MAX_NUM_CHANNEL_TYPE];                                     //kernel for the filter taps of the channel;
   Int **m_pWeightLut[2];
   PxlFltLut *m_pPixelWeight[SV_MAX_NUM_FACES][2];                   //[SV_MAX_NUM_FACES][2][pxl_idx];
 
@@ -615,6 +618,8 @@ protected:
   PxlFltLut *m_pPixelWeight4SherePadding[SV_MAX_NUM_FACES][2];
   Bool m_bConvOutputPaddingNeeded;
 
+  ThreadPool *m_pThreadPool;        //rows of geoConvert() and spherePadding() are filtered in parallel if set;
+
   Void geometryMapping4SpherePadding();
   Void getSPLutIdx(Int ch, Int x, Int y, Int& iIdx);
 
@@ -674,6 +679,7 @@ public:
   Pel *getAddr(Int fId, Int compId) { return m_pFacesOrig[fId][compId]; }
   Int getMarginSize(Int bY) { return (bY? m_iMarginY : m_iMarginX); }
   Void setPaddingFlag(Bool bFlag) { m_bPadded = bFlag; }
+  Void setThreadPool(ThreadPool *pThreadPool) { m_pThreadPool = pThreadPool; }
   TChar* getGeoName() 
   {
 #if SVIDEO_HEMI_PROJECTIONS
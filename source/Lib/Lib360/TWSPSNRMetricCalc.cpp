@@ -37,6 +37,8 @@
 
 #include "TWSPSNRMetricCalc.h"
 
+#include <algorithm>
+
 #if SVIDEO_WSPSNR
 
 TWSPSNRMetric::TWSPSNRMetric()
@@ -90,6 +92,7 @@ TWSPSNRMetric::TWSPSNRMetric()
 #endif
 {
   m_dWSPSNR[0] = m_dWSPSNR[1] = m_dWSPSNR[2] = 0;
+  xResetWeightPlanes();
 }
 
 TWSPSNRMetric::~TWSPSNRMetric()
@@ -302,6 +305,7 @@ void TWSPSNRMetric::createTable(PelUnitBuf* pcPicD, TGeometry *pcCodingGeomtry)
   {
     return;
   }
+  xResetWeightPlanes();
 
   SVideoInfo *pCodingSVideoInfo = pcCodingGeomtry->getSVideoInfo();
   Int iFaceWidth = pCodingSVideoInfo->iFaceWidth;
@@ -2885,308 +2889,368 @@ void TWSPSNRMetric::createTable(PelUnitBuf* pcPicD, TGeometry *pcCodingGeomtry)
   }
 }
 
-Void TWSPSNRMetric::xCalculateWSPSNR( PelUnitBuf* pcOrgPicYuv, PelUnitBuf* pcPicD )
+Void TWSPSNRMetric::xResetWeightPlanes()
 {
-  Int iBitDepthForPSNRCalc[MAX_NUM_CHANNEL_TYPE];
-  Int iReferenceBitShift[MAX_NUM_CHANNEL_TYPE];
-  Int iOutputBitShift[MAX_NUM_CHANNEL_TYPE];
-  iBitDepthForPSNRCalc[CHANNEL_TYPE_LUMA] = std::max(m_outputBitDepth[CHANNEL_TYPE_LUMA], m_referenceBitDepth[CHANNEL_TYPE_LUMA]);
-  iBitDepthForPSNRCalc[CHANNEL_TYPE_CHROMA] = std::max(m_outputBitDepth[CHANNEL_TYPE_CHROMA], m_referenceBitDepth[CHANNEL_TYPE_CHROMA]);
-  iReferenceBitShift[CHANNEL_TYPE_LUMA] = iBitDepthForPSNRCalc[CHANNEL_TYPE_LUMA] - m_referenceBitDepth[CHANNEL_TYPE_LUMA];
-  iReferenceBitShift[CHANNEL_TYPE_CHROMA] = iBitDepthForPSNRCalc[CHANNEL_TYPE_CHROMA] - m_referenceBitDepth[CHANNEL_TYPE_CHROMA];
-  iOutputBitShift[CHANNEL_TYPE_LUMA] = iBitDepthForPSNRCalc[CHANNEL_TYPE_LUMA] - m_outputBitDepth[CHANNEL_TYPE_LUMA];
-  iOutputBitShift[CHANNEL_TYPE_CHROMA] = iBitDepthForPSNRCalc[CHANNEL_TYPE_CHROMA] - m_outputBitDepth[CHANNEL_TYPE_CHROMA];
-
-  memset(m_dWSPSNR, 0, sizeof(Double)*3);
-  PelUnitBuf &picd=*pcPicD;
-  //Double SSDspsnr[3]={0, 0 ,0};
-  //ChromaFormat chromaFormat = pcPicD->chromaFormat;
-
-  for(Int chan=0; chan< getNumberValidComponents(pcPicD->chromaFormat); chan++)
+  for(Int ch = 0; ch < MAX_NUM_COMPONENT; ch++)
   {
-    const ComponentID ch=ComponentID(chan);
-    const Pel*  pOrg       = pcOrgPicYuv->get(ch).bufAt(0, 0);
-    const Int   iOrgStride = pcOrgPicYuv->get(ch).stride;
-    const Pel*  pRec       = picd.get(ch).bufAt(0, 0);
-    const Int   iRecStride = picd.get(ch).stride;
-#if SVIDEO_HEMI_PROJECTIONS || SVIDEO_FISHEYE
-    Int Width_from = 0;
-    Int Width_to = 0;
-    Int iWidth = pcPicD->get(ch).width;
-    Int iHeight = pcPicD->get(ch).height;
-  
-    if (m_recGeoType == SVIDEO_HCMP || m_recGeoType == SVIDEO_HEAC)
-    {
-      Width_from = iWidth / 4;
-      Width_to = iWidth - iWidth / 4;
-    }
-    else
-    {
-      Width_to = iWidth;
-    }
-
-#else
-    const Int   iWidth  = pcPicD->get(ch).width ;
-    const Int   iHeight = pcPicD->get(ch).height ;
+    m_weightPlane[ch].clear();
+    m_bRowWeightConst[ch].clear();
+    m_dWeightSum[ch]         = 0;
+    m_iWeightPlaneWidth[ch]  = 0;
+    m_iWeightPlaneHeight[ch] = 0;
+    m_weightPlaneFormat[ch]  = NUM_CHROMA_FORMAT;
+#if SVIDEO_ERP_PADDING
+    m_bWeightPlanePERP[ch]   = false;
 #endif
-    Double fWeight =1;
-    Double fWeightSum=0;
-    //Int   iSize   = iWidth*iHeight;
+  }
+}
 
-    Double SSDwpsnr=0;
-      
-      
-    //WS-PSNR
-    for(Int y = 0; y < iHeight; y++ )
-    {
-        
-      if (m_codingGeoType==SVIDEO_EQUIRECT)
-      {      
-        if(!chan)
-        {
-          fWeight=m_fErpWeight_Y[y];
-        }
-        else
-        {
-          fWeight=m_fErpWeight_C[y];
-        }
-      }
-#if SVIDEO_HEMI_PROJECTIONS 
-      for (Int x = Width_from; x < Width_to; x++)
-#else
-      for(Int x = 0; x < iWidth; x++ )
-#endif
-      {
-        Intermediate_Int iDiff = (Intermediate_Int)( (pOrg[x]<<iReferenceBitShift[toChannelType(ch)]) - (pRec[x]<<iOutputBitShift[toChannelType(ch)]) );
-        if(  (m_codingGeoType == SVIDEO_CUBEMAP) 
+Double TWSPSNRMetric::xGetWeight(ComponentID ch, Int x, Int y, Int iWidth, Int iHeight, ChromaFormat chromaFormat, Double fWeight)
+{
+  const Int chan = ch;
+  if(  (m_codingGeoType == SVIDEO_CUBEMAP) 
 #if SVIDEO_ADJUSTED_CUBEMAP
-          || (m_codingGeoType == SVIDEO_ADJUSTEDCUBEMAP)
+    || (m_codingGeoType == SVIDEO_ADJUSTEDCUBEMAP)
 #endif
 #if SVIDEO_EQUATORIAL_CYLINDRICAL && !SVIDEO_ECP_WSPSNR_FIX_TICKET56
-          || (m_codingGeoType == SVIDEO_EQUATORIALCYLINDRICAL)
+    || (m_codingGeoType == SVIDEO_EQUATORIALCYLINDRICAL)
 #endif
 #if SVIDEO_EQUIANGULAR_CUBEMAP
-          || (m_codingGeoType == SVIDEO_EQUIANGULARCUBEMAP)
+    || (m_codingGeoType == SVIDEO_EQUIANGULARCUBEMAP)
 #endif
 #if SVIDEO_HEMI_PROJECTIONS
-          || (m_codingGeoType == SVIDEO_HCMP)
-          || (m_codingGeoType == SVIDEO_HEAC)
+    || (m_codingGeoType == SVIDEO_HCMP)
+    || (m_codingGeoType == SVIDEO_HEAC)
 #endif
-          )
-        {
-          if(!chan)
-          {
-            if(iWidth/4 == iHeight/3 && x >= iWidth/4 && (y< iHeight/3 || y>= 2*iHeight/3))
-            {
-              fWeight=0;
-            }
-            else 
-            {
-              fWeight=m_fCubeWeight_Y[(m_iCodingFaceWidth)*(y%(m_iCodingFaceHeight)) +(x%(m_iCodingFaceWidth))];
-            }
+    )
+  {
+    if(!chan)
+    {
+      if(iWidth/4 == iHeight/3 && x >= iWidth/4 && (y< iHeight/3 || y>= 2*iHeight/3))
+      {
+        fWeight=0;
+      }
+      else 
+      {
+        fWeight=m_fCubeWeight_Y[(m_iCodingFaceWidth)*(y%(m_iCodingFaceHeight)) +(x%(m_iCodingFaceWidth))];
+      }
 
-          }
-          else
-          {
-            if(iWidth/4 == iHeight/3 && x >= iWidth/4 && (y< iHeight/3 || y>= 2*iHeight/3))
-            {
-              fWeight=0;
-            }
-            else
-            {
-              fWeight=m_fCubeWeight_C[(m_iCodingFaceWidth>>(::getComponentScaleX(COMPONENT_Cb, pcPicD->chromaFormat)))*(y%(m_iCodingFaceHeight>>(::getComponentScaleY(COMPONENT_Cb, pcPicD->chromaFormat)))) +(x%(m_iCodingFaceWidth>>(::getComponentScaleX(COMPONENT_Cb,pcPicD->chromaFormat))))];
-            }  
-          }
-        }
+    }
+    else
+    {
+      if(iWidth/4 == iHeight/3 && x >= iWidth/4 && (y< iHeight/3 || y>= 2*iHeight/3))
+      {
+        fWeight=0;
+      }
+      else
+      {
+        fWeight=m_fCubeWeight_C[(m_iCodingFaceWidth>>(::getComponentScaleX(COMPONENT_Cb, chromaFormat)))*(y%(m_iCodingFaceHeight>>(::getComponentScaleY(COMPONENT_Cb, chromaFormat)))) +(x%(m_iCodingFaceWidth>>(::getComponentScaleX(COMPONENT_Cb,chromaFormat))))];
+      }  
+    }
+  }
 #if SVIDEO_ADJUSTED_EQUALAREA
-        else if (m_codingGeoType==SVIDEO_ADJUSTEDEQUALAREA)
+  else if (m_codingGeoType==SVIDEO_ADJUSTEDEQUALAREA)
 #else
-        else if (m_codingGeoType==SVIDEO_EQUALAREA)
+  else if (m_codingGeoType==SVIDEO_EQUALAREA)
 #endif
-        {
-          if(!chan)
-          {
-            fWeight=m_fEapWeight_Y[y*iWidth+x];
-          }
-          else
-          {
-            fWeight=m_fEapWeight_C[y*iWidth+x];
-          }
-        }
-        else if (m_codingGeoType==SVIDEO_OCTAHEDRON )
-        {
-          if(!chan)
-          {
-            fWeight=m_fOctaWeight_Y[iWidth*y +x];
-          }
-          else
-          {
-            fWeight=m_fOctaWeight_C[y*iWidth+x];
-          }
-        }
-        else if ( m_codingGeoType==SVIDEO_ICOSAHEDRON)
-        {
-          if(!chan)
-          {
-            fWeight=m_fIcoWeight_Y[iWidth*y +x];
-          }
-          else
-          {
-            fWeight=m_fIcoWeight_C[y*iWidth+x];
-          }
-        }
+  {
+    if(!chan)
+    {
+      fWeight=m_fEapWeight_Y[y*iWidth+x];
+    }
+    else
+    {
+      fWeight=m_fEapWeight_C[y*iWidth+x];
+    }
+  }
+  else if (m_codingGeoType==SVIDEO_OCTAHEDRON )
+  {
+    if(!chan)
+    {
+      fWeight=m_fOctaWeight_Y[iWidth*y +x];
+    }
+    else
+    {
+      fWeight=m_fOctaWeight_C[y*iWidth+x];
+    }
+  }
+  else if ( m_codingGeoType==SVIDEO_ICOSAHEDRON)
+  {
+    if(!chan)
+    {
+      fWeight=m_fIcoWeight_Y[iWidth*y +x];
+    }
+    else
+    {
+      fWeight=m_fIcoWeight_C[y*iWidth+x];
+    }
+  }
 #if SVIDEO_WSPSNR_SSP
-        else if (m_codingGeoType == SVIDEO_SEGMENTEDSPHERE)
-        {
-            if (!chan)
-            {
-                fWeight = m_fSspWeight_Y[iWidth*y + x];
-            }
-            else
-            {
-                fWeight = m_fSspWeight_C[y*iWidth + x];
-            }
-        }
+  else if (m_codingGeoType == SVIDEO_SEGMENTEDSPHERE)
+  {
+      if (!chan)
+      {
+          fWeight = m_fSspWeight_Y[iWidth*y + x];
+      }
+      else
+      {
+          fWeight = m_fSspWeight_C[y*iWidth + x];
+      }
+  }
 #endif
 #if SVIDEO_ROTATED_SPHERE
-        else if (m_codingGeoType==SVIDEO_ROTATEDSPHERE)
-        {
-            if(!chan)
-            {
-                fWeight = m_fRspWeight_Y[iWidth*y + x];
-            }
-            else
-            {
-                fWeight = m_fRspWeight_C[y*iWidth + x];
-            }
-        }
+  else if (m_codingGeoType==SVIDEO_ROTATEDSPHERE)
+  {
+      if(!chan)
+      {
+          fWeight = m_fRspWeight_Y[iWidth*y + x];
+      }
+      else
+      {
+          fWeight = m_fRspWeight_C[y*iWidth + x];
+      }
+  }
 #endif
 #if SVIDEO_ECP_WSPSNR_FIX_TICKET56
-        else if (m_codingGeoType==SVIDEO_EQUATORIALCYLINDRICAL)
-        {
-            if(!chan)
-            {
-                fWeight = m_fEcpWeight_Y[iWidth*y + x];
-            }
-            else
-            {
-                fWeight = m_fEcpWeight_C[y*iWidth + x];
-            }
-        }
+  else if (m_codingGeoType==SVIDEO_EQUATORIALCYLINDRICAL)
+  {
+      if(!chan)
+      {
+          fWeight = m_fEcpWeight_Y[iWidth*y + x];
+      }
+      else
+      {
+          fWeight = m_fEcpWeight_C[y*iWidth + x];
+      }
+  }
 #endif
 #if SVIDEO_ERP_PADDING
-        else if (m_codingGeoType == SVIDEO_EQUIRECT && m_bPERP )
-        {
+  else if (m_codingGeoType == SVIDEO_EQUIRECT && m_bPERP )
+  {
 #if 1
-            ChromaFormat fmt = pcPicD->chromaFormat;                
-            if ((x < (SVIDEO_ERP_PAD_L >> getComponentScaleX(ch, fmt))) || (x >= (iWidth - (SVIDEO_ERP_PAD_R >> getComponentScaleX(ch, fmt)))))
-                fWeight = 0;
-            else
-                fWeight = (!chan)? m_fErpWeight_Y[y] : m_fErpWeight_C[y];
+      ChromaFormat fmt = chromaFormat;                
+      if ((x < (SVIDEO_ERP_PAD_L >> getComponentScaleX(ch, fmt))) || (x >= (iWidth - (SVIDEO_ERP_PAD_R >> getComponentScaleX(ch, fmt)))))
+          fWeight = 0;
+      else
+          fWeight = (!chan)? m_fErpWeight_Y[y] : m_fErpWeight_C[y];
 #else
-            if (!chan)
-            {
-                if( (x < SVIDEO_ERP_PAD_L) || (x >= (iWidth - SVIDEO_ERP_PAD_R)))
-                    fWeight = 0;
-                else
-                    fWeight = m_fErpWeight_Y[y];
-            }
-            else
-            {
-                ComponentID chId = ComponentID(chan);
-                ChromaFormat fmt = pcPicD->chromaFormat;
-                
-                if ((x < (SVIDEO_ERP_PAD_L >> getComponentScaleX(chId, fmt))) || (x >= (iWidth - (SVIDEO_ERP_PAD_R >> getComponentScaleX(chId, fmt)))))
-                    fWeight = 0;
-                else
-                    fWeight = m_fErpWeight_C[y];
-            }
+      if (!chan)
+      {
+          if( (x < SVIDEO_ERP_PAD_L) || (x >= (iWidth - SVIDEO_ERP_PAD_R)))
+              fWeight = 0;
+          else
+              fWeight = m_fErpWeight_Y[y];
+      }
+      else
+      {
+          ComponentID chId = ComponentID(chan);
+          ChromaFormat fmt = chromaFormat;
+          
+          if ((x < (SVIDEO_ERP_PAD_L >> getComponentScaleX(chId, fmt))) || (x >= (iWidth - (SVIDEO_ERP_PAD_R >> getComponentScaleX(chId, fmt)))))
+              fWeight = 0;
+          else
+              fWeight = m_fErpWeight_C[y];
+      }
 #endif
-        }
+  }
 #endif
 #if SVIDEO_HYBRID_EQUIANGULAR_CUBEMAP
-        else if (m_codingGeoType == SVIDEO_HYBRIDEQUIANGULARCUBEMAP)
-        {
-          if(!chan)
-          {
-            fWeight=m_fHecWeight_Y[y*iWidth+x];
-          }
-          else
-          {
-            fWeight=m_fHecWeight_C[y*iWidth+x];
-          }
-        }
+  else if (m_codingGeoType == SVIDEO_HYBRIDEQUIANGULARCUBEMAP)
+  {
+    if(!chan)
+    {
+      fWeight=m_fHecWeight_Y[y*iWidth+x];
+    }
+    else
+    {
+      fWeight=m_fHecWeight_C[y*iWidth+x];
+    }
+  }
 #endif
 #if SVIDEO_GENERALIZED_CUBEMAP
-        else if (m_codingGeoType == SVIDEO_GENERALIZEDCUBEMAP)
-        {
-          if(!chan)
-          {
-            fWeight=m_fGcmpWeight_Y[y*iWidth+x];
-          }
-          else
-          {
-            fWeight=m_fGcmpWeight_C[y*iWidth+x];
-          }
-        }
+  else if (m_codingGeoType == SVIDEO_GENERALIZEDCUBEMAP)
+  {
+    if(!chan)
+    {
+      fWeight=m_fGcmpWeight_Y[y*iWidth+x];
+    }
+    else
+    {
+      fWeight=m_fGcmpWeight_C[y*iWidth+x];
+    }
+  }
 #endif
 
+  return fWeight;
+}
 
 #if SVIDEO_FISHEYE
-    if (m_codingGeoType == SVIDEO_EQUIRECT && m_recGeoType == SVIDEO_FISHEYE_CIRCULAR)
-    {
-      Double  max_angle_rad = m_fisheyeInfo.fFOV / SVIDEO_ROT_PRECISION / 2 * S_PI / 180.0;
+Bool TWSPSNRMetric::xInsideFisheyeFov(ComponentID ch, Int x, Int y, Int iWidth, Int iHeight, ChromaFormat chromaFormat)
+{
+  Double  max_angle_rad = m_fisheyeInfo.fFOV / SVIDEO_ROT_PRECISION / 2 * S_PI / 180.0;
 
-      Double  ctr_yaw = m_fisheyeInfo.fCentreAzimuth/SVIDEO_ROT_PRECISION * S_PI / 180;
-      Double  ctr_pitch = -m_fisheyeInfo.fCentreElevation/SVIDEO_ROT_PRECISION  * S_PI / 180;
+  Double  ctr_yaw = m_fisheyeInfo.fCentreAzimuth/SVIDEO_ROT_PRECISION * S_PI / 180;
+  Double  ctr_pitch = -m_fisheyeInfo.fCentreElevation/SVIDEO_ROT_PRECISION  * S_PI / 180;
 
-      Double  ctr_sphere_x = scos(ctr_pitch)*scos(ctr_yaw);
-      Double  ctr_sphere_y = ssin(ctr_pitch);
-      Double  ctr_sphere_z = -scos(ctr_pitch)*ssin(ctr_yaw);
+  Double  ctr_sphere_x = scos(ctr_pitch)*scos(ctr_yaw);
+  Double  ctr_sphere_y = ssin(ctr_pitch);
+  Double  ctr_sphere_z = -scos(ctr_pitch)*ssin(ctr_yaw);
 
-      Double  ctr_norm = ssqrt(ctr_sphere_x*ctr_sphere_x + ctr_sphere_y*ctr_sphere_y + ctr_sphere_z*ctr_sphere_z);
+  Double  ctr_norm = ssqrt(ctr_sphere_x*ctr_sphere_x + ctr_sphere_y*ctr_sphere_y + ctr_sphere_z*ctr_sphere_z);
 
 
-      Int    xx = x << getComponentScaleX(ch, pcPicD->chromaFormat);
-      Int    yy = y << getComponentScaleY(ch, pcPicD->chromaFormat);
+  Int    xx = x << getComponentScaleX(ch, chromaFormat);
+  Int    yy = y << getComponentScaleY(ch, chromaFormat);
 
-      Int    sWidth = pcPicD->get(ch).width << getComponentScaleX(ch, pcPicD->chromaFormat);
-      Int    sHeight = pcPicD->get(ch).height << getComponentScaleY(ch, pcPicD->chromaFormat);
+  Int    sWidth = iWidth << getComponentScaleX(ch, chromaFormat);
+  Int    sHeight = iHeight << getComponentScaleY(ch, chromaFormat);
 
-      Double  yaw = ((xx + 0.5) / sWidth - 0.5) * 2 * S_PI;
-      Double  pitch = ((yy + 0.5) / sHeight - 0.5) * -S_PI;
+  Double  yaw = ((xx + 0.5) / sWidth - 0.5) * 2 * S_PI;
+  Double  pitch = ((yy + 0.5) / sHeight - 0.5) * -S_PI;
 
-      Double  sphere_x = scos(pitch)*scos(yaw);
-      Double  sphere_y = ssin(pitch);
-      Double  sphere_z = -scos(pitch)*ssin(yaw);
+  Double  sphere_x = scos(pitch)*scos(yaw);
+  Double  sphere_y = ssin(pitch);
+  Double  sphere_z = -scos(pitch)*ssin(yaw);
 
-      Double  norm = ssqrt(sphere_x*sphere_x + sphere_y*sphere_y + sphere_z*sphere_z);
+  Double  norm = ssqrt(sphere_x*sphere_x + sphere_y*sphere_y + sphere_z*sphere_z);
 
 
-      Double  innerProduct = sphere_x*ctr_sphere_x + sphere_y*ctr_sphere_y + sphere_z*ctr_sphere_z;
-      Double  theta_rad = acos(innerProduct / (norm * ctr_norm));
-      
-      if (theta_rad < max_angle_rad)
+  Double  innerProduct = sphere_x*ctr_sphere_x + sphere_y*ctr_sphere_y + sphere_z*ctr_sphere_z;
+  Double  theta_rad = acos(innerProduct / (norm * ctr_norm));
+  return theta_rad < max_angle_rad;
+}
+#endif
+
+Void TWSPSNRMetric::xInitWeightPlane(ComponentID ch, Int iWidth, Int iHeight, ChromaFormat chromaFormat)
+{
+  const Int chan = ch;
+#if SVIDEO_HEMI_PROJECTIONS
+  Int Width_from = 0;
+  Int Width_to   = iWidth;
+  if (m_recGeoType == SVIDEO_HCMP || m_recGeoType == SVIDEO_HEAC)
+  {
+    Width_from = iWidth / 4;
+    Width_to   = iWidth - iWidth / 4;
+  }
+#endif
+
+  m_weightPlane[ch].resize(iWidth * iHeight);
+  m_bRowWeightConst[ch].resize(iHeight);
+  m_dWeightSum[ch] = 0;
+
+  Double fWeight = 1;
+  for(Int y = 0; y < iHeight; y++)
+  {
+    if (m_codingGeoType==SVIDEO_EQUIRECT)
+    {
+      fWeight = !chan ? m_fErpWeight_Y[y] : m_fErpWeight_C[y];
+    }
+    Double *pWeight = &m_weightPlane[ch][y * iWidth];
+    for(Int x = 0; x < iWidth; x++)
+    {
+#if SVIDEO_HEMI_PROJECTIONS
+      if (x < Width_from || x >= Width_to)
       {
-        if (fWeight > 0)
-          fWeightSum += fWeight;
-        SSDwpsnr += iDiff * iDiff*fWeight;
+        pWeight[x] = 0;
+        continue;
       }
+#endif
+      fWeight    = xGetWeight(ch, x, y, iWidth, iHeight, chromaFormat, fWeight);
+      pWeight[x] = fWeight;
+#if SVIDEO_FISHEYE
+      if (m_codingGeoType == SVIDEO_EQUIRECT && m_recGeoType == SVIDEO_FISHEYE_CIRCULAR
+          && !xInsideFisheyeFov(ch, x, y, iWidth, iHeight, chromaFormat))
+      {
+        pWeight[x] = 0;
+      }
+#endif
+      if (pWeight[x] > 0)
+        m_dWeightSum[ch] += pWeight[x];
     }
-    else
+    m_bRowWeightConst[ch][y] = std::all_of(pWeight, pWeight + iWidth, [pWeight](Double w) { return w == pWeight[0]; });
+  }
+
+  m_iWeightPlaneWidth[ch]  = iWidth;
+  m_iWeightPlaneHeight[ch] = iHeight;
+  m_weightPlaneFormat[ch]  = chromaFormat;
+#if SVIDEO_ERP_PADDING
+  m_bWeightPlanePERP[ch]   = m_bPERP;
+#endif
+}
+
+Void TWSPSNRMetric::xCalculateWSPSNR( PelUnitBuf* pcOrgPicYuv, PelUnitBuf* pcPicD )
+{
+  Int iBitDepthForPSNRCalc[MAX_NUM_CHANNEL_TYPE];
+  Int iReferenceBitShift[MAX_NUM_CHANNEL_TYPE];
+  Int iOutputBitShift[MAX_NUM_CHANNEL_TYPE];
+  iBitDepthForPSNRCalc[CHANNEL_TYPE_LUMA] = std::max(m_outputBitDepth[CHANNEL_TYPE_LUMA], m_referenceBitDepth[CHANNEL_TYPE_LUMA]);
+  iBitDepthForPSNRCalc[CHANNEL_TYPE_CHROMA] = std::max(m_outputBitDepth[CHANNEL_TYPE_CHROMA], m_referenceBitDepth[CHANNEL_TYPE_CHROMA]);
+  iReferenceBitShift[CHANNEL_TYPE_LUMA] = iBitDepthForPSNRCalc[CHANNEL_TYPE_LUMA] - m_referenceBitDepth[CHANNEL_TYPE_LUMA];
+  iReferenceBitShift[CHANNEL_TYPE_CHROMA] = iBitDepthForPSNRCalc[CHANNEL_TYPE_CHROMA] - m_referenceBitDepth[CHANNEL_TYPE_CHROMA];
+  iOutputBitShift[CHANNEL_TYPE_LUMA] = iBitDepthForPSNRCalc[CHANNEL_TYPE_LUMA] - m_outputBitDepth[CHANNEL_TYPE_LUMA];
+  iOutputBitShift[CHANNEL_TYPE_CHROMA] = iBitDepthForPSNRCalc[CHANNEL_TYPE_CHROMA] - m_outputBitDepth[CHANNEL_TYPE_CHROMA];
+
+  memset(m_dWSPSNR, 0, sizeof(Double)*3);
+  PelUnitBuf &picd=*pcPicD;
+  //Double SSDspsnr[3]={0, 0 ,0};
+  //ChromaFormat chromaFormat = pcPicD->chromaFormat;
+
+  for(Int chan=0; chan< getNumberValidComponents(pcPicD->chromaFormat); chan++)
+  {
+    const ComponentID ch=ComponentID(chan);
+    const Pel*  pOrg       = pcOrgPicYuv->get(ch).bufAt(0, 0);
+    const Int   iOrgStride = pcOrgPicYuv->get(ch).stride;
+    const Pel*  pRec       = picd.get(ch).bufAt(0, 0);
+    const Int   iRecStride = picd.get(ch).stride;
+    const Int   iWidth  = pcPicD->get(ch).width ;
+    const Int   iHeight = pcPicD->get(ch).height ;
+    const Int   iRefShift = iReferenceBitShift[toChannelType(ch)];
+    const Int   iOutShift = iOutputBitShift[toChannelType(ch)];
+
+    // the weights only depend on the geometry and the picture size, so they are looked up once
+    if (m_iWeightPlaneWidth[ch] != iWidth || m_iWeightPlaneHeight[ch] != iHeight || m_weightPlaneFormat[ch] != pcPicD->chromaFormat
+#if SVIDEO_ERP_PADDING
+        || m_bWeightPlanePERP[ch] != m_bPERP
+#endif
+       )
     {
-#endif  // SVIDEO_FISHEYE
-      if (fWeight > 0)
-        fWeightSum += fWeight;
-      SSDwpsnr += iDiff * iDiff*fWeight;
-#if SVIDEO_FISHEYE
+      xInitWeightPlane(ch, iWidth, iHeight, pcPicD->chromaFormat);
     }
-#endif  // SVIDEO_FISHEYE
+    const Double* pWeight    = &m_weightPlane[ch][0];
+    const Double  fWeightSum = m_dWeightSum[ch];
+
+    Double SSDwpsnr=0;
+
+    //WS-PSNR
+    for(Int y = 0; y < iHeight; y++ )
+    {
+      if (m_bRowWeightConst[ch][y])
+      {
+        // rows of equal weights (e.g. equirectangular) accumulate the plain SSD and apply the weight once
+        if (pWeight[0] != 0)
+        {
+          int64_t iSSD = 0;
+          for(Int x = 0; x < iWidth; x++ )
+          {
+            Intermediate_Int iDiff = (Intermediate_Int)( (pOrg[x]<<iRefShift) - (pRec[x]<<iOutShift) );
+            iSSD += iDiff * iDiff;
+          }
+          SSDwpsnr += iSSD * pWeight[0];
+        }
       }
-    
+      else
+      {
+        for(Int x = 0; x < iWidth; x++ )
+        {
+          Intermediate_Int iDiff = (Intermediate_Int)( (pOrg[x]<<iRefShift) - (pRec[x]<<iOutShift) );
+          SSDwpsnr += iDiff * iDiff*pWeight[x];
+        }
+      }
+
+      pWeight += iWidth;
       pOrg += iOrgStride;
       pRec += iRecStride;
-    }      
+    }
 
     const Int maxval = 255<<(iBitDepthForPSNRCalc[toChannelType(ch)]-8) ;
     //const Double fRefValue = (Double) maxval * maxval * iSize;
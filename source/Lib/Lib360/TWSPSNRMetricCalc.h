@@ -39,6 +39,7 @@
 #define __TWSPSNRCALC__
 #include "TGeometry.h"
 #include "../Utilities/VideoIOYuv.h"
+#include <vector>
 // ====================================================================================================================
 // Class definition
 // ====================================================================================================================
@@ -117,6 +118,24 @@ private:
 #if SVIDEO_FISHEYE
   FisheyeInfo m_fisheyeInfo;
 #endif
+
+  //weight of every sample for the picture size last measured, looked up from the tables above on first use;
+  std::vector<Double> m_weightPlane[MAX_NUM_COMPONENT];
+  std::vector<Bool>   m_bRowWeightConst[MAX_NUM_COMPONENT];  //all samples of the row have the same weight;
+  Double              m_dWeightSum[MAX_NUM_COMPONENT];       //sum of the positive weights;
+  Int                 m_iWeightPlaneWidth[MAX_NUM_COMPONENT];
+  Int                 m_iWeightPlaneHeight[MAX_NUM_COMPONENT];
+  ChromaFormat        m_weightPlaneFormat[MAX_NUM_COMPONENT];
+#if SVIDEO_ERP_PADDING
+  Bool                m_bWeightPlanePERP[MAX_NUM_COMPONENT];
+#endif
+
+  Void    xResetWeightPlanes();
+  Double  xGetWeight(ComponentID ch, Int x, Int y, Int iWidth, Int iHeight, ChromaFormat chromaFormat, Double fWeight);
+#if SVIDEO_FISHEYE
+  Bool    xInsideFisheyeFov(ComponentID ch, Int x, Int y, Int iWidth, Int iHeight, ChromaFormat chromaFormat);
+#endif
+  Void    xInitWeightPlane(ComponentID ch, Int iWidth, Int iHeight, ChromaFormat chromaFormat);
 public:
   TWSPSNRMetric();
   virtual ~TWSPSNRMetric();
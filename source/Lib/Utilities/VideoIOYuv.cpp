@@ -316,16 +316,39 @@ void VideoIOYuv::writeY4mFileHeader()
 
 void VideoIOYuv::close()
 {
+  // the background thread finishes its queued frames first
+  m_asyncThread.reset();
+  m_asyncFrames.clear();
+  m_readFrames.clear();
+  m_asyncEof    = false;
+  m_asyncFail   = false;
+  m_writeFailed = false;
+
   m_cHandle.close();
+
+  if (m_writeException)
+  {
+    std::exception_ptr exception = m_writeException;
+    m_writeException = nullptr;
+    std::rethrow_exception(exception);
+  }
 }
 
 bool VideoIOYuv::isEof()
 {
+  if (!m_readFrames.empty())
+  {
+    return m_asyncEof;
+  }
   return m_cHandle.eof();
 }
 
 bool VideoIOYuv::isFail()
 {
+  if (!m_readFrames.empty())
+  {
+    return m_asyncFail;
+  }
   return m_cHandle.fail();
 }
 
@@ -346,6 +369,22 @@ void VideoIOYuv::skipFrames(uint32_t numFrames, uint32_t width, uint32_t height,
     return;
   }
 
+  // the frames are already being read ahead
+  if (!m_readFrames.empty())
+  {
+    for (int i = 0; i < int(numFrames); i++)
+    {
+      AsyncFrame &frame = xWaitForReadFrame();
+      const bool  ok    = frame.ok;
+      xQueueRead(frame);
+      if (!ok)
+      {
+        break;
+      }
+    }
+    return;
+  }
+
   //------------------
   //set the frame size according to the chroma format
   streamoff frameSize = 0;
@@ -1040,9 +1079,92 @@ static bool writeField(ostream& fd, const Pel* top, const Pel* bottom,
  * @return true for success, false in case of error
  */
 bool VideoIOYuv::read ( PelUnitBuf& pic, PelUnitBuf& picOrg, const InputColourSpaceConversion ipcsc, int aiPad[2], ChromaFormat format, const bool bClipToRec709 )
+{
+  if (m_readAheadFrames <= 0)
+  {
+    return xReadFrame(pic, picOrg, ipcsc, aiPad, format, bClipToRec709);
+  }
+
+  if (m_readFrames.empty())
+  {
+    m_readIpcsc        = ipcsc;
+    m_readPad[0]       = aiPad[0];
+    m_readPad[1]       = aiPad[1];
+    m_readFormat       = format;
+    m_readClipToRec709 = bClipToRec709;
+
+    m_asyncThread.reset(new ThreadPool(1));
+    for (int i = 0; i < m_readAheadFrames; i++)
+    {
+      m_asyncFrames.emplace_back(new AsyncFrame);
+      AsyncFrame &frame = *m_asyncFrames.back();
+      frame.pic   .create(pic.chromaFormat,    Area(Position(), pic.Y()));
+      frame.picOrg.create(picOrg.chromaFormat, Area(Position(), picOrg.Y()));
+      xQueueRead(frame);
+    }
+  }
+
+  AsyncFrame &frame = xWaitForReadFrame();
+  const bool  ok    = frame.ok;
+  if (ok)
+  {
+    pic   .copyFrom(frame.pic);
+    picOrg.copyFrom(frame.picOrg);
+  }
+  xQueueRead(frame);
+
+  return ok;
+}
+
+void VideoIOYuv::xQueueRead(AsyncFrame &frame)
+{
+  frame.ready = false;
+  m_readFrames.push_back(&frame);
+
+  m_asyncThread->addTask([this, &frame]
+  {
+    bool ok = false;
+    try
+    {
+      ok = xReadFrame(frame.pic, frame.picOrg, m_readIpcsc, m_readPad, m_readFormat, m_readClipToRec709);
+    }
+    catch (...)
+    {
+      frame.exception = std::current_exception();
+    }
+
+    std::lock_guard<std::mutex> lock(m_asyncMutex);
+    frame.ok    = ok;
+    frame.eof   = m_cHandle.eof();
+    frame.fail  = m_cHandle.fail();
+    frame.ready = true;
+    m_asyncCond.notify_all();
+  });
+}
+
+VideoIOYuv::AsyncFrame& VideoIOYuv::xWaitForReadFrame()
+{
+  AsyncFrame &frame = *m_readFrames.front();
+  m_readFrames.pop_front();
+  {
+    std::unique_lock<std::mutex> lock(m_asyncMutex);
+    m_asyncCond.wait(lock, [&frame] { return frame.ready; });
+  }
+  if (frame.exception)
+  {
+    std::exception_ptr exception = frame.exception;
+    frame.exception = nullptr;
+    std::rethrow_exception(exception);
+  }
+  m_asyncEof  = frame.eof;
+  m_asyncFail = frame.fail;
+  return frame;
+}
+
+bool VideoIOYuv::xReadFrame( PelUnitBuf& pic, PelUnitBuf& picOrg, const InputColourSpaceConversion ipcsc, int aiPad[2], ChromaFormat format, const bool bClipToRec709 )
 {
   // check end-of-file
-  if ( isEof() )
+  if ( m_cHandle.eof() )
   {
     return false;
   }
@@ -1153,6 +1275,107 @@ bool VideoIOYuv::write( uint32_t orgWidth, uint32_t orgHeight, const CPelUnitBuf
                         const InputColourSpaceConversion ipCSC,
                         const bool bPackedYUVOutputMode,
                         int confLeft, int confRight, int confTop, int confBottom, ChromaFormat format, const bool bClipToRec709, const bool subtractConfWindowOffsets )
+{
+  if (m_writeBehindFrames <= 0)
+  {
+    return xWriteFrame(orgWidth, orgHeight, pic, ipCSC, bPackedYUVOutputMode, confLeft, confRight, confTop, confBottom, format,
+                       bClipToRec709, subtractConfWindowOffsets);
+  }
+
+  if (!m_asyncThread)
+  {
+    m_asyncThread.reset(new ThreadPool(1));
+    for (int i = 0; i < m_writeBehindFrames; i++)
+    {
+      m_asyncFrames.emplace_back(new AsyncFrame);
+      m_asyncFrames.back()->ready = true;
+    }
+  }
+
+  AsyncFrame *frame = nullptr;
+  {
+    std::unique_lock<std::mutex> lock(m_asyncMutex);
+    m_asyncCond.wait(lock, [&]
+    {
+      for (auto &asyncFrame: m_asyncFrames)
+      {
+        if (asyncFrame->ready)
+        {
+          frame = asyncFrame.get();
+          return true;
+        }
+      }
+      return false;
+    });
+    if (m_writeException)
+    {
+      std::exception_ptr exception = m_writeException;
+      m_writeException = nullptr;
+      std::rethrow_exception(exception);
+    }
+    frame->ready = false;
+  }
+
+  // the size of the output pictures may change, e.g. with RPR
+  if (frame->pic.chromaFormat != pic.chromaFormat || frame->pic.bufs.empty()
+      || frame->pic.Y().width != pic.Y().width || frame->pic.Y().height != pic.Y().height)
+  {
+    frame->pic.destroy();
+    frame->pic.create(pic.chromaFormat, Area(Position(), pic.Y()));
+  }
+  frame->pic.copyFrom(pic);
+
+  m_asyncThread->addTask([=]
+  {
+    bool               ok = false;
+    std::exception_ptr exception;
+    try
+    {
+      ok = xWriteFrame(orgWidth, orgHeight, frame->pic, ipCSC, bPackedYUVOutputMode, confLeft, confRight, confTop, confBottom,
+                       format, bClipToRec709, subtractConfWindowOffsets);
+    }
+    catch (...)
+    {
+      exception = std::current_exception();
+    }
+
+    std::lock_guard<std::mutex> lock(m_asyncMutex);
+    m_writeFailed |= !ok;
+    if (exception && !m_writeException)
+    {
+      m_writeException = exception;
+    }
+    frame->ready = true;
+    m_asyncCond.notify_all();
+  });
+
+  std::lock_guard<std::mutex> lock(m_asyncMutex);
+  return !m_writeFailed;
+}
+
+void VideoIOYuv::xWaitForWrites()
+{
+  if (m_asyncThread)
+  {
+    std::unique_lock<std::mutex> lock(m_asyncMutex);
+    m_asyncCond.wait(lock, [this]
+    {
+      for (auto &asyncFrame: m_asyncFrames)
+      {
+        if (!asyncFrame->ready)
+        {
+          return false;
+        }
+      }
+      return true;
+    });
+  }
+}
+
+bool VideoIOYuv::xWriteFrame( uint32_t orgWidth, uint32_t orgHeight, const CPelUnitBuf& pic,
+                              const InputColourSpaceConversion ipCSC,
+                              const bool bPackedYUVOutputMode,
+                              int confLeft, int confRight, int confTop, int confBottom, ChromaFormat format, const bool bClipToRec709, const bool subtractConfWindowOffsets )
 {
   PelStorage interm;
 
@@ -1250,6 +1473,9 @@ bool VideoIOYuv::write( const CPelUnitBuf& picTop, const CPelUnitBuf& picBottom,
                         const bool bPackedYUVOutputMode,
                         int confLeft, int confRight, int confTop, int confBottom, ChromaFormat format, const bool isTff, const bool bClipToRec709 )
 {
+  // the fields are written directly after the frames written behind
+  xWaitForWrites();
+
   PelStorage intermTop;
   PelStorage intermBottom;
 
@@ -39,10 +39,16 @@
 #define __VIDEOIOYUV__
 
 #include <stdio.h>
+#include <condition_variable>
+#include <deque>
+#include <exception>
 #include <fstream>
 #include <iostream>
+#include <memory>
+#include <mutex>
 #include "CommonLib/CommonDef.h"
 #include "CommonLib/Unit.h"
+#include "CommonLib/ThreadPool.h"
 
 using namespace std;
 
@@ -70,6 +76,42 @@ private:
   ChromaFormat m_outChromaFormat       = CHROMA_420;
   bool         m_outY4m                = false;
 
+  /// frame buffer of the background thread
+  struct AsyncFrame
+  {
+    PelStorage         pic;
+    PelStorage         picOrg;
+    bool               ready = false;       ///< read: frame read by the thread, write: frame written and free
+    bool               ok    = false;       ///< result of the read
+    bool               eof   = false;       ///< end of file after the read
+    bool               fail  = false;       ///< failure after the read
+    std::exception_ptr exception;           ///< exception thrown by the read
+  };
+  int                                      m_readAheadFrames   = 0;      ///< frames read ahead on a background thread (0: read synchronously)
+  int                                      m_writeBehindFrames = 0;      ///< frames written behind on a background thread (0: write synchronously)
+  InputColourSpaceConversion               m_readIpcsc         = IPCOLOURSPACE_UNCHANGED;
+  int                                      m_readPad[2]        = { 0, 0 };
+  ChromaFormat                             m_readFormat        = NUM_CHROMA_FORMAT;
+  bool                                     m_readClipToRec709  = false;
+  std::vector<std::unique_ptr<AsyncFrame>> m_asyncFrames;
+  std::deque<AsyncFrame*>                  m_readFrames;                 ///< frames queued for reading, in file order
+  std::mutex                               m_asyncMutex;
+  std::condition_variable                  m_asyncCond;
+  bool                                     m_asyncEof          = false;  ///< isEof() after the last frame returned by read()
+  bool                                     m_asyncFail         = false;  ///< isFail() after the last frame returned by read()
+  bool                                     m_writeFailed       = false;  ///< a frame written behind failed
+  std::exception_ptr                       m_writeException;             ///< exception thrown while writing behind
+  std::unique_ptr<ThreadPool>              m_asyncThread;                ///< background thread, declared last to finish its frames first
+
+  bool  xReadFrame ( PelUnitBuf& pic, PelUnitBuf& picOrg, const InputColourSpaceConversion ipcsc, int aiPad[2], ChromaFormat fileFormat, const bool bClipToRec709 );
+  bool  xWriteFrame( uint32_t orgWidth, uint32_t orgHeight, const CPelUnitBuf& pic,
+                     const InputColourSpaceConversion ipCSC,
+                     const bool bPackedYUVOutputMode,
+                     int confLeft, int confRight, int confTop, int confBottom, ChromaFormat format, const bool bClipToRec709, const bool subtractConfWindowOffsets );
+  void  xQueueRead ( AsyncFrame& frame );
+  AsyncFrame& xWaitForReadFrame();
+  void  xWaitForWrites();
+
 public:
   VideoIOYuv()           {}
   virtual ~VideoIOYuv()  {}
@@ -82,6 +124,11 @@ public:
             const int MSBExtendedBitDepth[MAX_NUM_CHANNEL_TYPE],
             const int internalBitDepth[MAX_NUM_CHANNEL_TYPE]);   ///< open or create file
   void close();                                                  ///< close file
+
+  /// read numFrames frames ahead of read() on a background thread, converted with the parameters of the first read()
+  void setReadAhead  ( int numFrames )  { m_readAheadFrames   = numFrames; }
+  /// let write() return after copying the frame and write up to numFrames frames on a background thread
+  void setWriteBehind( int numFrames )  { m_writeBehindFrames = numFrames; }
 #if EXTENSION_360_VIDEO
   void skipFrames(int numFrames, uint32_t width, uint32_t height, ChromaFormat format);
 #else